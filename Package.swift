@@ -76,6 +76,17 @@ let package = Package(
                 ])
             ]
         ),
+        .testTarget(
+            name: "QwiftUITests",
+            dependencies: [
+                "QwiftUI",
+                "QwiftUITesting",
+            ],
+            swiftSettings: [
+                .interoperabilityMode(.Cxx),
+                .defaultIsolation(MainActor.self),
+            ]
+        ),
         .target(
             name: "Qt6AppBackend",  // SwiftCrossUI backend implementation using QwiftUI
             dependencies: [
@@ -50,6 +50,17 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
     private var mainLoopCallback: (@MainActor () -> Void)?
     private var windows: [QtWindow] = []
     
+    /// When set, windows relayout at most this often (in milliseconds) while being
+    /// resized and do a full pass once resizing pauses. Otherwise they relayout at
+    /// most once per display frame.
+    public var liveResizeInterval: Int? {
+        didSet {
+            for window in windows {
+                window.setLiveResizeInterval(liveResizeInterval)
+            }
+        }
+    }
+    
     // MARK: - Initialization
     
     public init() {
@@ -99,6 +110,7 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
     public func createWindow(withDefaultSize defaultSize: SIMD2<Int>?) -> Window {
         print("QtBackend: createWindow called with defaultSize: \(String(describing: defaultSize))")
         let window = QtWindow(defaultSize: defaultSize)
+        window.setLiveResizeInterval(liveResizeInterval)
         windows.append(window)
         return window
     }
@@ -235,6 +247,11 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
         container.addChild(child)
     }
     
+    /// Replaces the children of a container with a keyed list, applying only the difference
+    public func setChildren(keys: [Int], widgets: [Widget], of container: Widget) {
+        container.setChildren(keys: keys, widgets: widgets)
+    }
+    
     /// Sets the position of the specified child in a container
     public func setPosition(ofChildAt index: Int, in container: Widget, to position: SIMD2<Int>) {
         container.setChildPosition(at: index, to: position)
@@ -296,8 +313,9 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
     ) {
         if let checkBox = checkbox.qtWidget as? QwiftUI.CheckBox {
             checkBox.text = label
-            checkBox.onStateChanged { _ in
-                onChange(checkBox.isChecked)
+            // Use the delivered state rather than capturing the checkbox in its own handler
+            checkBox.onStateChanged { state in
+                onChange(state == Qt.CheckState.checked.rawValue)
             }
         }
     }
@@ -404,12 +422,12 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
     
     /// Sets the background color of a widget
     public func setBackgroundColor(of widget: Widget, to color: Color) {
-        // TODO: Implement Qt stylesheet or palette color setting
+        widget.qtWidget.setBackgroundColor(Qt.Color(color))
     }
     
     /// Sets the foreground/text color of a widget
     public func setForegroundColor(of widget: Widget, to color: Color) {
-        // TODO: Implement Qt stylesheet or palette color setting
+        widget.qtWidget.setForegroundColor(Qt.Color(color))
     }
     
     // MARK: - Button Management
@@ -461,10 +479,7 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
         onChange: @escaping  (Int?) -> Void
     ) {
         if let combo = picker.qtWidget as? QwiftUI.ComboBox {
-            combo.clear()
-            for option in options {
-                combo.addItem(option)
-            }
+            combo.setItems(options)
             combo.onCurrentIndexChanged { index in
                 onChange(index >= 0 ? index : nil)
             }
@@ -498,10 +513,15 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
     
     /// Creates a colorable rectangle widget
     public func createColorableRectangle() -> Widget {
-        // Use a plain widget that can be styled
+        // A plain widget; its color is a shared palette filled by autoFillBackground
         QtBackendWidget(QwiftUI.Widget())
     }
     
+    /// Sets the fill color of a colorable rectangle
+    public func setColor(ofColorableRectangle widget: Widget, to color: Color) {
+        widget.qtWidget.setBackgroundColor(Qt.Color(color))
+    }
+    
     // MARK: - Progress Spinner
     
     /// Creates a progress spinner (indeterminate progress)
@@ -616,38 +636,32 @@ public final class QtBackend: AppBackend, @unchecked Sendable {
         on window: Window,
         completion: @escaping (Int) -> Void
     ) {
-        // Use QwiftUI.MessageBox for alerts
+        // Non-blocking: the box opens with QMessageBox::open() and reports back through
+        // the completion, so no nested event loop runs inside the view update
         let parent = window.widget
         
+        let icon: QwiftUI.MessageBox.Icon
+        var buttons: QwiftUI.MessageBox.Buttons = .ok
         switch alert.style {
         case .information:
-            QwiftUI.MessageBox.showInformation(
-                title: alert.title,
-                text: alert.message,
-                parent: parent
-            )
-            completion(0)
+            icon = .information
         case .warning:
-            QwiftUI.MessageBox.showWarning(
-                title: alert.title,
-                text: alert.message,
-                parent: parent
-            )
-            completion(0)
+            icon = .warning
         case .critical:
-            QwiftUI.MessageBox.showCritical(
-                title: alert.title,
-                text: alert.message,
-                parent: parent
-            )
-            completion(0)
+            icon = .critical
         case .question:
-            let result = QwiftUI.MessageBox.showQuestion(
-                title: alert.title,
-                text: alert.message,
-                parent: parent
-            )
-            completion(result ? 1 : 0)
+            icon = .question
+            buttons = [.yes, .no]
+        }
+        
+        QwiftUI.MessageBox.open(
+            title: alert.title,
+            text: alert.message,
+            icon: icon,
+            buttons: buttons,
+            parent: parent
+        ) { button, _ in
+            completion(button == .yes ? 1 : 0)
         }
     }
     
@@ -722,6 +736,17 @@ public final class QtWindow {
         if let size = defaultSize {
             widget.resize(width: size.x, height: size.y)
         }
+        
+        // Edge drags produce many resizes per frame; relayout once per frame with the final size
+        widget.setResizeDelivery(.perFrame)
+    }
+    
+    func setLiveResizeInterval(_ interval: Int?) {
+        if let interval = interval {
+            widget.setResizeDelivery(.live(intervalMilliseconds: interval))
+        } else {
+            widget.setResizeDelivery(.perFrame)
+        }
     }
     
     func setTitle(_ title: String) {
@@ -820,6 +845,17 @@ public final class QtBackendWidget {
         }
     }
     
+    func setChildren(keys: [Int], widgets: [QtBackendWidget]) {
+        if let container = qtWidget as? QwiftUI.Container {
+            container.setChildren(keys: keys, widgets: widgets.map { $0.qtWidget })
+        } else {
+            removeAllChildren()
+            for child in widgets {
+                addChild(child)
+            }
+        }
+    }
+    
     func setChildPosition(at index: Int, to position: SIMD2<Int>) {
         if let container = qtWidget as? QwiftUI.Container {
             container.setChildPosition(at: index, x: position.x, y: position.y)
@@ -882,4 +918,11 @@ public struct QtPath {
     public init(_ path: String) {
         self.path = path
     }
-}
\ No newline at end of file
+}
+
+extension Qt.Color {
+    /// Converts a SwiftCrossUI color
+    init(_ color: Color) {
+        self.init(red: Double(color.red), green: Double(color.green), blue: Double(color.blue), alpha: Double(color.alpha))
+    }
+}
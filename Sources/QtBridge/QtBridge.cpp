@@ -25,15 +25,43 @@
 #include <QtWidgets/QDial>
 #include <QtWidgets/QLCDNumber>
 #include <QtWidgets/QCalendarWidget>
+#include <QtWidgets/QFrame>
+#include <QtWidgets/QCompleter>
+#include <QtWidgets/QAbstractItemView>
+#include <QtWidgets/QBoxLayout>
+#include <QtWidgets/QLayout>
+#include <QtWidgets/QLayoutItem>
 #include <QtGui/QPixmap>
+#include <QtGui/QPalette>
+#include <QtGui/QColor>
+#include <QtGui/QPainter>
+#include <QtGui/QPainterPath>
+#include <QtGui/QPen>
+#include <QtGui/QImage>
+#include <QtGui/QFont>
+#include <QtGui/QFontMetricsF>
+#include <QtGui/QRegion>
+#include <QtGui/QPolygonF>
+#include <QtGui/QImageReader>
+#include <QtGui/QImageWriter>
+#include <QtGui/QWheelEvent>
+#include <QtGui/QTextDocument>
+#include <QtGui/QTextCursor>
 #include <QtCore/QString>
+#include <QtCore/QByteArray>
+#include <QtCore/QStringEncoder>
 #include <QtCore/QDate>
 #include <QtCore/QTime>
 #include <QtCore/QDateTime>
 #include <QtCore/QObject>
+#include <QtCore/QFile>
+#include <QtCore/QMetaObject>
+#include <QtCore/QMetaProperty>
+#include <QtCore/QVariant>
 #include <QtCore/QEvent>
 #include <QtCore/QTimer>
 #include <QtCore/QEventLoop>
+#include <QtCore/QAbstractEventDispatcher>
 #include <QtGui/QMouseEvent>
 #include <QtGui/QKeyEvent>
 #include <QtGui/QFocusEvent>
@@ -46,6 +74,39 @@
 #include <QtGui/QShowEvent>
 #include <QtGui/QHideEvent>
 #include <QtCore/QThread>
+#include <QtCore/QSemaphore>
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QAbstractProxyModel>
+#include <QtCore/QStringListModel>
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtCore/QPointer>
+#include <QtCore/QCache>
+#include <QtCore/QThreadPool>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <atomic>
+#include <tuple>
+#include <typeinfo>
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define SWIFT_HAS_BACKTRACE 1
+#endif
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 // Static instance pointer and exit code
 SwiftQApplication* SwiftQApplication::g_appInstance = nullptr;
@@ -245,3697 +306,8013 @@ protected:
     bool eventFilter(QObject* obj, QEvent* event) override;
 };
 
+// Coalesces bursts of change notifications into fewer deliveries.
+// With a window of 0 every trigger is delivered immediately. Otherwise the first trigger
+// arms a single-shot timer and later triggers only mark the change as pending (throttle),
+// or restart the timer when debouncing. The deliver function reads the widget's current
+// state, so the handler always observes the latest value.
+class SwiftSignalCoalescer {
+private:
+    int windowMs;
+    bool debounce;
+    bool pending;
+    QTimer* timer;
+    std::function<void()> deliver;
+    
+public:
+    SwiftSignalCoalescer(int windowMs, bool debounce, std::function<void()> deliver)
+        : windowMs(windowMs), debounce(debounce), pending(false), timer(nullptr), deliver(std::move(deliver)) {}
+    
+    ~SwiftSignalCoalescer() {
+        if (timer) {
+            // The timer may be emitting right now (handler replaced from inside its own callback)
+            timer->stop();
+            QObject::disconnect(timer, nullptr, nullptr, nullptr);
+            timer->deleteLater();
+        }
+    }
+    
+    SwiftSignalCoalescer(const SwiftSignalCoalescer&) = delete;
+    SwiftSignalCoalescer& operator=(const SwiftSignalCoalescer&) = delete;
+    
+    void trigger() {
+        if (windowMs <= 0) {
+            invoke();
+            return;
+        }
+        pending = true;
+        if (!timer) {
+            timer = new QTimer();
+            timer->setSingleShot(true);
+            QObject::connect(timer, &QTimer::timeout, [this]() {
+                flush();
+            });
+        }
+        if (debounce || !timer->isActive()) {
+            timer->start(windowMs);
+        }
+    }
+    
+    // Deliver a pending change right away (e.g. before returnPressed)
+    void flush() {
+        if (timer) {
+            timer->stop();
+        }
+        if (pending) {
+            pending = false;
+            invoke();
+        }
+    }
+    
+private:
+    void invoke() {
+        // Copy first: the handler may replace the coalescer that owns this function
+        std::function<void()> fn = deliver;
+        if (fn) {
+            fn();
+        }
+    }
+};
+
+// Process-wide intern table for item strings. Models keep QStrings that share the pooled
+// buffer (implicit sharing), so a label used by many combo boxes is stored once.
+// Entries are reference counted by the models and dropped with the last row using them.
+class SwiftStringPool {
+private:
+    QHash<QString, int> refs;
+    
+public:
+    static SwiftStringPool& shared() {
+        // Leaked on purpose: models released during static teardown at exit still use it
+        static SwiftStringPool* pool = new SwiftStringPool();
+        return *pool;
+    }
+    
+    QString intern(const QString& text) {
+        if (text.isEmpty()) {
+            return QString();
+        }
+        auto it = refs.find(text);
+        if (it == refs.end()) {
+            it = refs.insert(text, 0);
+        }
+        ++it.value();
+        return it.key();
+    }
+    
+    void release(const QString& text) {
+        if (text.isEmpty()) {
+            return;
+        }
+        auto it = refs.find(text);
+        if (it != refs.end() && --it.value() <= 0) {
+            refs.erase(it);
+        }
+    }
+};
+
+// List model backing SwiftQComboBox. It replaces both the bridge's std::string cache and
+// QComboBox's default QStandardItemModel (one heap QStandardItem per row), so every item
+// string exists once. Bulk loads are a single model reset. The search indexes used for
+// editable-mode filtering are built on the first query after a mutation.
+class SwiftStringListModel : public QAbstractListModel {
+private:
+    std::vector<QString> rows;
+    
+    bool sortedValid;
+    bool trigramsValid;
+    std::vector<int> sortedRows;                   // Rows in case-insensitive order
+    QHash<quint64, std::vector<int>> trigramRows;  // Case-folded trigram -> ascending rows
+    
+public:
+    explicit SwiftStringListModel(QObject* parent = nullptr)
+        : QAbstractListModel(parent), sortedValid(false), trigramsValid(false) {}
+    
+    // The combo box rendering this model; cleared by Qt when the combo box is deleted
+    QPointer<QComboBox> view;
+    
+    ~SwiftStringListModel() override {
+        releaseAll();
+    }
+    
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override {
+        return parent.isValid() ? 0 : size();
+    }
+    
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override {
+        if (!index.isValid() || index.row() < 0 || index.row() >= size()) {
+            return QVariant();
+        }
+        if (role == Qt::DisplayRole || role == Qt::EditRole) {
+            return rows[index.row()];
+        }
+        return QVariant();
+    }
+    
+    // QComboBox's insert policy adds user-entered text through insertRows + setData
+    bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override {
+        if (!index.isValid() || index.row() < 0 || index.row() >= size() ||
+            (role != Qt::EditRole && role != Qt::DisplayRole)) {
+            return false;
+        }
+        QString& slot = rows[index.row()];
+        SwiftStringPool::shared().release(slot);
+        slot = SwiftStringPool::shared().intern(value.toString());
+        invalidateIndexes();
+        Q_EMIT dataChanged(index, index, {Qt::DisplayRole, Qt::EditRole});
+        return true;
+    }
+    
+    bool insertRows(int row, int count, const QModelIndex& parent = QModelIndex()) override {
+        if (parent.isValid() || row < 0 || row > size() || count <= 0) {
+            return false;
+        }
+        beginInsertRows(QModelIndex(), row, row + count - 1);
+        rows.insert(rows.begin() + row, count, QString());
+        invalidateIndexes();
+        endInsertRows();
+        return true;
+    }
+    
+    bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override {
+        if (parent.isValid() || row < 0 || count <= 0 || row + count > size()) {
+            return false;
+        }
+        beginRemoveRows(QModelIndex(), row, row + count - 1);
+        for (int i = row; i < row + count; ++i) {
+            SwiftStringPool::shared().release(rows[i]);
+        }
+        rows.erase(rows.begin() + row, rows.begin() + row + count);
+        invalidateIndexes();
+        endRemoveRows();
+        return true;
+    }
+    
+    int size() const {
+        return static_cast<int>(rows.size());
+    }
+    
+    const QString& textAt(int row) const {
+        return rows[row];
+    }
+    
+    void insertText(int row, const QString& text) {
+        beginInsertRows(QModelIndex(), row, row);
+        rows.insert(rows.begin() + row, SwiftStringPool::shared().intern(text));
+        invalidateIndexes();
+        endInsertRows();
+    }
+    
+    void resetUtf8(const char* const* items, int count) {
+        beginResetModel();
+        releaseAll();
+        rows.clear();
+        appendUtf8Rows(items, count);
+        invalidateIndexes();
+        endResetModel();
+    }
+    
+    void appendUtf8(const char* const* items, int count) {
+        if (!items || count <= 0) {
+            return;
+        }
+        beginInsertRows(QModelIndex(), size(), size() + count - 1);
+        appendUtf8Rows(items, count);
+        invalidateIndexes();
+        endInsertRows();
+    }
+    
+    // Rows whose text starts with (or, for substring, contains) the query, case-insensitive.
+    // Prefix matches come back in sorted order, substring matches in row order.
+    void findMatches(const QString& query, bool substring, int maxRows, std::vector<int>& out) {
+        out.clear();
+        if (maxRows <= 0) {
+            return;
+        }
+        const size_t limit = static_cast<size_t>(maxRows);
+        
+        if (query.isEmpty()) {
+            for (int row = 0; row < size() && out.size() < limit; ++row) {
+                out.push_back(row);
+            }
+            return;
+        }
+        
+        if (!substring) {
+            ensureSortedIndex();
+            // Case-insensitive lexicographic order keeps all rows sharing a prefix contiguous
+            auto first = std::lower_bound(sortedRows.begin(), sortedRows.end(), query,
+                [this](int row, const QString& key) {
+                    return QStringView(rows[row]).left(key.size()).compare(key, Qt::CaseInsensitive) < 0;
+                });
+            for (auto it = first; it != sortedRows.end() && out.size() < limit; ++it) {
+                if (!rows[*it].startsWith(query, Qt::CaseInsensitive)) {
+                    break;
+                }
+                out.push_back(*it);
+            }
+            return;
+        }
+        
+        if (query.size() < 3) {
+            // Too short for the trigram index; stop as soon as enough rows matched
+            for (int row = 0; row < size() && out.size() < limit; ++row) {
+                if (rows[row].contains(query, Qt::CaseInsensitive)) {
+                    out.push_back(row);
+                }
+            }
+            return;
+        }
+        
+        // Every match contains every trigram of the query: verify only the rows of the
+        // rarest one
+        ensureTrigramIndex();
+        const std::vector<int>* candidates = nullptr;
+        for (int i = 0; i + 2 < query.size(); ++i) {
+            auto it = trigramRows.constFind(trigramKey(query[i], query[i + 1], query[i + 2]));
+            if (it == trigramRows.constEnd()) {
+                return;
+            }
+            if (!candidates || it->size() < candidates->size()) {
+                candidates = &it.value();
+            }
+        }
+        for (int row : *candidates) {
+            if (out.size() >= limit) {
+                break;
+            }
+            if (rows[row].contains(query, Qt::CaseInsensitive)) {
+                out.push_back(row);
+            }
+        }
+    }
+    
+private:
+    static quint64 trigramKey(QChar a, QChar b, QChar c) {
+        return (quint64(a.toCaseFolded().unicode()) << 32) |
+               (quint64(b.toCaseFolded().unicode()) << 16) |
+               quint64(c.toCaseFolded().unicode());
+    }
+    
+    void appendUtf8Rows(const char* const* items, int count) {
+        if (!items || count <= 0) {
+            return;
+        }
+        rows.reserve(rows.size() + count);
+        for (int i = 0; i < count; ++i) {
+            rows.push_back(SwiftStringPool::shared().intern(QString::fromUtf8(items[i] ? items[i] : "")));
+        }
+    }
+    
+    void releaseAll() {
+        for (const QString& text : rows) {
+            SwiftStringPool::shared().release(text);
+        }
+    }
+    
+    void invalidateIndexes() {
+        if (sortedValid) {
+            sortedValid = false;
+            std::vector<int>().swap(sortedRows);
+        }
+        if (trigramsValid) {
+            trigramsValid = false;
+            trigramRows.clear();
+        }
+    }
+    
+    void ensureSortedIndex() {
+        if (sortedValid) {
+            return;
+        }
+        sortedRows.resize(rows.size());
+        for (int row = 0; row < size(); ++row) {
+            sortedRows[row] = row;
+        }
+        std::stable_sort(sortedRows.begin(), sortedRows.end(), [this](int a, int b) {
+            return rows[a].compare(rows[b], Qt::CaseInsensitive) < 0;
+        });
+        sortedValid = true;
+    }
+    
+    void ensureTrigramIndex() {
+        if (trigramsValid) {
+            return;
+        }
+        trigramRows.clear();
+        for (int row = 0; row < size(); ++row) {
+            const QString& text = rows[row];
+            for (int i = 0; i + 2 < text.size(); ++i) {
+                std::vector<int>& posting = trigramRows[trigramKey(text[i], text[i + 1], text[i + 2])];
+                // Rows are visited in order, so a repeated trigram within a row is adjacent
+                if (posting.empty() || posting.back() != row) {
+                    posting.push_back(row);
+                }
+            }
+        }
+        trigramsValid = true;
+    }
+};
+
+// Flex-style stack layout for Container. Children live in one contiguous array together with
+// their flex factors. setGeometry reads the items' cached size hints (QWidgetItemV2 caches them
+// per widget and drops only the entry of the widget that changed), distributes the free space
+// in a single pass and applies the frames in one batch with updates suspended, skipping
+// children whose frame did not change. Qt's LayoutRequest/invalidate cycle decides when a
+// container is laid out again, so only containers whose content changed pay for a pass.
+class SwiftStackLayout : public QLayout {
+private:
+    struct Entry {
+        QLayoutItem* item;
+        int grow;
+        int shrink;
+    };
+    
+    // Measurements of one layout pass, kept to avoid reallocating per pass
+    struct Slot {
+        double basis;
+        double minMain;
+        double maxMain;
+        int cross;
+        int minCross;
+        int maxCross;
+    };
+    
+    std::vector<Entry> entries;
+    std::vector<Slot> slots;
+    int axis;       // 0 = horizontal, 1 = vertical
+    int alignment;  // Cross axis: 0 = start, 1 = center, 2 = end, 3 = stretch
+    int justify;    // Main axis: 0 = start, 1 = center, 2 = end, 3 = space between
+    bool dirty;
+    QRect lastRect;
+    mutable bool hintsValid;
+    mutable QSize cachedHint;
+    mutable QSize cachedMinimum;
+    
+    int mainOf(const QSize& size) const { return axis == 0 ? size.width() : size.height(); }
+    int crossOf(const QSize& size) const { return axis == 0 ? size.height() : size.width(); }
+    
+    void updateHints() const {
+        if (hintsValid) {
+            return;
+        }
+        int hintMain = 0, minMain = 0, cross = 0, minCross = 0, visible = 0;
+        for (const Entry& entry : entries) {
+            if (entry.item->isEmpty()) {
+                continue;
+            }
+            const QSize hint = entry.item->sizeHint();
+            const QSize minimum = entry.item->minimumSize();
+            hintMain += mainOf(hint);
+            // Children that cannot shrink need their full hint
+            minMain += entry.shrink > 0 ? mainOf(minimum) : mainOf(hint);
+            cross = qMax(cross, crossOf(hint));
+            minCross = qMax(minCross, crossOf(minimum));
+            ++visible;
+        }
+        const int gaps = visible > 1 ? qMax(0, spacing()) * (visible - 1) : 0;
+        const QMargins margins = contentsMargins();
+        cachedHint = (axis == 0 ? QSize(hintMain + gaps, cross) : QSize(cross, hintMain + gaps)).grownBy(margins);
+        cachedMinimum = (axis == 0 ? QSize(minMain + gaps, minCross) : QSize(minCross, minMain + gaps)).grownBy(margins);
+        hintsValid = true;
+    }
+    
+public:
+    explicit SwiftStackLayout(QWidget* parent)
+        : QLayout(parent), axis(1), alignment(3), justify(0), dirty(true), hintsValid(false) {
+        setContentsMargins(0, 0, 0, 0);
+        setSpacing(0);
+    }
+    
+    ~SwiftStackLayout() override {
+        for (Entry& entry : entries) {
+            delete entry.item;
+        }
+    }
+    
+    void configure(int newAxis, int newSpacing, int newAlignment, int newJustify) {
+        axis = newAxis == 0 ? 0 : 1;
+        alignment = qBound(0, newAlignment, 3);
+        justify = qBound(0, newJustify, 3);
+        setSpacing(qMax(0, newSpacing));
+        invalidate();
+    }
+    
+    void addWidgetWithFlex(QWidget* child, int grow, int shrink) {
+        addChildWidget(child);
+        entries.push_back({new QWidgetItemV2(child), qMax(0, grow), qMax(0, shrink)});
+        invalidate();
+    }
+    
+    void setFlex(QWidget* child, int grow, int shrink) {
+        for (Entry& entry : entries) {
+            if (entry.item->widget() == child) {
+                entry.grow = qMax(0, grow);
+                entry.shrink = qMax(0, shrink);
+                invalidate();
+                return;
+            }
+        }
+    }
+    
+    // Puts the widgets listed in `order` first, in that order (used by setChildren)
+    void reorder(const std::vector<QWidget*>& order) {
+        QHash<QWidget*, int> rank;
+        rank.reserve(static_cast<int>(order.size()));
+        for (size_t i = 0; i < order.size(); ++i) {
+            rank.insert(order[i], static_cast<int>(i));
+        }
+        auto byRank = [&rank](const Entry& a, const Entry& b) {
+            return rank.value(a.item->widget(), INT_MAX) < rank.value(b.item->widget(), INT_MAX);
+        };
+        if (!std::is_sorted(entries.begin(), entries.end(), byRank)) {
+            std::stable_sort(entries.begin(), entries.end(), byRank);
+            invalidate();
+        }
+    }
+    
+    // QLayout interface
+    void addItem(QLayoutItem* item) override {
+        entries.push_back({item, 0, 1});
+        invalidate();
+    }
+    
+    int count() const override {
+        return static_cast<int>(entries.size());
+    }
+    
+    QLayoutItem* itemAt(int index) const override {
+        return index >= 0 && index < count() ? entries[index].item : nullptr;
+    }
+    
+    QLayoutItem* takeAt(int index) override {
+        if (index < 0 || index >= count()) {
+            return nullptr;
+        }
+        QLayoutItem* item = entries[index].item;
+        entries.erase(entries.begin() + index);
+        invalidate();
+        return item;
+    }
+    
+    void invalidate() override {
+        dirty = true;
+        hintsValid = false;
+        QLayout::invalidate();
+    }
+    
+    QSize sizeHint() const override {
+        updateHints();
+        return cachedHint;
+    }
+    
+    QSize minimumSize() const override {
+        updateHints();
+        return cachedMinimum;
+    }
+    
+    Qt::Orientations expandingDirections() const override {
+        Qt::Orientations directions;
+        for (const Entry& entry : entries) {
+            if (entry.grow > 0) {
+                directions |= axis == 0 ? Qt::Horizontal : Qt::Vertical;
+                break;
+            }
+        }
+        if (alignment == 3 && !entries.empty()) {
+            directions |= axis == 0 ? Qt::Vertical : Qt::Horizontal;
+        }
+        return directions;
+    }
+    
+    void setGeometry(const QRect& rect) override {
+        QLayout::setGeometry(rect);
+        if (!dirty && rect == lastRect) {
+            return;
+        }
+        dirty = false;
+        lastRect = rect;
+        
+        const QRect area = rect.marginsRemoved(contentsMargins());
+        const int gap = qMax(0, spacing());
+        const int crossAvailable = qMax(0, axis == 0 ? area.height() : area.width());
+        
+        // Measure: flex basis and limits from the cached hints
+        slots.resize(entries.size());
+        double used = 0, growTotal = 0, shrinkTotal = 0;
+        int visible = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const Entry& entry = entries[i];
+            Slot& slot = slots[i];
+            if (entry.item->isEmpty()) {
+                slot.basis = -1;
+                continue;
+            }
+            const QSize hint = entry.item->sizeHint();
+            const QSize minimum = entry.item->minimumSize();
+            const QSize maximum = entry.item->maximumSize();
+            slot.minMain = mainOf(minimum);
+            slot.maxMain = qMax(slot.minMain, double(mainOf(maximum)));
+            slot.basis = qBound(slot.minMain, double(mainOf(hint)), slot.maxMain);
+            slot.minCross = crossOf(minimum);
+            slot.maxCross = qMax(slot.minCross, crossOf(maximum));
+            slot.cross = qBound(slot.minCross, crossOf(hint), slot.maxCross);
+            used += slot.basis;
+            growTotal += entry.grow;
+            shrinkTotal += entry.shrink * slot.basis;
+            ++visible;
+        }
+        if (visible == 0) {
+            return;
+        }
+        used += double(gap) * (visible - 1);
+        const double freeSpace = (axis == 0 ? area.width() : area.height()) - used;
+        
+        double cursor = axis == 0 ? area.left() : area.top();
+        double between = gap;
+        if (freeSpace > 0 && growTotal == 0) {
+            if (justify == 1) {
+                cursor += freeSpace / 2;
+            } else if (justify == 2) {
+                cursor += freeSpace;
+            } else if (justify == 3 && visible > 1) {
+                between += freeSpace / (visible - 1);
+            }
+        }
+        const int crossStart = axis == 0 ? area.top() : area.left();
+        
+        // Distribute and apply in one pass, with the container's repaints suspended
+        QWidget* host = parentWidget();
+        const bool suspend = host && host->updatesEnabled();
+        if (suspend) {
+            host->setUpdatesEnabled(false);
+        }
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const Slot& slot = slots[i];
+            if (slot.basis < 0) {
+                continue;
+            }
+            const Entry& entry = entries[i];
+            double size = slot.basis;
+            if (freeSpace > 0 && growTotal > 0) {
+                size += freeSpace * entry.grow / growTotal;
+            } else if (freeSpace < 0 && shrinkTotal > 0) {
+                size += freeSpace * entry.shrink * slot.basis / shrinkTotal;
+            }
+            size = qBound(slot.minMain, size, slot.maxMain);
+            
+            // Round the edges rather than the sizes so rounding errors do not accumulate
+            const int start = qRound(cursor);
+            const int end = qRound(cursor + size);
+            cursor += size + between;
+            
+            int crossSize = alignment == 3 ? qBound(slot.minCross, crossAvailable, slot.maxCross)
+                                           : qMin(slot.cross, crossAvailable);
+            int crossPos = crossStart;
+            if (alignment == 1) {
+                crossPos += (crossAvailable - crossSize) / 2;
+            } else if (alignment == 2) {
+                crossPos += crossAvailable - crossSize;
+            }
+            
+            const QRect frame = axis == 0 ? QRect(start, crossPos, end - start, crossSize)
+                                          : QRect(crossPos, start, crossSize, end - start);
+            if (entry.item->geometry() != frame) {
+                entry.item->setGeometry(frame);
+            }
+        }
+        if (suspend) {
+            host->setUpdatesEnabled(true);
+        }
+    }
+};
+
+// SwiftEventRing implementation
+struct SwiftEventRingState {
+    std::vector<QtEventRecord> slots;
+    quint64 mask = 0;
+    alignas(64) std::atomic<quint64> head{0};   // Next slot the producer writes
+    alignas(64) std::atomic<quint64> tail{0};   // Next slot the consumer reads
+    std::atomic<long long> written{0};
+    std::atomic<long long> dropped{0};
+    SwiftCallback drainHandler{nullptr, nullptr};
+    QMetaObject::Connection drainConnection;
+    
+    SwiftEventRingState() : slots(4096), mask(4095) {}
+};
+
+static SwiftEventRingState& eventRing() {
+    static SwiftEventRingState state;
+    return state;
+}
+
+void SwiftEventRing::setCapacity(int records) {
+    SwiftEventRingState& ring = eventRing();
+    quint64 size = 64;
+    while (size < static_cast<quint64>(qMax(records, 1))) {
+        size <<= 1;
+    }
+    ring.slots.assign(size, QtEventRecord{});
+    ring.mask = size - 1;
+    ring.head.store(0, std::memory_order_relaxed);
+    ring.tail.store(0, std::memory_order_release);
+}
+
+int SwiftEventRing::capacity() {
+    return static_cast<int>(eventRing().slots.size());
+}
+
+int SwiftEventRing::pendingCount() {
+    const SwiftEventRingState& ring = eventRing();
+    return static_cast<int>(ring.head.load(std::memory_order_acquire) - ring.tail.load(std::memory_order_acquire));
+}
+
+bool SwiftEventRing::push(const QtEventRecord& record) {
+    SwiftEventRingState& ring = eventRing();
+    const quint64 head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) >= ring.slots.size()) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    ring.slots[head & ring.mask] = record;
+    ring.head.store(head + 1, std::memory_order_release);
+    ring.written.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+int SwiftEventRing::read(QtEventRecord* buffer, int maxRecords) {
+    SwiftEventRingState& ring = eventRing();
+    if (!buffer || maxRecords <= 0) {
+        return 0;
+    }
+    const quint64 tail = ring.tail.load(std::memory_order_relaxed);
+    const quint64 available = ring.head.load(std::memory_order_acquire) - tail;
+    const quint64 count = qMin(available, static_cast<quint64>(maxRecords));
+    
+    // At most two contiguous runs: up to the end of the slots, then from the start
+    const quint64 start = tail & ring.mask;
+    const quint64 first = qMin(count, ring.slots.size() - start);
+    std::memcpy(buffer, ring.slots.data() + start, first * sizeof(QtEventRecord));
+    std::memcpy(buffer + first, ring.slots.data(), (count - first) * sizeof(QtEventRecord));
+    
+    ring.tail.store(tail + count, std::memory_order_release);
+    return static_cast<int>(count);
+}
+
+long long SwiftEventRing::writtenCount() {
+    return eventRing().written.load(std::memory_order_relaxed);
+}
+
+long long SwiftEventRing::droppedCount() {
+    return eventRing().dropped.load(std::memory_order_relaxed);
+}
+
+void SwiftEventRing::resetCounters() {
+    eventRing().written.store(0, std::memory_order_relaxed);
+    eventRing().dropped.store(0, std::memory_order_relaxed);
+}
+
+void SwiftEventRing::setDrainHandler(SwiftCallback callback) {
+    SwiftEventRingState& ring = eventRing();
+    ring.drainHandler = callback;
+    if (ring.drainConnection) {
+        return;
+    }
+    QAbstractEventDispatcher* dispatcher = QAbstractEventDispatcher::instance();
+    if (!dispatcher) {
+        return;
+    }
+    ring.drainConnection = QObject::connect(dispatcher, &QAbstractEventDispatcher::aboutToBlock, []() {
+        SwiftEventRingState& state = eventRing();
+        if (state.drainHandler.handler && SwiftEventRing::pendingCount() > 0) {
+            state.drainHandler.handler(state.drainHandler.context);
+        }
+    });
+}
+
+void SwiftEventRing::clearDrainHandler() {
+    SwiftEventRingState& ring = eventRing();
+    ring.drainHandler = SwiftCallback{nullptr, nullptr};
+    if (ring.drainConnection) {
+        QObject::disconnect(ring.drainConnection);
+        ring.drainConnection = QMetaObject::Connection();
+    }
+}
+
+// SwiftWidgetRegistry implementation
+struct SwiftWidgetSlot {
+    const QObject* object = nullptr;
+    SwiftQWidget* wrapper = nullptr;
+    quint32 generation = 1;
+    bool adopted = false;      // Wrapper created by wrapperFor, deleted with the widget
+    QMetaObject::Connection destroyedConnection;
+};
+
+struct SwiftWidgetRegistryState {
+    std::vector<SwiftWidgetSlot> slots;
+    std::vector<quint32> freeSlots;
+    QHash<const QObject*, quint32> index;
+};
+
+static SwiftWidgetRegistryState& widgetRegistry() {
+    static SwiftWidgetRegistryState state;
+    return state;
+}
+
+static void releaseWidgetSlot(SwiftWidgetRegistryState& registry, quint32 slotIndex) {
+    SwiftWidgetSlot& slot = registry.slots[slotIndex];
+    registry.index.remove(slot.object);
+    slot.object = nullptr;
+    slot.wrapper = nullptr;
+    slot.adopted = false;
+    slot.destroyedConnection = QMetaObject::Connection();
+    if (++slot.generation == 0) {
+        slot.generation = 1;   // 0 would make handle 0 valid
+    }
+    registry.freeSlots.push_back(slotIndex);
+}
+
+void SwiftWidgetRegistry::attach(QWidget* widget, SwiftQWidget* wrapper) {
+    SwiftWidgetRegistryState& registry = widgetRegistry();
+    if (!widget || !wrapper || registry.index.contains(widget)) {
+        return;   // The first wrapper stays canonical
+    }
+    quint32 slotIndex;
+    if (!registry.freeSlots.empty()) {
+        slotIndex = registry.freeSlots.back();
+        registry.freeSlots.pop_back();
+    } else {
+        slotIndex = static_cast<quint32>(registry.slots.size());
+        registry.slots.emplace_back();
+    }
+    SwiftWidgetSlot& slot = registry.slots[slotIndex];
+    slot.object = widget;
+    slot.wrapper = wrapper;
+    registry.index.insert(widget, slotIndex);
+    
+    // QWidget does not receive QEvent::Destroy when deleted; destroyed() is the reliable signal.
+    // It fires before the children (including the wrapper's event filter) are deleted.
+    const quint32 generation = slot.generation;
+    slot.destroyedConnection = QObject::connect(widget, &QObject::destroyed, [slotIndex, generation]() {
+        SwiftWidgetRegistryState& state = widgetRegistry();
+        SwiftWidgetSlot& entry = state.slots[slotIndex];
+        if (entry.generation != generation) {
+            return;
+        }
+        SwiftQWidget* owner = entry.wrapper;
+        const bool adopted = entry.adopted;
+        releaseWidgetSlot(state, slotIndex);
+        if (owner) {
+            if (owner->eventFilter) {
+                owner->eventFilter->clearWidget();
+                owner->eventFilter = nullptr;
+            }
+            owner->widget = nullptr;
+            if (adopted) {
+                delete owner;
+            }
+        }
+    });
+}
+
+void SwiftWidgetRegistry::detach(SwiftQWidget* wrapper) {
+    SwiftWidgetRegistryState& registry = widgetRegistry();
+    if (!wrapper || !wrapper->widget) {
+        return;
+    }
+    auto it = registry.index.constFind(wrapper->widget);
+    if (it == registry.index.constEnd() || registry.slots[it.value()].wrapper != wrapper) {
+        return;
+    }
+    const quint32 slotIndex = it.value();
+    QObject::disconnect(registry.slots[slotIndex].destroyedConnection);
+    releaseWidgetSlot(registry, slotIndex);
+}
+
+SwiftQWidget* SwiftWidgetRegistry::find(QWidget* widget) {
+    SwiftWidgetRegistryState& registry = widgetRegistry();
+    auto it = registry.index.constFind(widget);
+    return it == registry.index.constEnd() ? nullptr : registry.slots[it.value()].wrapper;
+}
+
+SwiftQWidget* SwiftWidgetRegistry::wrapperFor(QWidget* widget) {
+    if (!widget) {
+        return nullptr;
+    }
+    if (SwiftQWidget* wrapper = find(widget)) {
+        return wrapper;
+    }
+    // The non-owning constructor installs the event filter, which registers the wrapper
+    SwiftQWidget* wrapper = new SwiftQWidget(widget);
+    SwiftWidgetRegistryState& registry = widgetRegistry();
+    auto it = registry.index.constFind(widget);
+    if (it != registry.index.constEnd()) {
+        registry.slots[it.value()].adopted = true;
+    }
+    return wrapper;
+}
+
+unsigned long long SwiftWidgetRegistry::handleFor(SwiftQWidget* wrapper) {
+    SwiftWidgetRegistryState& registry = widgetRegistry();
+    if (!wrapper || !wrapper->widget) {
+        return 0;
+    }
+    auto it = registry.index.constFind(wrapper->widget);
+    if (it == registry.index.constEnd() || registry.slots[it.value()].wrapper != wrapper) {
+        return 0;
+    }
+    return (static_cast<unsigned long long>(registry.slots[it.value()].generation) << 32) | it.value();
+}
+
+SwiftQWidget* SwiftWidgetRegistry::resolve(unsigned long long handle) {
+    SwiftWidgetRegistryState& registry = widgetRegistry();
+    const quint32 slotIndex = static_cast<quint32>(handle & 0xFFFFFFFFULL);
+    const quint32 generation = static_cast<quint32>(handle >> 32);
+    if (slotIndex >= registry.slots.size() || registry.slots[slotIndex].generation != generation) {
+        return nullptr;
+    }
+    return registry.slots[slotIndex].wrapper;
+}
+
+SwiftQWidget* SwiftWidgetRegistry::detached() {
+    // Borrows no widget and, being non-owning, never creates one
+    static SwiftQWidget* wrapper = [] {
+        SwiftQWidget* inert = new SwiftQWidget(static_cast<QWidget*>(nullptr));
+        SwiftLiveObjects::untrackWrapper(inert);
+        return inert;
+    }();
+    return wrapper;
+}
+
+int SwiftWidgetRegistry::size() {
+    return static_cast<int>(widgetRegistry().index.size());
+}
+
+// SwiftLiveObjects implementation
+struct SwiftLiveEntry {
+    unsigned long long serial = 0;
+    std::vector<void*> frames;   // Creation stack, empty without capture
+};
+
+struct SwiftCollectedObject {
+    int kind;
+    unsigned long long serial;
+    std::string type;
+    std::string objectName;
+    std::vector<void*> frames;
+};
+
+struct SwiftLiveObjectsState {
+    QHash<const SwiftQWidget*, SwiftLiveEntry> wrappers;
+    QHash<const QObject*, SwiftLiveEntry> widgets;
+    unsigned long long nextSerial = 1;
+    bool captureBacktraces = false;
+    std::vector<SwiftCollectedObject> collected;
+};
+
+static SwiftLiveObjectsState& liveObjects() {
+    // Leaked on purpose: widgets destroyed during static teardown at exit still untrack themselves
+    static auto* state = new SwiftLiveObjectsState;
+    return *state;
+}
+
+static SwiftLiveEntry newLiveEntry(SwiftLiveObjectsState& state) {
+    SwiftLiveEntry entry;
+    entry.serial = state.nextSerial++;
+#if defined(SWIFT_HAS_BACKTRACE)
+    if (state.captureBacktraces) {
+        void* frames[48];
+        const int count = backtrace(frames, 48);
+        // Skip this function and the track call
+        if (count > 2) {
+            entry.frames.assign(frames + 2, frames + count);
+        }
+    }
+#endif
+    return entry;
+}
+
+static std::string wrapperTypeName(const SwiftQWidget* wrapper) {
+    const char* name = typeid(*wrapper).name();
+#if __has_include(<cxxabi.h>)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (demangled) {
+        std::string result = status == 0 ? demangled : name;
+        std::free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+void SwiftLiveObjects::setCaptureBacktraces(bool capture) {
+    liveObjects().captureBacktraces = capture;
+}
+
+bool SwiftLiveObjects::capturesBacktraces() {
+    return liveObjects().captureBacktraces;
+}
+
+unsigned long long SwiftLiveObjects::mark() {
+    return liveObjects().nextSerial;
+}
+
+int SwiftLiveObjects::liveCount(int kind) {
+    SwiftLiveObjectsState& state = liveObjects();
+    return static_cast<int>(kind == Wrapper ? state.wrappers.size() : state.widgets.size());
+}
+
+int SwiftLiveObjects::liveCountOfType(const std::string& typeName) {
+    SwiftLiveObjectsState& state = liveObjects();
+    int count = 0;
+    for (auto it = state.wrappers.constBegin(); it != state.wrappers.constEnd(); ++it) {
+        if (wrapperTypeName(it.key()) == typeName) {
+            ++count;
+        }
+    }
+    for (auto it = state.widgets.constBegin(); it != state.widgets.constEnd(); ++it) {
+        if (typeName == it.key()->metaObject()->className()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void SwiftLiveObjects::releaseDeferred() {
+    if (QCoreApplication::instance()) {
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    }
+}
+
+long long SwiftLiveObjects::residentBytes() {
+#if defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+        return -1;
+    }
+    return static_cast<long long>(info.resident_size);
+#elif defined(__linux__)
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (!statm.open(QIODevice::ReadOnly)) {
+        return -1;
+    }
+    // Fields: total size, resident, ... in pages
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    bool ok = false;
+    const long long pages = fields.size() > 1 ? fields[1].toLongLong(&ok) : 0;
+    return ok ? pages * sysconf(_SC_PAGESIZE) : -1;
+#else
+    return -1;
+#endif
+}
+
+int SwiftLiveObjects::collect(unsigned long long mark) {
+    SwiftLiveObjectsState& state = liveObjects();
+    state.collected.clear();
+    for (auto it = state.wrappers.constBegin(); it != state.wrappers.constEnd(); ++it) {
+        if (it.value().serial < mark) continue;
+        const SwiftQWidget* wrapper = it.key();
+        const QWidget* widget = wrapper->getQWidget();
+        state.collected.push_back({Wrapper, it.value().serial, wrapperTypeName(wrapper),
+                                   widget ? widget->objectName().toStdString() : std::string(), it.value().frames});
+    }
+    for (auto it = state.widgets.constBegin(); it != state.widgets.constEnd(); ++it) {
+        if (it.value().serial < mark) continue;
+        state.collected.push_back({Widget, it.value().serial, it.key()->metaObject()->className(),
+                                   it.key()->objectName().toStdString(), it.value().frames});
+    }
+    std::sort(state.collected.begin(), state.collected.end(), [](const SwiftCollectedObject& a, const SwiftCollectedObject& b) {
+        return a.serial < b.serial;
+    });
+    return static_cast<int>(state.collected.size());
+}
+
+int SwiftLiveObjects::collectedKind(int index) {
+    const std::vector<SwiftCollectedObject>& collected = liveObjects().collected;
+    return index >= 0 && index < static_cast<int>(collected.size()) ? collected[index].kind : -1;
+}
+
+unsigned long long SwiftLiveObjects::collectedSerial(int index) {
+    const std::vector<SwiftCollectedObject>& collected = liveObjects().collected;
+    return index >= 0 && index < static_cast<int>(collected.size()) ? collected[index].serial : 0;
+}
+
+std::string SwiftLiveObjects::collectedType(int index) {
+    const std::vector<SwiftCollectedObject>& collected = liveObjects().collected;
+    return index >= 0 && index < static_cast<int>(collected.size()) ? collected[index].type : std::string();
+}
+
+std::string SwiftLiveObjects::collectedObjectName(int index) {
+    const std::vector<SwiftCollectedObject>& collected = liveObjects().collected;
+    return index >= 0 && index < static_cast<int>(collected.size()) ? collected[index].objectName : std::string();
+}
+
+std::string SwiftLiveObjects::collectedBacktrace(int index) {
+    const std::vector<SwiftCollectedObject>& collected = liveObjects().collected;
+    std::string result;
+    if (index < 0 || index >= static_cast<int>(collected.size()) || collected[index].frames.empty()) {
+        return result;
+    }
+#if defined(SWIFT_HAS_BACKTRACE)
+    const std::vector<void*>& frames = collected[index].frames;
+    char** symbols = backtrace_symbols(frames.data(), static_cast<int>(frames.size()));
+    if (symbols) {
+        for (size_t i = 0; i < frames.size(); ++i) {
+            result += symbols[i];
+            result += '\n';
+        }
+        std::free(symbols);
+    }
+#endif
+    return result;
+}
+
+void SwiftLiveObjects::trackWrapper(const SwiftQWidget* wrapper) {
+    SwiftLiveObjectsState& state = liveObjects();
+    state.wrappers.insert(wrapper, newLiveEntry(state));
+}
+
+void SwiftLiveObjects::untrackWrapper(const SwiftQWidget* wrapper) {
+    liveObjects().wrappers.remove(wrapper);
+}
+
+void SwiftLiveObjects::trackWidget(QWidget* widget) {
+    SwiftLiveObjectsState& state = liveObjects();
+    if (!widget || state.widgets.contains(widget)) {
+        return;
+    }
+    state.widgets.insert(widget, newLiveEntry(state));
+    QObject::connect(widget, &QObject::destroyed, [widget]() {
+        liveObjects().widgets.remove(widget);
+    });
+}
+
 // SwiftQWidget implementation
 void SwiftQWidget::ensureWidget() {
+    // A wrapper that borrowed its widget does not replace it once it is gone
+    if (!widget && ownsWidget && QApplication::instance()) {
+        if (parentWidget) {
+            widget = new QWidget(parentWidget->getQWidget());
+        } else {
+            widget = new QWidget(nullptr);
+        }
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
+    }
+}
+
+static SwiftStackLayout* stackLayoutOf(QWidget* widget) {
+    return widget ? dynamic_cast<SwiftStackLayout*>(widget->layout()) : nullptr;
+}
+
+void SwiftQWidget::setStackLayout(int axis, int spacing, int alignment, int justify) {
+    ensureWidget();
+    if (!widget) {
+        return;
+    }
+    SwiftStackLayout* layout = stackLayoutOf(widget);
+    if (!layout) {
+        if (widget->layout()) {
+            // Another layout manages the children; leave it alone
+            return;
+        }
+        layout = new SwiftStackLayout(widget);
+    }
+    layout->configure(axis, spacing, alignment, justify);
+}
+
+void SwiftQWidget::setStackMargins(int left, int top, int right, int bottom) {
+    if (SwiftStackLayout* layout = stackLayoutOf(widget)) {
+        layout->setContentsMargins(left, top, right, bottom);
+    }
+}
+
+bool SwiftQWidget::hasStackLayout() const {
+    return stackLayoutOf(widget) != nullptr;
+}
+
+void SwiftQWidget::addStackChild(SwiftQWidget* child, int grow, int shrink) {
+    SwiftStackLayout* layout = stackLayoutOf(widget);
+    QWidget* childWidget = child ? child->getQWidget() : nullptr;
+    if (layout && childWidget) {
+        layout->addWidgetWithFlex(childWidget, grow, shrink);
+    }
+}
+
+void SwiftQWidget::setStackChildFlex(SwiftQWidget* child, int grow, int shrink) {
+    SwiftStackLayout* layout = stackLayoutOf(widget);
+    if (layout && child && child->getQWidget()) {
+        layout->setFlex(child->getQWidget(), grow, shrink);
+    }
+}
+
+// Keys and widgets of the last setChildren call, in order
+struct SwiftKeyedChildren {
+    std::vector<long long> keys;
+    std::vector<QPointer<QWidget>> widgets;
+};
+
+// Positions in `sources` (ignoring -1) that form a longest strictly increasing subsequence
+static std::vector<bool> longestIncreasingRun(const std::vector<int>& sources) {
+    std::vector<bool> stable(sources.size(), false);
+    std::vector<int> tails;                          // Index into sources of the smallest tail per length
+    std::vector<int> previous(sources.size(), -1);
+    for (int i = 0; i < static_cast<int>(sources.size()); ++i) {
+        if (sources[i] < 0) {
+            continue;
+        }
+        auto it = std::lower_bound(tails.begin(), tails.end(), sources[i], [&sources](int index, int value) {
+            return sources[index] < value;
+        });
+        if (it != tails.begin()) {
+            previous[i] = *(it - 1);
+        }
+        if (it == tails.end()) {
+            tails.push_back(i);
+        } else {
+            *it = i;
+        }
+    }
+    for (int i = tails.empty() ? -1 : tails.back(); i >= 0; i = previous[i]) {
+        stable[i] = true;
+    }
+    return stable;
+}
+
+int SwiftQWidget::setChildren(const long long* keys, SwiftQWidget* const* children, int count) {
+    ensureWidget();
+    if (!widget || count < 0 || (count > 0 && (!keys || !children))) {
+        return 0;
+    }
+    if (!keyedChildren) {
+        keyedChildren = std::make_shared<SwiftKeyedChildren>();
+    }
+    SwiftKeyedChildren& previous = *keyedChildren;
+    
+    std::vector<QWidget*> next(count, nullptr);
+    QSet<QWidget*> nextSet;
+    nextSet.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        next[i] = children[i] ? children[i]->getQWidget() : nullptr;
+        nextSet.insert(next[i]);
+    }
+    
+    // Match keys against the previous list; a key now bound to another widget is a replacement,
+    // and a child that was moved to another parent in the meantime has to be inserted again
+    QHash<long long, int> oldIndex;
+    oldIndex.reserve(static_cast<int>(previous.keys.size()));
+    for (int i = 0; i < static_cast<int>(previous.keys.size()); ++i) {
+        oldIndex.insert(previous.keys[i], i);
+    }
+    std::vector<int> sources(count, -1);
+    for (int i = 0; i < count; ++i) {
+        auto it = oldIndex.constFind(keys[i]);
+        if (it != oldIndex.constEnd() && previous.widgets[it.value()] == next[i] && next[i] &&
+            next[i]->parentWidget() == widget) {
+            sources[i] = it.value();
+        }
+    }
+    const std::vector<bool> stable = longestIncreasingRun(sources);
+    
+    SwiftStackLayout* layout = stackLayoutOf(widget);
+    int operations = 0;
+    const bool suspend = widget->updatesEnabled();
+    if (suspend) {
+        widget->setUpdatesEnabled(false);
+    }
+    
+    // Removals: previous children that are not part of the new list at all
+    for (const QPointer<QWidget>& old : previous.widgets) {
+        if (old && old->parentWidget() == widget && !nextSet.contains(old.data())) {
+            old->hide();
+            old->setParent(nullptr);
+            ++operations;
+        }
+    }
+    
+    // Insertions and moves, back to front so each child can be stacked under its successor
+    QWidget* successor = nullptr;
+    for (int i = count - 1; i >= 0; --i) {
+        QWidget* child = next[i];
+        if (!child) {
+            continue;
+        }
+        if (!stable[i]) {
+            if (child->parentWidget() != widget) {
+                if (layout) {
+                    layout->addWidgetWithFlex(child, 0, 1);
+                } else {
+                    child->setParent(widget);
+                }
+                child->show();
+            }
+            if (successor) {
+                child->stackUnder(successor);
+            } else {
+                child->raise();
+            }
+            ++operations;
+        }
+        successor = child;
+    }
+    
+    if (layout) {
+        layout->reorder(next);
+    }
+    if (suspend) {
+        widget->setUpdatesEnabled(true);
+    }
+    
+    previous.keys.assign(keys, keys + count);
+    previous.widgets.assign(next.begin(), next.end());
+    return operations;
+}
+
+// Mouse moves collected since the last MouseMoveBatch delivery
+struct SwiftMouseBatch {
+    std::vector<QtMouseSample> samples;
+    std::vector<QtMouseSample> delivering;   // Swapped with samples during delivery, so both keep their capacity
+    bool busy = false;
+    std::shared_ptr<SwiftSignalCoalescer> coalescer;
+};
+
+static_assert(static_cast<int>(QtEventType::Custom) < 64, "queued event types are kept in a 64-bit mask");
+
+static void queueEventRecord(long long tag, const QtEventInfo& info, const QEvent* event) {
+    const long long timestamp = event->isInputEvent()
+        ? static_cast<long long>(static_cast<const QInputEvent*>(event)->timestamp()) : 0;
+    SwiftEventRing::push(QtEventRecord{tag, timestamp, static_cast<int>(info.type),
+                                       info.intValue, info.intValue2, info.boolValue ? 1 : 0});
+}
+
+static QtMouseSample mouseSample(const QMouseEvent* event) {
+    const QPoint position = event->position().toPoint();
+    return QtMouseSample{position.x(), position.y(), int(event->buttons()), int(event->modifiers()),
+                         static_cast<long long>(event->timestamp())};
+}
+
+void SwiftQWidget::setupEventFilter() {
+    if (widget && !eventFilter) {
+        // Make the filter a child of the widget so it gets deleted automatically
+        SwiftEventFilter* filter = new SwiftEventFilter(this);
+        filter->setParent(widget);
+        widget->installEventFilter(filter);
+        eventFilter = filter;
+    }
+    registerWrapper();
+}
+
+void SwiftQWidget::registerWrapper() {
+    SwiftWidgetRegistry::attach(widget, this);
+}
+
+bool SwiftQWidget::handleEvent(QEvent* event) {
+    if (!event) return false;
+    
+    QtEventType eventType = QtEventType::Custom;
+    QtEventInfo info = {QtEventType::Custom, 0, 0, nullptr, false, nullptr};
+    
+    // Map Qt events to our event types
+    switch (event->type()) {
+    case QEvent::MouseButtonPress:
+        eventType = QtEventType::MousePress;
+        if (mouseBatch) {
+            mouseBatch->coalescer->flush();
+        }
+        if (auto* mouseEvent = static_cast<QMouseEvent*>(event)) {
+            info.intValue = mouseEvent->button();
+            info.intValue2 = mouseEvent->modifiers();
+        }
+        break;
+    case QEvent::MouseButtonRelease:
+        eventType = QtEventType::MouseRelease;
+        if (mouseBatch) {
+            mouseBatch->coalescer->flush();
+        }
+        if (auto* mouseEvent = static_cast<QMouseEvent*>(event)) {
+            info.intValue = mouseEvent->button();
+            info.intValue2 = mouseEvent->modifiers();
+        }
+        break;
+    case QEvent::MouseMove: {
+        eventType = QtEventType::MouseMove;
+        QtMouseSample sample = mouseSample(static_cast<QMouseEvent*>(event));
+        if (mouseBatch) {
+            mouseBatch->samples.push_back(sample);
+            mouseBatch->coalescer->trigger();
+        }
+        info = {eventType, sample.x, sample.y, nullptr, false, &sample};
+        if (queuedEventTypes & (1ULL << static_cast<int>(eventType))) {
+            queueEventRecord(queueTag, info, event);
+            return false;
+        }
+        auto it = eventCallbacks.find(eventType);
+        if (it == eventCallbacks.end() || !it->second.handler) {
+            return false;
+        }
+        it->second.handler(it->second.context, &info);
+        return true;
+    }
+    case QEvent::MouseButtonDblClick:
+        eventType = QtEventType::MouseDoubleClick;
+        break;
+    case QEvent::Enter:
+        eventType = QtEventType::MouseEnter;
+        break;
+    case QEvent::Leave:
+        eventType = QtEventType::MouseLeave;
+        break;
+    case QEvent::KeyPress:
+        eventType = QtEventType::KeyPress;
+        if (auto* keyEvent = static_cast<QKeyEvent*>(event)) {
+            info.intValue = keyEvent->key();
+            info.intValue2 = keyEvent->modifiers();
+        }
+        break;
+    case QEvent::KeyRelease:
+        eventType = QtEventType::KeyRelease;
+        if (auto* keyEvent = static_cast<QKeyEvent*>(event)) {
+            info.intValue = keyEvent->key();
+            info.intValue2 = keyEvent->modifiers();
+        }
+        break;
+    case QEvent::FocusIn:
+        eventType = QtEventType::FocusIn;
+        break;
+    case QEvent::FocusOut:
+        eventType = QtEventType::FocusOut;
+        break;
+    case QEvent::Show:
+        eventType = QtEventType::Show;
+        break;
+    case QEvent::Hide:
+        eventType = QtEventType::Hide;
+        break;
+    case QEvent::Close:
+        eventType = QtEventType::Close;
+        break;
+    case QEvent::Resize:
+        eventType = QtEventType::Resize;
+        if (auto* resizeEvent = static_cast<QResizeEvent*>(event)) {
+            info.intValue = resizeEvent->size().width();
+            info.intValue2 = resizeEvent->size().height();
+        }
+        if (resizeCoalescer) {
+            // Remember the latest size; the handler runs when the coalescer fires.
+            // The widget itself still processes every resize.
+            pendingWidth = info.intValue;
+            pendingHeight = info.intValue2;
+            resizeCoalescer->trigger();
+            if (resizeSettle) {
+                resizeSettle->trigger();
+            }
+            return false;
+        }
+        info.boolValue = true;
+        break;
+    case QEvent::Move:
+        eventType = QtEventType::Move;
+        if (auto* moveEvent = static_cast<QMoveEvent*>(event)) {
+            info.intValue = moveEvent->pos().x();
+            info.intValue2 = moveEvent->pos().y();
+        }
+        break;
+    case QEvent::Paint:
+        eventType = QtEventType::Paint;
+        break;
+    default:
+        return false;
+    }
+    
+    info.type = eventType;
+    
+    if (queuedEventTypes & (1ULL << static_cast<int>(eventType))) {
+        queueEventRecord(queueTag, info, event);
+        return false;
+    }
+    
+    // Call the handler if registered
+    auto it = eventCallbacks.find(eventType);
+    if (it != eventCallbacks.end() && it->second.handler) {
+        it->second.handler(it->second.context, &info);
+        return true;
+    }
+    
+    return false;
+}
+
+SwiftQWidget::SwiftQWidget() : widget(nullptr), parentWidget(nullptr), ownsWidget(true), eventFilter(nullptr), pendingWidth(0), pendingHeight(0), queuedEventTypes(0), queueTag(0) {
+    SwiftLiveObjects::trackWrapper(this);
+}
+
+SwiftQWidget::SwiftQWidget(SwiftQWidget* parent) : widget(nullptr), parentWidget(parent), ownsWidget(true), eventFilter(nullptr), pendingWidth(0), pendingHeight(0), queuedEventTypes(0), queueTag(0) {
+    SwiftLiveObjects::trackWrapper(this);
+}
+
+SwiftQWidget::SwiftQWidget(QWidget* existingWidget) 
+    : widget(existingWidget), parentWidget(nullptr), ownsWidget(false), eventFilter(nullptr), pendingWidth(0), pendingHeight(0), queuedEventTypes(0), queueTag(0) {
+    SwiftLiveObjects::trackWrapper(this);
+    if (widget) {
+        setupEventFilter();
+    }
+}
+
+SwiftQWidget::SwiftQWidget(const SwiftQWidget& other)
+    : widget(other.widget), parentWidget(other.parentWidget), ownsWidget(false), eventFilter(nullptr), pendingWidth(0), pendingHeight(0), queuedEventTypes(0), queueTag(0) {
+    // Copy constructor creates a shallow copy
+    // The new object doesn't own the widget to prevent double deletion
+    // Don't copy the event filter - each instance manages its own
+    SwiftLiveObjects::trackWrapper(this);
+}
+
+SwiftQWidget& SwiftQWidget::operator=(const SwiftQWidget& other) {
+    if (this != &other) {
+        // Clean up existing widget if we own it
+        if (ownsWidget && widget && !widget->parent()) {
+            delete widget;
+        }
+        
+        SwiftWidgetRegistry::detach(this);
+        
+        // Copy the values
+        widget = other.widget;
+        parentWidget = other.parentWidget;
+        ownsWidget = false; // Copies don't own the widget
+        eventCallbacks = other.eventCallbacks;
+    }
+    return *this;
+}
+
+SwiftQWidget::~SwiftQWidget() {
+    SwiftLiveObjects::untrackWrapper(this);
+    SwiftWidgetRegistry::detach(this);
+    
+    // First, clear event filter to prevent callbacks during destruction
+    if (eventFilter) {
+        eventFilter->clearWidget();
+        eventFilter = nullptr;
+    }
+    
+    clearEventHandlers();
+    
+    // Only delete the widget if we own it AND it doesn't have a parent
+    // If it has a parent, Qt will handle the deletion
+    if (ownsWidget && widget) {
+        // Check if widget is still valid by testing a QObject property
+        // This helps detect if Qt already deleted it
+        try {
+            if (widget->thread() && !widget->parent()) {
+                // Note: We don't use wildcard disconnect() here as it can cause warnings
+                // when Qt is already in the process of destroying the widget
+                // Qt will handle signal disconnection during widget destruction
+                delete widget;
+            }
+        } catch (...) {
+            // Widget was already deleted by Qt, just clear the pointer
+        }
+        // Always clear the pointer
+        widget = nullptr;
+    }
+}
+
+void SwiftQWidget::show() {
+    ensureWidget();
+    if (widget) {
+        widget->show();
+    }
+}
+
+void SwiftQWidget::hide() {
+    if (widget) {
+        widget->hide();
+    }
+}
+
+void SwiftQWidget::setEnabled(bool enabled) {
+    ensureWidget();
+    if (widget) {
+        widget->setEnabled(enabled);
+    }
+}
+
+bool SwiftQWidget::isVisible() const {
+    // Need to ensure widget is created before checking visibility
+    // Cast away const to call ensureWidget (safe because it only creates widget if needed)
+    const_cast<SwiftQWidget*>(this)->ensureWidget();
+    
+    // Check if widget pointer is valid before calling isVisible
+    if (!widget) {
+        return false;
+    }
+    // Also check if the widget is still a valid QObject
+    // This helps detect when Qt has already deleted the widget
+    try {
+        return widget->isVisible();
+    } catch (...) {
+        // Widget was already deleted by Qt
+        return false;
+    }
+}
+
+void SwiftQWidget::resize(int width, int height) {
+    ensureWidget();
+    if (widget) {
+        widget->resize(width, height);
+    }
+}
+
+void SwiftQWidget::move(int x, int y) {
+    ensureWidget();
+    if (widget) {
+        widget->move(x, y);
+    }
+}
+
+void SwiftQWidget::setGeometry(int x, int y, int width, int height) {
+    ensureWidget();
+    if (widget) {
+        widget->setGeometry(x, y, width, height);
+    }
+}
+
+void SwiftQWidget::setWindowTitle(const std::string& title) {
+    ensureWidget();
+    if (widget) {
+        widget->setWindowTitle(QString::fromStdString(title));
+    }
+}
+
+std::string SwiftQWidget::windowTitle() const {
+    // Ensure widget exists before getting title
+    const_cast<SwiftQWidget*>(this)->ensureWidget();
+    if (widget) {
+        return widget->windowTitle().toStdString();
+    }
+    return "";
+}
+
+void SwiftQWidget::setObjectName(const std::string& name) {
+    ensureWidget();
+    if (widget) {
+        widget->setObjectName(QString::fromStdString(name));
+    }
+}
+
+std::string SwiftQWidget::objectName() const {
+    // Ensure widget exists before getting object name
+    const_cast<SwiftQWidget*>(this)->ensureWidget();
+    if (widget) {
+        return widget->objectName().toStdString();
+    }
+    return "";
+}
+
+void SwiftQWidget::setParent(SwiftQWidget* parent) {
+    parentWidget = parent;
+    if (widget && parent && parent->widget) {
+        widget->setParent(parent->widget);
+    }
+}
+
+void SwiftQWidget::deleteWidgetLater() {
+    if (!widget) {
+        return;
+    }
+    QWidget* doomed = widget;
+    SwiftWidgetRegistry::detach(this);
+    if (eventFilter) {
+        eventFilter->clearWidget();
+        eventFilter = nullptr;
+    }
+    widget = nullptr;
+    parentWidget = nullptr;
+    doomed->hide();
+    doomed->setParent(nullptr);
+    doomed->deleteLater();
+}
+
+QWidget* SwiftQWidget::getQWidget() {
+    ensureWidget();
+    return widget;
+}
+
+std::vector<SwiftQWidget*> SwiftQWidget::getChildren() const {
+    std::vector<SwiftQWidget*> children;
+    if (widget) {
+        for (QObject* child : widget->children()) {
+            if (child->isWidgetType()) {
+                children.push_back(SwiftWidgetRegistry::wrapperFor(static_cast<QWidget*>(child)));
+            }
+        }
+    }
+    return children;
+}
+
+int SwiftQWidget::childCount() const {
+    int count = 0;
+    if (widget) {
+        for (QObject* child : widget->children()) {
+            if (child->isWidgetType()) {
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+SwiftQWidget* SwiftQWidget::childAt(int index) const {
+    if (widget && index >= 0) {
+        for (QObject* child : widget->children()) {
+            if (child->isWidgetType() && index-- == 0) {
+                return SwiftWidgetRegistry::wrapperFor(static_cast<QWidget*>(child));
+            }
+        }
+    }
+    return nullptr;
+}
+
+void SwiftQWidget::setAttribute(int attribute, bool on) {
+    ensureWidget();
+    widget->setAttribute(static_cast<Qt::WidgetAttribute>(attribute), on);
+}
+
+void SwiftQWidget::setMinimumSize(int width, int height) {
+    ensureWidget();
+    widget->setMinimumSize(width, height);
+}
+
+void SwiftQWidget::raise() {
+    ensureWidget();
+    widget->raise();
+}
+
+void SwiftQWidget::activateWindow() {
+    ensureWidget();
+    widget->activateWindow();
+}
+
+int SwiftQWidget::width() const {
+    if (widget) {
+        return widget->width();
+    }
+    return 0;
+}
+
+int SwiftQWidget::height() const {
+    if (widget) {
+        return widget->height();
+    }
+    return 0;
+}
+
+void SwiftQWidget::setMaximumSize(int width, int height) {
+    ensureWidget();
+    widget->setMaximumSize(width, height);
+}
+
+void SwiftQWidget::setFixedSize(int width, int height) {
+    ensureWidget();
+    widget->setFixedSize(width, height);
+}
+
+void SwiftQWidget::lower() {
+    ensureWidget();
+    widget->lower();
+}
+
+void SwiftQWidget::showMaximized() {
+    ensureWidget();
+    widget->showMaximized();
+}
+
+void SwiftQWidget::showMinimized() {
+    ensureWidget();
+    widget->showMinimized();
+}
+
+void SwiftQWidget::showFullScreen() {
+    ensureWidget();
+    widget->showFullScreen();
+}
+
+void SwiftQWidget::showNormal() {
+    ensureWidget();
+    widget->showNormal();
+}
+
+bool SwiftQWidget::close() {
+    ensureWidget();
+    return widget->close();
+}
+
+void SwiftQWidget::update() {
+    ensureWidget();
+    widget->update();
+}
+
+int SwiftQWidget::x() const {
+    if (widget) {
+        return widget->x();
+    }
+    return 0;
+}
+
+int SwiftQWidget::y() const {
+    if (widget) {
+        return widget->y();
+    }
+    return 0;
+}
+
+// Identifies an interned palette: the class palette it derives from plus the colors set on it
+struct SwiftPaletteKey {
+    qint64 base;
+    quint64 colors;     // background << 32 | foreground, as QRgb
+    int roles;          // 1 = background set, 2 = foreground set
+    
+    bool operator==(const SwiftPaletteKey& other) const {
+        return base == other.base && colors == other.colors && roles == other.roles;
+    }
+};
+
+static size_t qHash(const SwiftPaletteKey& key, size_t seed = 0) {
+    return qHashMulti(seed, key.base, key.colors, key.roles);
+}
+
+static QHash<SwiftPaletteKey, QPalette>& sharedPalettes() {
+    static QHash<SwiftPaletteKey, QPalette> palettes;
+    return palettes;
+}
+
+// Sets background and/or foreground through an interned palette. Widgets with the same
+// colors share one QPalette (implicitly shared), and a color that is already in place is
+// not set again, so repeated or alternating changes never allocate or repolish.
+static void applyPaletteColors(QWidget* widget, int roles, QRgb background, QRgb foreground) {
+    const QPalette current = widget->palette();
+    const bool hadBackground = current.isBrushSet(QPalette::Active, QPalette::Window) && widget->autoFillBackground();
+    const bool hadForeground = current.isBrushSet(QPalette::Active, QPalette::WindowText);
+    
+    // Keep whichever color the caller did not pass
+    if (!(roles & 1) && hadBackground) {
+        background = current.color(QPalette::Window).rgba();
+        roles |= 1;
+    }
+    if (!(roles & 2) && hadForeground) {
+        foreground = current.color(QPalette::WindowText).rgba();
+        roles |= 2;
+    }
+    if (((roles & 1) != 0) == hadBackground && ((roles & 2) != 0) == hadForeground
+        && (!hadBackground || current.color(QPalette::Window).rgba() == background)
+        && (!hadForeground || current.color(QPalette::WindowText).rgba() == foreground)) {
+        return;
+    }
+    
+    const QPalette base = QApplication::palette(widget);
+    const SwiftPaletteKey key{base.cacheKey(), (quint64(background) << 32) | foreground, roles};
+    QHash<SwiftPaletteKey, QPalette>& palettes = sharedPalettes();
+    auto it = palettes.constFind(key);
+    if (it == palettes.constEnd()) {
+        // Palettes in use stay alive through their widgets; the table only has to bound lookups
+        if (palettes.size() >= 4096) {
+            palettes.clear();
+        }
+        QPalette palette = base;
+        if (roles & 1) {
+            const QColor color = QColor::fromRgba(background);
+            palette.setColor(QPalette::Window, color);
+            palette.setColor(QPalette::Base, color);
+            palette.setColor(QPalette::Button, color);
+        }
+        if (roles & 2) {
+            const QColor color = QColor::fromRgba(foreground);
+            palette.setColor(QPalette::WindowText, color);
+            palette.setColor(QPalette::Text, color);
+            palette.setColor(QPalette::ButtonText, color);
+        }
+        it = palettes.insert(key, palette);
+    }
+    widget->setPalette(it.value());
+    widget->setAutoFillBackground((roles & 1) != 0);
+}
+
+void SwiftQWidget::setBackgroundColor(unsigned int argb) {
+    ensureWidget();
+    if (widget) {
+        applyPaletteColors(widget, 1, argb, 0);
+    }
+}
+
+void SwiftQWidget::setForegroundColor(unsigned int argb) {
+    ensureWidget();
+    if (widget) {
+        applyPaletteColors(widget, 2, 0, argb);
+    }
+}
+
+void SwiftQWidget::clearColors() {
+    ensureWidget();
+    if (widget && widget->palette().resolveMask() != 0) {
+        widget->setPalette(QPalette());
+        widget->setAutoFillBackground(false);
+    }
+}
+
+int SwiftQWidget::sharedPaletteCount() {
+    return static_cast<int>(sharedPalettes().size());
+}
+
+// Resolves a render region against the widget; an empty size means the whole widget
+static QRect renderRegion(QWidget* widget, int x, int y, int width, int height) {
+    return width > 0 && height > 0 ? QRect(x, y, width, height) : widget->rect();
+}
+
+static QSize renderPixels(const QRect& region, double devicePixelRatio) {
+    return QSize(static_cast<int>(std::ceil(region.width() * devicePixelRatio)),
+                 static_cast<int>(std::ceil(region.height() * devicePixelRatio)));
+}
+
+// Renders region into image, which has the pixel size for devicePixelRatio
+static void renderWidgetInto(QWidget* widget, const QRect& region, double devicePixelRatio, QImage& image) {
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+    widget->render(&image, QPoint(), QRegion(region), QWidget::DrawWindowBackground | QWidget::DrawChildren);
+}
+
+static QImage renderWidget(QWidget* widget, const QRect& region, double devicePixelRatio) {
+    QImage image(renderPixels(region, devicePixelRatio), QImage::Format_ARGB32_Premultiplied);
+    if (!image.isNull()) {
+        renderWidgetInto(widget, region, devicePixelRatio, image);
+    }
+    return image;
+}
+
+bool SwiftQWidget::renderPixelSize(double devicePixelRatio, int width, int height, int* pixelWidth, int* pixelHeight) {
+    ensureWidget();
+    if (!widget) {
+        return false;
+    }
+    const QSize size = renderPixels(renderRegion(widget, 0, 0, width, height), devicePixelRatio > 0 ? devicePixelRatio : 1.0);
+    if (pixelWidth) *pixelWidth = size.width();
+    if (pixelHeight) *pixelHeight = size.height();
+    return !size.isEmpty();
+}
+
+bool SwiftQWidget::renderToImage(unsigned char* buffer, int stride, double devicePixelRatio,
+                                 int x, int y, int width, int height) {
+    ensureWidget();
+    if (!widget || !buffer) {
+        return false;
+    }
+    const double ratio = devicePixelRatio > 0 ? devicePixelRatio : 1.0;
+    const QRect region = renderRegion(widget, x, y, width, height);
+    const QSize size = renderPixels(region, ratio);
+    if (size.isEmpty() || stride < size.width() * 4) {
+        return false;
+    }
+    // Paint straight into the caller's buffer rather than copying out of a QImage
+    QImage image(buffer, size.width(), size.height(), stride, QImage::Format_ARGB32_Premultiplied);
+    renderWidgetInto(widget, region, ratio, image);
+    return true;
+}
+
+bool SwiftQWidget::renderToFile(const std::string& path, double devicePixelRatio,
+                                int x, int y, int width, int height) {
+    ensureWidget();
+    if (!widget) {
+        return false;
+    }
+    const QImage image = renderWidget(widget, renderRegion(widget, x, y, width, height), devicePixelRatio > 0 ? devicePixelRatio : 1.0);
+    return !image.isNull() && image.save(QString::fromStdString(path));
+}
+
+void SwiftQWidget::centerOnScreen() {
+    ensureWidget();
+    if (widget && !widget->parent()) {  // Only works for top-level widgets
+        // Get the screen that the widget is on (or primary screen if not shown yet)
+        QScreen* screen = nullptr;
+        if (widget->windowHandle()) {
+            screen = widget->windowHandle()->screen();
+        }
+        if (!screen) {
+            screen = QApplication::primaryScreen();
+        }
+        
+        if (screen) {
+            // Get the available geometry (excludes taskbars, docks, etc.)
+            QRect screenGeometry = screen->availableGeometry();
+            
+            // Calculate the center position
+            int x = (screenGeometry.width() - widget->width()) / 2 + screenGeometry.x();
+            int y = (screenGeometry.height() - widget->height()) / 2 + screenGeometry.y();
+            
+            // Move the widget to the center
+            widget->move(x, y);
+        }
+    }
+}
+
+static int frameIntervalMs(QWidget* widget) {
+    QScreen* screen = widget ? widget->screen() : nullptr;
+    if (!screen) {
+        screen = QGuiApplication::primaryScreen();
+    }
+    const qreal rate = screen ? screen->refreshRate() : 0;
+    return rate > 0 ? qMax(1, qRound(1000.0 / rate)) : 16;
+}
+
+void SwiftQWidget::setResizeCoalescing(int mode, int liveIntervalMs) {
+    ensureWidget();
+    resizeCoalescer.reset();
+    resizeSettle.reset();
+    
+    const int frameMs = frameIntervalMs(widget);
+    if (mode == 1) {
+        resizeCoalescer = std::make_shared<SwiftSignalCoalescer>(frameMs, false, [this]() {
+            deliverResize(true);
+        });
+    } else if (mode == 2) {
+        const int intervalMs = qMax(frameMs, liveIntervalMs);
+        resizeCoalescer = std::make_shared<SwiftSignalCoalescer>(intervalMs, false, [this]() {
+            deliverResize(false);
+        });
+        // Window managers do not report the end of an edge drag, so treat a pause longer
+        // than the live interval as the end and deliver the final size as a full pass
+        resizeSettle = std::make_shared<SwiftSignalCoalescer>(intervalMs + frameMs, true, [this]() {
+            deliverResize(true);
+        });
+    }
+}
+
+void SwiftQWidget::deliverResize(bool final) {
+    auto it = eventCallbacks.find(QtEventType::Resize);
+    if (it == eventCallbacks.end() || !it->second.handler) {
+        return;
+    }
+    SwiftEventCallback callback = it->second;
+    QtEventInfo info = {QtEventType::Resize, pendingWidth, pendingHeight, nullptr, final, nullptr};
+    callback.handler(callback.context, &info);
+}
+
+void SwiftQWidget::setMouseMoveBatchHandler(SwiftEventCallback callback, bool tracking) {
+    ensureWidget();
+    setEventHandler(QtEventType::MouseMoveBatch, callback);
+    if (!mouseBatch) {
+        mouseBatch = std::make_shared<SwiftMouseBatch>();
+        mouseBatch->samples.reserve(64);
+        mouseBatch->coalescer = std::make_shared<SwiftSignalCoalescer>(frameIntervalMs(widget), false, [this]() {
+            deliverMouseBatch();
+        });
+    }
+    if (widget && tracking) {
+        widget->setMouseTracking(true);
+    }
+}
+
+void SwiftQWidget::deliverMouseBatch() {
+    std::shared_ptr<SwiftMouseBatch> batch = mouseBatch;  // The handler may replace it
+    if (!batch || batch->samples.empty()) {
+        return;
+    }
+    if (batch->busy) {
+        // The handler is still reading the other buffer (it spun the event loop); go again later
+        batch->coalescer->trigger();
+        return;
+    }
+    auto it = eventCallbacks.find(QtEventType::MouseMoveBatch);
+    if (it == eventCallbacks.end() || !it->second.handler) {
+        batch->samples.clear();
+        return;
+    }
+    SwiftEventCallback callback = it->second;
+    batch->delivering.swap(batch->samples);
+    batch->busy = true;
+    QtEventInfo info = {QtEventType::MouseMoveBatch, static_cast<int>(batch->delivering.size()), 0, nullptr, false,
+                        batch->delivering.data()};
+    callback.handler(callback.context, &info);
+    batch->busy = false;
+    batch->delivering.clear();
+}
+
+void SwiftQWidget::queueEvents(QtEventType type, long long tag) {
+    queuedEventTypes |= 1ULL << static_cast<int>(type);
+    queueTag = tag;
+}
+
+void SwiftQWidget::unqueueEvents(QtEventType type) {
+    queuedEventTypes &= ~(1ULL << static_cast<int>(type));
+}
+
+void SwiftQWidget::setEventHandler(QtEventType type, SwiftEventCallback callback) {
+    eventCallbacks[type] = callback;
+}
+
+void SwiftQWidget::removeEventHandler(QtEventType type) {
+    eventCallbacks.erase(type);
+}
+
+void SwiftQWidget::clearEventHandlers() {
+    eventCallbacks.clear();
+}
+
+unsigned long long SwiftQWidget::eventSubscriptionMask() const {
+    unsigned long long mask = queuedEventTypes;
+    for (const auto& entry : eventCallbacks) {
+        if (entry.second.handler) {
+            mask |= 1ULL << static_cast<int>(entry.first);
+        }
+    }
+    return mask;
+}
+
+const char* SwiftQWidget::exportUtf8(const QString& text, size_t* length) const {
+    if (!utf8Export) {
+        utf8Export = std::make_shared<QByteArray>();
+    }
+    // Encode straight into the previous allocation rather than a fresh QByteArray per call
+    QByteArray& buffer = *utf8Export;
+    QStringEncoder encoder(QStringEncoder::Utf8);
+    buffer.resize(encoder.requiredSpace(text.size()));
+    char* end = encoder.appendToBuffer(buffer.data(), text);
+    buffer.resize(end - buffer.data());
+    if (length) *length = static_cast<size_t>(buffer.size());
+    return buffer.constData();
+}
+
+// SwiftEventFilter implementation
+bool SwiftEventFilter::eventFilter(QObject* obj, QEvent* event) {
+    // Check if swiftWidget is still valid before accessing it
+    // Also check for destruction events to clean up early
+    if (event && event->type() == QEvent::Destroy) {
+        // Widget is being destroyed, clear our reference
+        if (swiftWidget) {
+            SwiftWidgetRegistry::detach(swiftWidget);
+            swiftWidget->widget = nullptr;
+            swiftWidget->eventFilter = nullptr;
+        }
+        swiftWidget = nullptr;
+        return false;
+    }
+    
+    if (swiftWidget && swiftWidget->widget) {
+        if (swiftWidget->handleEvent(event)) {
+            return true;
+        }
+    }
+    return QObject::eventFilter(obj, event);
+}
+
+// SwiftQLabel implementation
+void SwiftQLabel::ensureWidget() {
+    if (!widget && QApplication::instance()) {
+        QLabel* label = nullptr;
+        if (parentWidget) {
+            label = new QLabel(parentWidget->getQWidget());
+        } else {
+            label = new QLabel(nullptr);
+        }
+        
+        if (!labelText.empty()) {
+            label->setText(QString::fromStdString(labelText));
+        }
+        if (labelAlignment != 0) {
+            label->setAlignment(static_cast<Qt::Alignment>(labelAlignment));
+        }
+        
+        widget = label;
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
+    }
+}
+
+SwiftQLabel::SwiftQLabel() : SwiftQWidget(), labelAlignment(0) {
+}
+
+SwiftQLabel::SwiftQLabel(const std::string& text) 
+    : SwiftQWidget(), labelText(text), labelAlignment(0) {
+}
+
+SwiftQLabel::SwiftQLabel(const std::string& text, SwiftQWidget* parent)
+    : SwiftQWidget(parent), labelText(text), labelAlignment(0) {
+}
+
+void SwiftQLabel::setText(const std::string& text) {
+    labelText = text;
+    ensureWidget();
+    if (widget) {
+        QLabel* label = qobject_cast<QLabel*>(widget);
+        if (label) {
+            label->setText(QString::fromStdString(text));
+        }
+    }
+}
+
+std::string SwiftQLabel::text() const {
+    if (widget) {
+        QLabel* label = qobject_cast<QLabel*>(widget);
+        if (label) {
+            return label->text().toStdString();
+        }
+    }
+    return labelText;
+}
+
+void SwiftQLabel::setText(const char* utf8, size_t length) {
+    ensureWidget();
+    QLabel* label = qobject_cast<QLabel*>(widget);
+    if (!label) {
+        labelText.assign(utf8 ? utf8 : "", utf8 ? length : 0);
+        return;
+    }
+    labelText.clear();
+    label->setText(QString::fromUtf8(utf8, static_cast<qsizetype>(length)));
+}
+
+const char* SwiftQLabel::textUtf8(size_t* length) const {
+    QLabel* label = qobject_cast<QLabel*>(widget);
+    return exportUtf8(label ? label->text() : QString::fromStdString(labelText), length);
+}
+
+void SwiftQLabel::setAlignment(int alignment) {
+    labelAlignment = alignment;
+    ensureWidget();
+    if (widget) {
+        QLabel* label = qobject_cast<QLabel*>(widget);
+        if (label) {
+            label->setAlignment(static_cast<Qt::Alignment>(alignment));
+        }
+    }
+}
+
+bool SwiftQLabel::setPixmap(const std::string& imagePath) {
+    ensureWidget();
+    if (widget) {
+        QLabel* label = qobject_cast<QLabel*>(widget);
+        if (label) {
+            QPixmap pixmap(QString::fromStdString(imagePath));
+            if (!pixmap.isNull()) {
+                label->setPixmap(pixmap);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void SwiftQLabel::setScaledContents(bool scaled) {
+    ensureWidget();
+    if (widget) {
+        QLabel* label = qobject_cast<QLabel*>(widget);
+        if (label) {
+            label->setScaledContents(scaled);
+        }
+    }
+}
+
+void SwiftQLabel::clearPixmap() {
+    ensureWidget();
+    if (widget) {
+        QLabel* label = qobject_cast<QLabel*>(widget);
+        if (label) {
+            label->clear();
+        }
+    }
+}
+
+// SwiftQPushButton implementation
+void SwiftQPushButton::ensureWidget() {
+    if (!widget && QApplication::instance()) {
+        QPushButton* button = nullptr;
+        if (parentWidget) {
+            button = new QPushButton(parentWidget->getQWidget());
+        } else {
+            button = new QPushButton(nullptr);
+        }
+        
+        if (!buttonText.empty()) {
+            button->setText(QString::fromStdString(buttonText));
+        }
+        
+        widget = button;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
+        setupConnections();
+    }
+}
+
+SwiftQPushButton::SwiftQPushButton() : SwiftQWidget() {
+}
+
+SwiftQPushButton::SwiftQPushButton(const std::string& text) 
+    : SwiftQWidget(), buttonText(text) {
+}
+
+SwiftQPushButton::SwiftQPushButton(const std::string& text, SwiftQWidget* parent)
+    : SwiftQWidget(parent), buttonText(text) {
+}
+
+SwiftQPushButton::~SwiftQPushButton() {
+    // Clear stored functions first to prevent callbacks during cleanup
+    clickedFunc = nullptr;
+    pressedFunc = nullptr;
+    releasedFunc = nullptr;
+    toggledFunc = nullptr;
+    
+    // Note: We don't need to manually disconnect signals here.
+    // Qt automatically handles signal disconnection when widgets are destroyed.
+    // Trying to disconnect signals during destruction can cause crashes if
+    // Qt is already in the process of cleaning up the widget hierarchy.
+    // The std::function destructors above ensure our callbacks are cleaned up.
+}
+
+void SwiftQPushButton::setText(const std::string& text) {
+    buttonText = text;
+    ensureWidget();
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button) {
+            button->setText(QString::fromStdString(text));
+        }
+    }
+}
+
+std::string SwiftQPushButton::text() const {
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button) {
+            return button->text().toStdString();
+        }
+    }
+    return buttonText;
+}
+
+void SwiftQPushButton::setText(const char* utf8, size_t length) {
+    ensureWidget();
+    QPushButton* button = qobject_cast<QPushButton*>(widget);
+    if (!button) {
+        buttonText.assign(utf8 ? utf8 : "", utf8 ? length : 0);
+        return;
+    }
+    buttonText.clear();
+    button->setText(QString::fromUtf8(utf8, static_cast<qsizetype>(length)));
+}
+
+const char* SwiftQPushButton::textUtf8(size_t* length) const {
+    QPushButton* button = qobject_cast<QPushButton*>(widget);
+    return exportUtf8(button ? button->text() : QString::fromStdString(buttonText), length);
+}
+
+void SwiftQPushButton::setDefault(bool isDefault) {
+    ensureWidget();
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button) {
+            button->setDefault(isDefault);
+        }
+    }
+}
+
+void SwiftQPushButton::setFlat(bool flat) {
+    ensureWidget();
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button) {
+            button->setFlat(flat);
+        }
+    }
+}
+
+void SwiftQPushButton::setCheckable(bool checkable) {
+    ensureWidget();
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button) {
+            button->setCheckable(checkable);
+        }
+    }
+}
+
+bool SwiftQPushButton::isChecked() const {
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button) {
+            return button->isChecked();
+        }
+    }
+    return false;
+}
+
+void SwiftQPushButton::setChecked(bool checked) {
+    ensureWidget();
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button && button->isCheckable()) {
+            button->setChecked(checked);
+        }
+    }
+}
+
+void SwiftQPushButton::setupConnections() {
+    if (widget) {
+        QPushButton* button = qobject_cast<QPushButton*>(widget);
+        if (button) {
+            // Disconnect existing connections for specific signals
+            QObject::disconnect(button, &QPushButton::clicked, nullptr, nullptr);
+            QObject::disconnect(button, &QPushButton::pressed, nullptr, nullptr);
+            QObject::disconnect(button, &QPushButton::released, nullptr, nullptr);
+            QObject::disconnect(button, &QPushButton::toggled, nullptr, nullptr);
+            
+            // Connect signals to stored functions
+            if (clickedFunc) {
+                QObject::connect(button, &QPushButton::clicked, clickedFunc);
+            }
+            if (pressedFunc) {
+                QObject::connect(button, &QPushButton::pressed, pressedFunc);
+            }
+            if (releasedFunc) {
+                QObject::connect(button, &QPushButton::released, releasedFunc);
+            }
+            if (toggledFunc) {
+                QObject::connect(button, &QPushButton::toggled, toggledFunc);
+            }
+        }
+    }
+}
+
+void SwiftQPushButton::setClickHandler(SwiftCallback callback) {
+    // Legacy support - convert to new system
+    if (callback.handler) {
+        // Capture the callback data in a lambda
+        clickedFunc = [callback]() {
+            if (callback.handler) {
+                callback.handler(callback.context);
+            }
+        };
+    } else {
+        clickedFunc = nullptr;
+    }
+    
+    // Ensure widget exists and reconnect signals
+    ensureWidget();
+    setupConnections();
+}
+
+void SwiftQPushButton::setClickedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        clickedFunc = [callback]() {
+            QtEventInfo info = {QtEventType::Clicked, 0, 0, nullptr, false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        clickedFunc = nullptr;
+    }
+    
+    // Ensure widget exists and reconnect signals
+    ensureWidget();
+    setupConnections();
+}
+
+void SwiftQPushButton::setPressedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        pressedFunc = [callback]() {
+            QtEventInfo info = {QtEventType::Pressed, 0, 0, nullptr, false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        pressedFunc = nullptr;
+    }
+    
+    // Ensure widget exists and reconnect signals
+    ensureWidget();
+    setupConnections();
+}
+
+void SwiftQPushButton::setReleasedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        releasedFunc = [callback]() {
+            QtEventInfo info = {QtEventType::Released, 0, 0, nullptr, false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        releasedFunc = nullptr;
+    }
+    
+    // Ensure widget exists and reconnect signals
+    ensureWidget();
+    setupConnections();
+}
+
+void SwiftQPushButton::setToggledHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        toggledFunc = [callback](bool checked) {
+            QtEventInfo info = {QtEventType::Toggled, 0, 0, nullptr, checked, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        toggledFunc = nullptr;
+    }
+    
+    // Ensure widget exists and reconnect signals
+    ensureWidget();
+    setupConnections();
+}
+
+// SwiftQLineEdit implementation
+void SwiftQLineEdit::ensureWidget() {
+    if (!widget && QApplication::instance()) {
+        QLineEdit* edit = nullptr;
+        if (parentWidget) {
+            edit = new QLineEdit(parentWidget->getQWidget());
+        } else {
+            edit = new QLineEdit(nullptr);
+        }
+        
+        if (!lineText.empty()) {
+            edit->setText(QString::fromStdString(lineText));
+        }
+        if (!placeholderText.empty()) {
+            edit->setPlaceholderText(QString::fromStdString(placeholderText));
+        }
+        
+        widget = edit;
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
+        setupConnections();
+    }
+}
+
+void SwiftQLineEdit::setupConnections() {
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            // Connected once per widget; the lambdas dispatch to whatever handler is current
+            QObject::connect(edit, &QLineEdit::textChanged, [this](const QString&) {
+                if (textChangedCoalescer) {
+                    textChangedCoalescer->trigger();
+                }
+            });
+            QObject::connect(edit, &QLineEdit::returnPressed, [this]() {
+                if (textChangedCoalescer) {
+                    textChangedCoalescer->flush();
+                }
+                if (returnPressedFunc) {
+                    returnPressedFunc();
+                }
+            });
+            QObject::connect(edit, &QLineEdit::editingFinished, [this]() {
+                if (textChangedCoalescer) {
+                    textChangedCoalescer->flush();
+                }
+                if (editingFinishedFunc) {
+                    editingFinishedFunc();
+                }
+            });
+        }
+    }
+}
+
+SwiftQLineEdit::SwiftQLineEdit() : SwiftQWidget() {}
+
+SwiftQLineEdit::SwiftQLineEdit(const std::string& text) 
+    : SwiftQWidget(), lineText(text) {}
+
+SwiftQLineEdit::SwiftQLineEdit(const std::string& text, SwiftQWidget* parent)
+    : SwiftQWidget(parent), lineText(text) {}
+
+SwiftQLineEdit::~SwiftQLineEdit() {
+    // Clear stored functions first to prevent callbacks during cleanup
+    textChangedCoalescer.reset();
+    returnPressedFunc = nullptr;
+    editingFinishedFunc = nullptr;
+}
+
+void SwiftQLineEdit::setText(const std::string& text) {
+    lineText = text;
+    ensureWidget();
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            edit->setText(QString::fromStdString(text));
+        }
+    }
+}
+
+std::string SwiftQLineEdit::text() const {
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            return edit->text().toStdString();
+        }
+    }
+    return lineText;
+}
+
+void SwiftQLineEdit::setText(const char* utf8, size_t length) {
+    ensureWidget();
+    QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+    if (!edit) {
+        lineText.assign(utf8 ? utf8 : "", utf8 ? length : 0);
+        return;
+    }
+    lineText.clear();
+    edit->setText(QString::fromUtf8(utf8, static_cast<qsizetype>(length)));
+}
+
+const char* SwiftQLineEdit::textUtf8(size_t* length) const {
+    QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+    return exportUtf8(edit ? edit->text() : QString::fromStdString(lineText), length);
+}
+
+void SwiftQLineEdit::setPlaceholderText(const std::string& text) {
+    placeholderText = text;
+    ensureWidget();
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            edit->setPlaceholderText(QString::fromStdString(text));
+        }
+    }
+}
+
+std::string SwiftQLineEdit::getPlaceholderText() const {
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            return edit->placeholderText().toStdString();
+        }
+    }
+    return placeholderText;
+}
+
+void SwiftQLineEdit::setMaxLength(int length) {
+    ensureWidget();
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            edit->setMaxLength(length);
+        }
+    }
+}
+
+void SwiftQLineEdit::setReadOnly(bool readOnly) {
+    ensureWidget();
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            edit->setReadOnly(readOnly);
+        }
+    }
+}
+
+void SwiftQLineEdit::clear() {
+    lineText.clear();
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            edit->clear();
+        }
+    }
+}
+
+void SwiftQLineEdit::selectAll() {
+    ensureWidget();
+    if (widget) {
+        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
+        if (edit) {
+            edit->selectAll();
+        }
+    }
+}
+
+void SwiftQLineEdit::setTextChangedHandler(SwiftEventCallback callback, int coalesceMs, bool debounce) {
+    if (callback.handler) {
+        textChangedCoalescer = std::make_shared<SwiftSignalCoalescer>(coalesceMs, debounce, [this, callback]() {
+            // Read the text at delivery time so coalesced bursts report the latest value
+            std::string current = text();
+            QtEventInfo info = {QtEventType::TextChanged, 0, 0, current.c_str(), false, nullptr};
+            callback.handler(callback.context, &info);
+        });
+    } else {
+        textChangedCoalescer.reset();
+    }
+    
+    // Ensure widget exists so the signal connections are in place
+    ensureWidget();
+}
+
+void SwiftQLineEdit::setReturnPressedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        returnPressedFunc = [callback]() {
+            QtEventInfo info = {QtEventType::ReturnPressed, 0, 0, nullptr, false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        returnPressedFunc = nullptr;
+    }
+    
+    ensureWidget();
+}
+
+void SwiftQLineEdit::setEditingFinishedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        editingFinishedFunc = [callback]() {
+            QtEventInfo info = {QtEventType::EditingFinished, 0, 0, nullptr, false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        editingFinishedFunc = nullptr;
+    }
+    
+    ensureWidget();
+}
+
+// SwiftQTextEdit implementation
+void SwiftQTextEdit::ensureWidget() {
     if (!widget && QApplication::instance()) {
+        QTextEdit* edit = nullptr;
         if (parentWidget) {
-            widget = new QWidget(parentWidget->getQWidget());
+            edit = new QTextEdit(parentWidget->getQWidget());
         } else {
-            widget = new QWidget(nullptr);
+            edit = new QTextEdit(nullptr);
+        }
+        
+        widget = edit;
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
+        setupConnections();
+        
+        // Applied after connecting so the initial content counts as the first revision
+        if (!textContent.empty()) {
+            edit->setPlainText(QString::fromStdString(textContent));
         }
-        setupEventFilter();
     }
 }
 
-void SwiftQWidget::setupEventFilter() {
-    if (widget && !eventFilter) {
-        // Make the filter a child of the widget so it gets deleted automatically
-        SwiftEventFilter* filter = new SwiftEventFilter(this);
-        filter->setParent(widget);
-        widget->installEventFilter(filter);
-        eventFilter = filter;
+void SwiftQTextEdit::setupConnections() {
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit && edit->document()) {
+            // Connected exactly once per widget. QTextEdit itself listens to contentsChange,
+            // so we must not use a wildcard disconnect on the document here.
+            QObject::connect(edit->document(), &QTextDocument::contentsChange,
+                [this](int position, int charsRemoved, int charsAdded) {
+                    ++documentRevision;
+                    if (contentsChangeFunc) {
+                        contentsChangeFunc(position, charsRemoved, charsAdded);
+                    }
+                });
+        }
+        if (edit) {
+            QObject::connect(edit, &QTextEdit::textChanged, [this]() {
+                if (textChangedCoalescer) {
+                    textChangedCoalescer->trigger();
+                }
+            });
+        }
     }
 }
 
-bool SwiftQWidget::handleEvent(QEvent* event) {
-    if (!event) return false;
+// Reads [from, from + length) from a document as UTF-16 QString with plain-text newlines
+static QString textDocumentRange(QTextDocument* document, int from, int length) {
+    // characterCount() includes the implicit trailing paragraph separator
+    int end = document->characterCount() - 1;
+    if (from < 0) {
+        from = 0;
+    }
+    if (from >= end || length == 0) {
+        return QString();
+    }
+    int to = (length < 0 || length > end - from) ? end : from + length;
     
-    QtEventType eventType = QtEventType::Custom;
-    QtEventInfo info = {QtEventType::Custom, 0, 0, nullptr, false, nullptr};
+    QTextCursor cursor(document);
+    cursor.setPosition(from);
+    cursor.setPosition(to, QTextCursor::KeepAnchor);
     
-    // Map Qt events to our event types
-    switch (event->type()) {
-    case QEvent::MouseButtonPress:
-        eventType = QtEventType::MousePress;
-        if (auto* mouseEvent = static_cast<QMouseEvent*>(event)) {
-            info.intValue = mouseEvent->button();
-            info.intValue2 = mouseEvent->modifiers();
+    QString text = cursor.selectedText();
+    text.replace(QChar::ParagraphSeparator, QLatin1Char('\n'));
+    text.replace(QChar::LineSeparator, QLatin1Char('\n'));
+    return text;
+}
+
+SwiftQTextEdit::SwiftQTextEdit() : SwiftQWidget(), documentRevision(0), exportedRevision(-1) {}
+
+SwiftQTextEdit::SwiftQTextEdit(const std::string& text) 
+    : SwiftQWidget(), textContent(text), documentRevision(0), exportedRevision(-1) {}
+
+SwiftQTextEdit::SwiftQTextEdit(SwiftQWidget* parent) 
+    : SwiftQWidget(parent), documentRevision(0), exportedRevision(-1) {}
+
+SwiftQTextEdit::~SwiftQTextEdit() {
+    // Clear stored functions first to prevent callbacks during cleanup
+    contentsChangeFunc = nullptr;
+    textChangedCoalescer.reset();
+}
+
+void SwiftQTextEdit::setText(const std::string& text) {
+    setPlainText(text);
+}
+
+std::string SwiftQTextEdit::toPlainText() const {
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            return edit->toPlainText().toStdString();
         }
-        break;
-    case QEvent::MouseButtonRelease:
-        eventType = QtEventType::MouseRelease;
-        if (auto* mouseEvent = static_cast<QMouseEvent*>(event)) {
-            info.intValue = mouseEvent->button();
-            info.intValue2 = mouseEvent->modifiers();
+    }
+    return textContent;
+}
+
+void SwiftQTextEdit::setPlainText(const std::string& text) {
+    textContent = text;
+    ensureWidget();
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            edit->setPlainText(QString::fromStdString(text));
         }
-        break;
-    case QEvent::MouseMove:
-        eventType = QtEventType::MouseMove;
-        break;
-    case QEvent::MouseButtonDblClick:
-        eventType = QtEventType::MouseDoubleClick;
-        break;
-    case QEvent::Enter:
-        eventType = QtEventType::MouseEnter;
-        break;
-    case QEvent::Leave:
-        eventType = QtEventType::MouseLeave;
-        break;
-    case QEvent::KeyPress:
-        eventType = QtEventType::KeyPress;
-        if (auto* keyEvent = static_cast<QKeyEvent*>(event)) {
-            info.intValue = keyEvent->key();
-            info.intValue2 = keyEvent->modifiers();
+    }
+}
+
+void SwiftQTextEdit::setHtml(const std::string& html) {
+    textContent = html;
+    ensureWidget();
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            edit->setHtml(QString::fromStdString(html));
         }
-        break;
-    case QEvent::KeyRelease:
-        eventType = QtEventType::KeyRelease;
-        if (auto* keyEvent = static_cast<QKeyEvent*>(event)) {
-            info.intValue = keyEvent->key();
-            info.intValue2 = keyEvent->modifiers();
+    }
+}
+
+std::string SwiftQTextEdit::toHtml() const {
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            return edit->toHtml().toStdString();
         }
-        break;
-    case QEvent::FocusIn:
-        eventType = QtEventType::FocusIn;
-        break;
-    case QEvent::FocusOut:
-        eventType = QtEventType::FocusOut;
-        break;
-    case QEvent::Show:
-        eventType = QtEventType::Show;
-        break;
-    case QEvent::Hide:
-        eventType = QtEventType::Hide;
-        break;
-    case QEvent::Close:
-        eventType = QtEventType::Close;
-        break;
-    case QEvent::Resize:
-        eventType = QtEventType::Resize;
-        if (auto* resizeEvent = static_cast<QResizeEvent*>(event)) {
-            info.intValue = resizeEvent->size().width();
-            info.intValue2 = resizeEvent->size().height();
+    }
+    return textContent;
+}
+
+void SwiftQTextEdit::setPlainText(const char* utf8, size_t length) {
+    ensureWidget();
+    QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+    if (!edit) {
+        textContent.assign(utf8 ? utf8 : "", utf8 ? length : 0);
+        return;
+    }
+    textContent.clear();
+    edit->setPlainText(QString::fromUtf8(utf8, static_cast<qsizetype>(length)));
+}
+
+void SwiftQTextEdit::setHtml(const char* utf8, size_t length) {
+    ensureWidget();
+    QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+    if (!edit) {
+        textContent.assign(utf8 ? utf8 : "", utf8 ? length : 0);
+        return;
+    }
+    textContent.clear();
+    edit->setHtml(QString::fromUtf8(utf8, static_cast<qsizetype>(length)));
+}
+
+const char* SwiftQTextEdit::toPlainTextUtf8(size_t* length) const {
+    QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+    if (!edit) {
+        exportedRevision = -1;
+        return exportUtf8(QString::fromStdString(textContent), length);
+    }
+    // Every edit bumps the revision, so an unchanged revision means the buffer is current
+    if (exportedRevision == documentRevision && utf8Export) {
+        if (length) *length = static_cast<size_t>(utf8Export->size());
+        return utf8Export->constData();
+    }
+    const char* data = exportUtf8(edit->toPlainText(), length);
+    exportedRevision = documentRevision;
+    return data;
+}
+
+const char* SwiftQTextEdit::toHtmlUtf8(size_t* length) const {
+    QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+    exportedRevision = -1;
+    return exportUtf8(edit ? edit->toHtml() : QString::fromStdString(textContent), length);
+}
+
+void SwiftQTextEdit::clear() {
+    textContent.clear();
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            edit->clear();
         }
-        break;
-    case QEvent::Move:
-        eventType = QtEventType::Move;
-        if (auto* moveEvent = static_cast<QMoveEvent*>(event)) {
-            info.intValue = moveEvent->pos().x();
-            info.intValue2 = moveEvent->pos().y();
+    }
+}
+
+void SwiftQTextEdit::setReadOnly(bool readOnly) {
+    ensureWidget();
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            edit->setReadOnly(readOnly);
+        }
+    }
+}
+
+void SwiftQTextEdit::setPlaceholderText(const std::string& text) {
+    ensureWidget();
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            edit->setPlaceholderText(QString::fromStdString(text));
+        }
+    }
+}
+
+std::string SwiftQTextEdit::placeholderText() const {
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit) {
+            return edit->placeholderText().toStdString();
+        }
+    }
+    return "";
+}
+
+long long SwiftQTextEdit::revision() const {
+    return documentRevision;
+}
+
+int SwiftQTextEdit::characterCount() const {
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit && edit->document()) {
+            return edit->document()->characterCount() - 1;
+        }
+    }
+    return QString::fromStdString(textContent).size();
+}
+
+std::string SwiftQTextEdit::textRange(int from, int length) const {
+    if (widget) {
+        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
+        if (edit && edit->document()) {
+            return textDocumentRange(edit->document(), from, length).toStdString();
         }
-        break;
-    case QEvent::Paint:
-        eventType = QtEventType::Paint;
-        break;
-    default:
-        return false;
+    }
+    // No widget yet - answer from the pending content
+    return QString::fromStdString(textContent).mid(from, length).toStdString();
+}
+
+void SwiftQTextEdit::setContentsChangedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        contentsChangeFunc = [this, callback](int position, int charsRemoved, int charsAdded) {
+            // Only the inserted range is converted, so the cost is O(delta) rather than O(document)
+            std::string added;
+            if (charsAdded > 0) {
+                added = textRange(position, charsAdded);
+            }
+            QtTextDelta delta = {position, charsRemoved, charsAdded, documentRevision,
+                                 added.c_str(), static_cast<int>(added.size())};
+            QtEventInfo info = {QtEventType::ContentsChanged, position, charsRemoved, added.c_str(), false, &delta};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        contentsChangeFunc = nullptr;
     }
     
-    info.type = eventType;
-    
-    // Call the handler if registered
-    auto it = eventCallbacks.find(eventType);
-    if (it != eventCallbacks.end() && it->second.handler) {
-        it->second.handler(it->second.context, &info);
-        return true;
+    // Ensure widget exists so the document connection is in place
+    ensureWidget();
+}
+
+void SwiftQTextEdit::setTextChangedHandler(SwiftEventCallback callback, int coalesceMs, bool debounce) {
+    if (callback.handler) {
+        textChangedCoalescer = std::make_shared<SwiftSignalCoalescer>(coalesceMs, debounce, [this, callback]() {
+            // Serializing the document is O(n), which is exactly why callers should coalesce
+            std::string current = toPlainText();
+            QtEventInfo info = {QtEventType::TextChanged, 0, 0, current.c_str(), false, nullptr};
+            callback.handler(callback.context, &info);
+        });
+    } else {
+        textChangedCoalescer.reset();
     }
     
-    return false;
+    ensureWidget();
 }
 
-SwiftQWidget::SwiftQWidget() : widget(nullptr), parentWidget(nullptr), ownsWidget(true), eventFilter(nullptr) {
+// SwiftQCheckBox implementation
+void SwiftQCheckBox::ensureWidget() {
+    if (!widget && QApplication::instance()) {
+        QCheckBox* box = nullptr;
+        if (parentWidget) {
+            box = new QCheckBox(parentWidget->getQWidget());
+        } else {
+            box = new QCheckBox(nullptr);
+        }
+        
+        if (!checkText.empty()) {
+            box->setText(QString::fromStdString(checkText));
+        }
+        box->setCheckState(static_cast<Qt::CheckState>(checkState));
+        
+        widget = box;
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
+        setupConnections();
+    }
 }
 
-SwiftQWidget::SwiftQWidget(SwiftQWidget* parent) : widget(nullptr), parentWidget(parent), ownsWidget(true), eventFilter(nullptr) {
+void SwiftQCheckBox::setupConnections() {
+    if (widget) {
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+            QObject::connect(box, &QCheckBox::checkStateChanged, [this](Qt::CheckState state) {
+#else
+            QObject::connect(box, &QCheckBox::stateChanged, [this](int state) {
+#endif
+                checkState = static_cast<int>(state);
+                if (stateChangedCoalescer) {
+                    stateChangedCoalescer->trigger();
+                }
+            });
+        }
+    }
 }
 
-SwiftQWidget::SwiftQWidget(QWidget* existingWidget) 
-    : widget(existingWidget), parentWidget(nullptr), ownsWidget(false), eventFilter(nullptr) {
+SwiftQCheckBox::SwiftQCheckBox() : SwiftQWidget(), checkState(0) {}
+
+SwiftQCheckBox::SwiftQCheckBox(const std::string& text) 
+    : SwiftQWidget(), checkText(text), checkState(0) {}
+
+SwiftQCheckBox::SwiftQCheckBox(const std::string& text, SwiftQWidget* parent)
+    : SwiftQWidget(parent), checkText(text), checkState(0) {}
+
+SwiftQCheckBox::~SwiftQCheckBox() {
+    // Clear stored functions first to prevent callbacks during cleanup
+    stateChangedCoalescer.reset();
+}
+
+void SwiftQCheckBox::setText(const std::string& text) {
+    checkText = text;
+    ensureWidget();
     if (widget) {
-        setupEventFilter();
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+            box->setText(QString::fromStdString(text));
+        }
     }
 }
 
-SwiftQWidget::SwiftQWidget(const SwiftQWidget& other)
-    : widget(other.widget), parentWidget(other.parentWidget), ownsWidget(false), eventFilter(nullptr) {
-    // Copy constructor creates a shallow copy
-    // The new object doesn't own the widget to prevent double deletion
-    // Don't copy the event filter - each instance manages its own
+std::string SwiftQCheckBox::text() const {
+    if (widget) {
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+            return box->text().toStdString();
+        }
+    }
+    return checkText;
 }
 
-SwiftQWidget& SwiftQWidget::operator=(const SwiftQWidget& other) {
-    if (this != &other) {
-        // Clean up existing widget if we own it
-        if (ownsWidget && widget && !widget->parent()) {
-            delete widget;
+void SwiftQCheckBox::setChecked(bool checked) {
+    checkState = checked ? 2 : 0;
+    ensureWidget();
+    if (widget) {
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+            box->setChecked(checked);
         }
-        
-        // Copy the values
-        widget = other.widget;
-        parentWidget = other.parentWidget;
-        ownsWidget = false; // Copies don't own the widget
-        eventCallbacks = other.eventCallbacks;
     }
-    return *this;
 }
 
-SwiftQWidget::~SwiftQWidget() {
-    // First, clear event filter to prevent callbacks during destruction
-    if (eventFilter) {
-        eventFilter->clearWidget();
-        eventFilter = nullptr;
+bool SwiftQCheckBox::isChecked() const {
+    if (widget) {
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+            return box->isChecked();
+        }
+    }
+    return checkState == 2;
+}
+
+void SwiftQCheckBox::setTristate(bool tristate) {
+    ensureWidget();
+    if (widget) {
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+            box->setTristate(tristate);
+        }
+    }
+}
+
+void SwiftQCheckBox::setCheckState(int state) {
+    checkState = state;
+    ensureWidget();
+    if (widget) {
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+            box->setCheckState(static_cast<Qt::CheckState>(state));
+        }
+    }
+}
+
+int SwiftQCheckBox::getCheckState() const {
+    if (widget) {
+        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
+        if (box) {
+            return static_cast<int>(box->checkState());
+        }
+    }
+    return checkState;
+}
+
+void SwiftQCheckBox::setStateChangedHandler(SwiftEventCallback callback, int coalesceMs, bool debounce) {
+    if (callback.handler) {
+        stateChangedCoalescer = std::make_shared<SwiftSignalCoalescer>(coalesceMs, debounce, [this, callback]() {
+            int state = getCheckState();
+            QtEventInfo info = {QtEventType::StateChanged, state, 0, nullptr, state == 2, nullptr};
+            callback.handler(callback.context, &info);
+        });
+    } else {
+        stateChangedCoalescer.reset();
     }
     
-    clearEventHandlers();
-    
-    // Only delete the widget if we own it AND it doesn't have a parent
-    // If it has a parent, Qt will handle the deletion
-    if (ownsWidget && widget) {
-        // Check if widget is still valid by testing a QObject property
-        // This helps detect if Qt already deleted it
-        try {
-            if (widget->thread() && !widget->parent()) {
-                // Note: We don't use wildcard disconnect() here as it can cause warnings
-                // when Qt is already in the process of destroying the widget
-                // Qt will handle signal disconnection during widget destruction
-                delete widget;
-            }
-        } catch (...) {
-            // Widget was already deleted by Qt, just clear the pointer
+    ensureWidget();
+}
+
+// SwiftQRadioButton implementation
+void SwiftQRadioButton::ensureWidget() {
+    if (!widget && QApplication::instance()) {
+        QRadioButton* button = nullptr;
+        if (parentWidget) {
+            button = new QRadioButton(parentWidget->getQWidget());
+        } else {
+            button = new QRadioButton(nullptr);
         }
-        // Always clear the pointer
-        widget = nullptr;
+        
+        if (!radioText.empty()) {
+            button->setText(QString::fromStdString(radioText));
+        }
+        button->setChecked(checked);
+        
+        widget = button;
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
     }
 }
 
-void SwiftQWidget::show() {
+SwiftQRadioButton::SwiftQRadioButton() : SwiftQWidget(), checked(false) {}
+
+SwiftQRadioButton::SwiftQRadioButton(const std::string& text) 
+    : SwiftQWidget(), radioText(text), checked(false) {}
+
+SwiftQRadioButton::SwiftQRadioButton(const std::string& text, SwiftQWidget* parent)
+    : SwiftQWidget(parent), radioText(text), checked(false) {}
+
+void SwiftQRadioButton::setText(const std::string& text) {
+    radioText = text;
     ensureWidget();
     if (widget) {
-        widget->show();
+        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
+        if (button) {
+            button->setText(QString::fromStdString(text));
+        }
     }
 }
 
-void SwiftQWidget::hide() {
+std::string SwiftQRadioButton::text() const {
     if (widget) {
-        widget->hide();
+        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
+        if (button) {
+            return button->text().toStdString();
+        }
     }
+    return radioText;
 }
 
-void SwiftQWidget::setEnabled(bool enabled) {
+void SwiftQRadioButton::setChecked(bool isChecked) {
+    checked = isChecked;
     ensureWidget();
     if (widget) {
-        widget->setEnabled(enabled);
+        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
+        if (button) {
+            button->setChecked(isChecked);
+        }
     }
 }
 
-bool SwiftQWidget::isVisible() const {
-    // Need to ensure widget is created before checking visibility
-    // Cast away const to call ensureWidget (safe because it only creates widget if needed)
-    const_cast<SwiftQWidget*>(this)->ensureWidget();
-    
-    // Check if widget pointer is valid before calling isVisible
-    if (!widget) {
-        return false;
+bool SwiftQRadioButton::isChecked() const {
+    if (widget) {
+        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
+        if (button) {
+            return button->isChecked();
+        }
     }
-    // Also check if the widget is still a valid QObject
-    // This helps detect when Qt has already deleted the widget
-    try {
-        return widget->isVisible();
-    } catch (...) {
-        // Widget was already deleted by Qt
-        return false;
+    return checked;
+}
+
+// SwiftQComboBox implementation
+void SwiftQComboBox::ensureWidget() {
+    if (!widget && QApplication::instance()) {
+        QComboBox* combo = nullptr;
+        if (parentWidget) {
+            combo = new QComboBox(parentWidget->getQWidget());
+        } else {
+            combo = new QComboBox(nullptr);
+        }
+        
+        // Replaces (and deletes) the combo box's default QStandardItemModel
+        combo->setModel(model());
+        itemModel->view = combo;
+        if (currentIdx >= 0 && currentIdx < itemModel->size()) {
+            combo->setCurrentIndex(currentIdx);
+        }
+        
+        widget = combo;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
+        setupConnections();
     }
 }
 
-void SwiftQWidget::resize(int width, int height) {
-    ensureWidget();
-    if (widget) {
-        widget->resize(width, height);
-    }
+SwiftQComboBox::SwiftQComboBox() 
+    : SwiftQWidget(), currentIdx(-1), filterMode(0), maxFilterResults(100), filterCompleter(nullptr) {
 }
 
-void SwiftQWidget::move(int x, int y) {
-    ensureWidget();
-    if (widget) {
-        widget->move(x, y);
-    }
+SwiftQComboBox::SwiftQComboBox(SwiftQWidget* parent) 
+    : SwiftQWidget(parent), currentIdx(-1), filterMode(0), maxFilterResults(100), filterCompleter(nullptr) {
 }
 
-void SwiftQWidget::setGeometry(int x, int y, int width, int height) {
-    ensureWidget();
-    if (widget) {
-        widget->setGeometry(x, y, width, height);
+SwiftQComboBox::~SwiftQComboBox() {
+    // Clear stored functions first to prevent callbacks during cleanup
+    indexChangedFunc = nullptr;
+    textChangedFunc = nullptr;
+    activatedFunc = nullptr;
+    editTextChangedFunc = nullptr;
+    
+    // A combo box that outlives this wrapper keeps rendering from the model, so hand
+    // ownership to it; the shared_ptr deleter skips parented models. `widget` may already
+    // dangle if Qt deleted the combo box with its parent, so only the guarded view is used.
+    if (itemModel && itemModel->view && !itemModel->parent()) {
+        itemModel->setParent(itemModel->view);
     }
+    
+    // Note: We don't need to manually disconnect signals here.
+    // Qt automatically handles signal disconnection when widgets are destroyed.
+    // Trying to disconnect signals during destruction can cause crashes if
+    // Qt is already in the process of cleaning up the widget hierarchy.
+    // The std::function destructors above ensure our callbacks are cleaned up.
 }
 
-void SwiftQWidget::setWindowTitle(const std::string& title) {
-    ensureWidget();
-    if (widget) {
-        widget->setWindowTitle(QString::fromStdString(title));
+SwiftStringListModel* SwiftQComboBox::model() {
+    // Created lazily so the temporary Swift copies during initialization never allocate one
+    if (!itemModel) {
+        itemModel = std::shared_ptr<SwiftStringListModel>(new SwiftStringListModel(),
+            [](SwiftStringListModel* model) {
+                if (!model->parent()) {
+                    delete model;
+                }
+            });
     }
+    return itemModel.get();
 }
 
-std::string SwiftQWidget::windowTitle() const {
-    // Ensure widget exists before getting title
-    const_cast<SwiftQWidget*>(this)->ensureWidget();
-    if (widget) {
-        return widget->windowTitle().toStdString();
-    }
-    return "";
+void SwiftQComboBox::addItem(const std::string& text) {
+    SwiftStringListModel* items = model();
+    items->insertText(items->size(), QString::fromStdString(text));
 }
 
-void SwiftQWidget::setObjectName(const std::string& name) {
-    ensureWidget();
-    if (widget) {
-        widget->setObjectName(QString::fromStdString(name));
+void SwiftQComboBox::insertItem(int index, const std::string& text) {
+    SwiftStringListModel* items = model();
+    if (index >= 0 && index <= items->size()) {
+        items->insertText(index, QString::fromStdString(text));
     }
 }
 
-std::string SwiftQWidget::objectName() const {
-    // Ensure widget exists before getting object name
-    const_cast<SwiftQWidget*>(this)->ensureWidget();
-    if (widget) {
-        return widget->objectName().toStdString();
+void SwiftQComboBox::removeItem(int index) {
+    if (itemModel) {
+        itemModel->removeRows(index, 1);
     }
-    return "";
 }
 
-void SwiftQWidget::setParent(SwiftQWidget* parent) {
-    parentWidget = parent;
-    if (widget && parent && parent->widget) {
-        widget->setParent(parent->widget);
+void SwiftQComboBox::clear() {
+    currentIdx = -1;
+    if (itemModel) {
+        itemModel->resetUtf8(nullptr, 0);
     }
 }
 
-QWidget* SwiftQWidget::getQWidget() {
-    ensureWidget();
-    return widget;
+void SwiftQComboBox::setItems(const char* const* items, int count) {
+    currentIdx = -1;
+    model()->resetUtf8(items, count);
 }
 
-std::vector<SwiftQWidget*> SwiftQWidget::getChildren() const {
-    std::vector<SwiftQWidget*> children;
-    if (widget) {
-        // Note: This returns Qt's child widgets, not necessarily SwiftQWidget wrappers
-        // In a real implementation, we'd need to track the SwiftQWidget wrappers
-        // For now, return empty vector
-    }
-    return children;
+void SwiftQComboBox::addItems(const char* const* items, int count) {
+    model()->appendUtf8(items, count);
 }
 
-void SwiftQWidget::setAttribute(int attribute, bool on) {
-    ensureWidget();
-    widget->setAttribute(static_cast<Qt::WidgetAttribute>(attribute), on);
+int SwiftQComboBox::count() const {
+    return itemModel ? itemModel->size() : 0;
 }
 
-void SwiftQWidget::setMinimumSize(int width, int height) {
-    ensureWidget();
-    widget->setMinimumSize(width, height);
+int SwiftQComboBox::currentIndex() const {
+    if (widget) {
+        QComboBox* combo = qobject_cast<QComboBox*>(widget);
+        if (combo) {
+            return combo->currentIndex();
+        }
+    }
+    return currentIdx;
 }
 
-void SwiftQWidget::raise() {
+void SwiftQComboBox::setCurrentIndex(int index) {
+    currentIdx = index;
     ensureWidget();
-    widget->raise();
+    if (widget) {
+        QComboBox* combo = qobject_cast<QComboBox*>(widget);
+        if (combo && index >= 0 && index < combo->count()) {
+            combo->setCurrentIndex(index);
+            // Ensure our cached index is in sync
+            currentIdx = combo->currentIndex();
+        }
+    }
 }
 
-void SwiftQWidget::activateWindow() {
-    ensureWidget();
-    widget->activateWindow();
+std::string SwiftQComboBox::currentText() const {
+    // Reads the model rather than QComboBox::itemText, which goes through Qt's
+    // accessibility machinery and can crash when called during signal emission
+    int idx = currentIndex();
+    if (itemModel && idx >= 0 && idx < itemModel->size()) {
+        return itemModel->textAt(idx).toStdString();
+    }
+    return "";
 }
 
-int SwiftQWidget::width() const {
-    if (widget) {
-        return widget->width();
+std::string SwiftQComboBox::itemText(int index) const {
+    if (itemModel && index >= 0 && index < itemModel->size()) {
+        return itemModel->textAt(index).toStdString();
     }
-    return 0;
+    return "";
 }
 
-int SwiftQWidget::height() const {
+void SwiftQComboBox::setEditable(bool editable) {
+    ensureWidget();
     if (widget) {
-        return widget->height();
+        QComboBox* combo = qobject_cast<QComboBox*>(widget);
+        if (combo) {
+            if (!editable && filterCompleter) {
+                // The line edit the completer is attached to goes away with editability
+                filterCompleter->deleteLater();
+                filterCompleter = nullptr;
+            }
+            combo->setEditable(editable);
+            applyFilterMode();
+        }
     }
-    return 0;
 }
 
-void SwiftQWidget::setMaximumSize(int width, int height) {
-    ensureWidget();
-    widget->setMaximumSize(width, height);
+bool SwiftQComboBox::isEditable() const {
+    if (widget) {
+        QComboBox* combo = qobject_cast<QComboBox*>(widget);
+        if (combo) {
+            return combo->isEditable();
+        }
+    }
+    return false;
 }
 
-void SwiftQWidget::setFixedSize(int width, int height) {
-    ensureWidget();
-    widget->setFixedSize(width, height);
+void SwiftQComboBox::setFilterMode(int mode) {
+    filterMode = (mode < 0 || mode > 2) ? 0 : mode;
+    applyFilterMode();
 }
 
-void SwiftQWidget::lower() {
-    ensureWidget();
-    widget->lower();
+int SwiftQComboBox::getFilterMode() const {
+    return filterMode;
 }
 
-void SwiftQWidget::showMaximized() {
-    ensureWidget();
-    widget->showMaximized();
+void SwiftQComboBox::setMaxFilterResults(int maxResults) {
+    maxFilterResults = maxResults > 0 ? maxResults : 1;
 }
 
-void SwiftQWidget::showMinimized() {
-    ensureWidget();
-    widget->showMinimized();
+int SwiftQComboBox::findItems(const std::string& query, int* outRows, int maxRows) const {
+    if (!itemModel || maxRows <= 0) {
+        return 0;
+    }
+    std::vector<int> matches;
+    itemModel->findMatches(QString::fromStdString(query), filterMode == 2, maxRows, matches);
+    if (outRows) {
+        std::copy(matches.begin(), matches.end(), outRows);
+    }
+    return static_cast<int>(matches.size());
 }
 
-void SwiftQWidget::showFullScreen() {
-    ensureWidget();
-    widget->showFullScreen();
+void SwiftQComboBox::applyFilterMode() {
+    QComboBox* combo = widget ? qobject_cast<QComboBox*>(widget) : nullptr;
+    if (!combo || !combo->isEditable() || !combo->lineEdit()) {
+        return;
+    }
+    QLineEdit* edit = combo->lineEdit();
+    
+    if (filterMode == 0) {
+        if (filterCompleter) {
+            filterCompleter->deleteLater();
+            filterCompleter = nullptr;
+            // Restore the completer QComboBox installs for editable combo boxes
+            QCompleter* completer = new QCompleter(combo->model(), edit);
+            completer->setCaseSensitivity(Qt::CaseInsensitive);
+            completer->setCompletionMode(QCompleter::InlineCompletion);
+            combo->setCompleter(completer);
+        }
+        return;
+    }
+    
+    if (filterCompleter) {
+        return;
+    }
+    
+    // Qt's completer filters by scanning every row of the model on each keystroke. This one
+    // only displays the matches computed from the model's index, so it must not filter again.
+    combo->setCompleter(nullptr);
+    filterCompleter = new QCompleter(combo);
+    filterCompleter->setModel(new QStringListModel(filterCompleter));
+    filterCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    filterCompleter->setWidget(edit);
+    
+    QObject::connect(edit, &QLineEdit::textEdited, filterCompleter, [this](const QString&) {
+        refreshFilter();
+    });
+    QObject::connect(filterCompleter, QOverload<const QModelIndex&>::of(&QCompleter::activated),
+        combo, [this, combo](const QModelIndex& index) {
+            int row = index.row();
+            if (QAbstractProxyModel* proxy = qobject_cast<QAbstractProxyModel*>(filterCompleter->completionModel())) {
+                row = proxy->mapToSource(index).row();
+            }
+            if (row < 0 || row >= static_cast<int>(filterRows.size())) {
+                return;
+            }
+            int source = filterRows[row];
+            combo->setCurrentIndex(source);
+            combo->setEditText(itemModel->textAt(source));
+            // Reported straight to the handler; emitting QComboBox's own signal from outside
+            // would also reach every other receiver of it
+            if (activatedFunc) {
+                activatedFunc(source);
+            }
+        });
 }
 
-void SwiftQWidget::showNormal() {
-    ensureWidget();
-    widget->showNormal();
+void SwiftQComboBox::refreshFilter() {
+    QComboBox* combo = widget ? qobject_cast<QComboBox*>(widget) : nullptr;
+    if (!combo || !filterCompleter || !combo->lineEdit()) {
+        return;
+    }
+    
+    model()->findMatches(combo->lineEdit()->text(), filterMode == 2, maxFilterResults, filterRows);
+    
+    // Copies share the model's string buffers
+    QStringList labels;
+    labels.reserve(static_cast<int>(filterRows.size()));
+    for (int row : filterRows) {
+        labels.append(itemModel->textAt(row));
+    }
+    static_cast<QStringListModel*>(filterCompleter->model())->setStringList(labels);
+    
+    if (labels.isEmpty()) {
+        filterCompleter->popup()->hide();
+    } else {
+        filterCompleter->complete();
+    }
 }
 
-bool SwiftQWidget::close() {
-    ensureWidget();
-    return widget->close();
+void SwiftQComboBox::setupConnections() {
+    if (widget) {
+        QComboBox* combo = qobject_cast<QComboBox*>(widget);
+        if (combo) {
+            // Disconnect existing connections for specific signals
+            typedef void (QComboBox::*IndexSignal)(int);
+            typedef void (QComboBox::*TextSignal)(const QString&);
+            
+            QObject::disconnect(combo, static_cast<IndexSignal>(&QComboBox::currentIndexChanged), nullptr, nullptr);
+            QObject::disconnect(combo, static_cast<TextSignal>(&QComboBox::currentTextChanged), nullptr, nullptr);
+            QObject::disconnect(combo, static_cast<IndexSignal>(&QComboBox::activated), nullptr, nullptr);
+            QObject::disconnect(combo, &QComboBox::editTextChanged, nullptr, nullptr);
+            
+            // Connect signals to stored functions
+            if (indexChangedFunc) {
+                QObject::connect(combo, QOverload<int>::of(&QComboBox::currentIndexChanged), 
+                    [this](int index) {
+                        // Update our cached index when user changes selection
+                        currentIdx = index;
+                        
+                        if (indexChangedFunc) {
+                            indexChangedFunc(index);
+                        }
+                    });
+            }
+            
+            if (textChangedFunc) {
+                QObject::connect(combo, &QComboBox::currentTextChanged,
+                    [this](const QString& text) {
+                        if (textChangedFunc) {
+                            textChangedFunc(text.toStdString());
+                        }
+                    });
+            }
+            
+            if (activatedFunc) {
+                QObject::connect(combo, QOverload<int>::of(&QComboBox::activated),
+                    activatedFunc);
+            }
+            
+            if (editTextChangedFunc) {
+                QObject::connect(combo, &QComboBox::editTextChanged,
+                    [this](const QString& text) {
+                        if (editTextChangedFunc) {
+                            editTextChangedFunc(text.toStdString());
+                        }
+                    });
+            }
+        }
+    }
 }
 
-void SwiftQWidget::update() {
-    ensureWidget();
-    widget->update();
+void SwiftQComboBox::setIndexChangedHandler(SwiftCallbackInt callback) {
+    // Legacy support - convert to new system
+    if (callback.handler) {
+        // Capture the callback data in a lambda
+        indexChangedFunc = [callback](int index) {
+            if (callback.handler) {
+                callback.handler(callback.context, index);
+            }
+        };
+    } else {
+        indexChangedFunc = nullptr;
+    }
+    
+    if (widget) {
+        setupConnections();
+    }
 }
 
-int SwiftQWidget::x() const {
-    if (widget) {
-        return widget->x();
+void SwiftQComboBox::setTextChangedHandler(SwiftCallbackString callback) {
+    // Legacy support - convert to new system
+    if (callback.handler) {
+        // Capture the callback data in a lambda
+        // Note: We need to store the string to ensure it remains valid
+        textChangedFunc = [callback](const std::string& text) {
+            if (callback.handler) {
+                callback.handler(callback.context, text.c_str());
+            }
+        };
+    } else {
+        textChangedFunc = nullptr;
     }
-    return 0;
-}
-
-int SwiftQWidget::y() const {
+    
     if (widget) {
-        return widget->y();
+        setupConnections();
     }
-    return 0;
 }
 
-void SwiftQWidget::centerOnScreen() {
-    ensureWidget();
-    if (widget && !widget->parent()) {  // Only works for top-level widgets
-        // Get the screen that the widget is on (or primary screen if not shown yet)
-        QScreen* screen = nullptr;
-        if (widget->windowHandle()) {
-            screen = widget->windowHandle()->screen();
-        }
-        if (!screen) {
-            screen = QApplication::primaryScreen();
-        }
-        
-        if (screen) {
-            // Get the available geometry (excludes taskbars, docks, etc.)
-            QRect screenGeometry = screen->availableGeometry();
-            
-            // Calculate the center position
-            int x = (screenGeometry.width() - widget->width()) / 2 + screenGeometry.x();
-            int y = (screenGeometry.height() - widget->height()) / 2 + screenGeometry.y();
+void SwiftQComboBox::setCurrentIndexChangedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        indexChangedFunc = [this, callback](int index) {
+            // Read the text from the model to avoid Qt accessibility issues
+            const char* textPtr = nullptr;
+            std::string text;
+            if (itemModel && index >= 0 && index < itemModel->size()) {
+                text = itemModel->textAt(index).toStdString();
+                textPtr = text.c_str();
+            }
             
-            // Move the widget to the center
-            widget->move(x, y);
-        }
+            QtEventInfo info = {QtEventType::CurrentIndexChanged, index, 0, textPtr, false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        indexChangedFunc = nullptr;
+    }
+    
+    if (widget) {
+        setupConnections();
     }
 }
 
-void SwiftQWidget::setEventHandler(QtEventType type, SwiftEventCallback callback) {
-    eventCallbacks[type] = callback;
-}
-
-void SwiftQWidget::removeEventHandler(QtEventType type) {
-    eventCallbacks.erase(type);
+void SwiftQComboBox::setCurrentTextChangedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        // We need to store the string safely
+        textChangedFunc = [callback](const std::string& text) {
+            QtEventInfo info = {QtEventType::CurrentTextChanged, 0, 0, text.c_str(), false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        textChangedFunc = nullptr;
+    }
+    
+    if (widget) {
+        setupConnections();
+    }
 }
 
-void SwiftQWidget::clearEventHandlers() {
-    eventCallbacks.clear();
+void SwiftQComboBox::setActivatedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        activatedFunc = [callback](int index) {
+            QtEventInfo info = {QtEventType::Activated, index, 0, nullptr, false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        activatedFunc = nullptr;
+    }
+    
+    if (widget) {
+        setupConnections();
+    }
 }
 
-// SwiftEventFilter implementation
-bool SwiftEventFilter::eventFilter(QObject* obj, QEvent* event) {
-    // Check if swiftWidget is still valid before accessing it
-    // Also check for destruction events to clean up early
-    if (event && event->type() == QEvent::Destroy) {
-        // Widget is being destroyed, clear our reference
-        if (swiftWidget) {
-            swiftWidget->widget = nullptr;
-            swiftWidget->eventFilter = nullptr;
-        }
-        swiftWidget = nullptr;
-        return false;
+void SwiftQComboBox::setEditTextChangedHandler(SwiftEventCallback callback) {
+    if (callback.handler) {
+        editTextChangedFunc = [callback](const std::string& text) {
+            QtEventInfo info = {QtEventType::TextEdited, 0, 0, text.c_str(), false, nullptr};
+            callback.handler(callback.context, &info);
+        };
+    } else {
+        editTextChangedFunc = nullptr;
     }
     
-    if (swiftWidget && swiftWidget->widget) {
-        if (swiftWidget->handleEvent(event)) {
-            return true;
-        }
+    if (widget) {
+        setupConnections();
     }
-    return QObject::eventFilter(obj, event);
 }
 
-// SwiftQLabel implementation
-void SwiftQLabel::ensureWidget() {
+// SwiftQGroupBox implementation
+void SwiftQGroupBox::ensureWidget() {
     if (!widget && QApplication::instance()) {
-        QLabel* label = nullptr;
+        QGroupBox* group = nullptr;
         if (parentWidget) {
-            label = new QLabel(parentWidget->getQWidget());
+            group = new QGroupBox(parentWidget->getQWidget());
         } else {
-            label = new QLabel(nullptr);
+            group = new QGroupBox(nullptr);
         }
         
-        if (!labelText.empty()) {
-            label->setText(QString::fromStdString(labelText));
-        }
-        if (labelAlignment != 0) {
-            label->setAlignment(static_cast<Qt::Alignment>(labelAlignment));
+        if (!title.empty()) {
+            group->setTitle(QString::fromStdString(title));
         }
         
-        widget = label;
+        widget = group;
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
     }
 }
 
-SwiftQLabel::SwiftQLabel() : SwiftQWidget(), labelAlignment(0) {
-}
+SwiftQGroupBox::SwiftQGroupBox() : SwiftQWidget() {}
 
-SwiftQLabel::SwiftQLabel(const std::string& text) 
-    : SwiftQWidget(), labelText(text), labelAlignment(0) {
-}
+SwiftQGroupBox::SwiftQGroupBox(const std::string& groupTitle) 
+    : SwiftQWidget(), title(groupTitle) {}
 
-SwiftQLabel::SwiftQLabel(const std::string& text, SwiftQWidget* parent)
-    : SwiftQWidget(parent), labelText(text), labelAlignment(0) {
-}
+SwiftQGroupBox::SwiftQGroupBox(const std::string& groupTitle, SwiftQWidget* parent)
+    : SwiftQWidget(parent), title(groupTitle) {}
 
-void SwiftQLabel::setText(const std::string& text) {
-    labelText = text;
+void SwiftQGroupBox::setTitle(const std::string& groupTitle) {
+    title = groupTitle;
     ensureWidget();
     if (widget) {
-        QLabel* label = qobject_cast<QLabel*>(widget);
-        if (label) {
-            label->setText(QString::fromStdString(text));
-        }
-    }
-}
-
-std::string SwiftQLabel::text() const {
-    if (widget) {
-        QLabel* label = qobject_cast<QLabel*>(widget);
-        if (label) {
-            return label->text().toStdString();
+        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
+        if (group) {
+            group->setTitle(QString::fromStdString(groupTitle));
         }
     }
-    return labelText;
 }
 
-void SwiftQLabel::setAlignment(int alignment) {
-    labelAlignment = alignment;
-    ensureWidget();
+std::string SwiftQGroupBox::getTitle() const {
     if (widget) {
-        QLabel* label = qobject_cast<QLabel*>(widget);
-        if (label) {
-            label->setAlignment(static_cast<Qt::Alignment>(alignment));
+        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
+        if (group) {
+            return group->title().toStdString();
         }
     }
+    return title;
 }
 
-bool SwiftQLabel::setPixmap(const std::string& imagePath) {
+void SwiftQGroupBox::setCheckable(bool checkable) {
     ensureWidget();
     if (widget) {
-        QLabel* label = qobject_cast<QLabel*>(widget);
-        if (label) {
-            QPixmap pixmap(QString::fromStdString(imagePath));
-            if (!pixmap.isNull()) {
-                label->setPixmap(pixmap);
-                return true;
-            }
+        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
+        if (group) {
+            group->setCheckable(checkable);
         }
     }
-    return false;
 }
 
-void SwiftQLabel::setScaledContents(bool scaled) {
+void SwiftQGroupBox::setChecked(bool checked) {
     ensureWidget();
     if (widget) {
-        QLabel* label = qobject_cast<QLabel*>(widget);
-        if (label) {
-            label->setScaledContents(scaled);
+        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
+        if (group && group->isCheckable()) {
+            group->setChecked(checked);
         }
     }
 }
 
-void SwiftQLabel::clearPixmap() {
-    ensureWidget();
+bool SwiftQGroupBox::isChecked() const {
     if (widget) {
-        QLabel* label = qobject_cast<QLabel*>(widget);
-        if (label) {
-            label->clear();
+        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
+        if (group && group->isCheckable()) {
+            return group->isChecked();
         }
     }
+    return false;
 }
 
-// SwiftQPushButton implementation
-void SwiftQPushButton::ensureWidget() {
+// SwiftQSlider implementation
+void SwiftQSlider::ensureWidget() {
     if (!widget && QApplication::instance()) {
-        QPushButton* button = nullptr;
+        QSlider* slider = nullptr;
         if (parentWidget) {
-            button = new QPushButton(parentWidget->getQWidget());
+            slider = new QSlider(static_cast<Qt::Orientation>(sliderOrientation), parentWidget->getQWidget());
         } else {
-            button = new QPushButton(nullptr);
+            slider = new QSlider(static_cast<Qt::Orientation>(sliderOrientation));
         }
         
-        if (!buttonText.empty()) {
-            button->setText(QString::fromStdString(buttonText));
+        slider->setMinimum(sliderMin);
+        slider->setMaximum(sliderMax);
+        slider->setValue(sliderValue);
+        
+        widget = slider;
+        ownsWidget = true;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
+        setupConnections();
+    }
+}
+
+void SwiftQSlider::setupConnections() {
+    if (widget) {
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            // Disconnect any existing connections
+            QObject::disconnect(slider, nullptr, nullptr, nullptr);
+            
+            // Set up valueChanged connection
+            if (valueChangedFunc) {
+                QObject::connect(slider, &QSlider::valueChanged, [this](int value) {
+                    if (valueChangedFunc) {
+                        valueChangedFunc(value);
+                    }
+                });
+            }
+            
+            // Set up sliderPressed connection
+            if (sliderPressedFunc) {
+                QObject::connect(slider, &QSlider::sliderPressed, [this]() {
+                    if (sliderPressedFunc) {
+                        sliderPressedFunc();
+                    }
+                });
+            }
+            
+            // Set up sliderReleased connection
+            if (sliderReleasedFunc) {
+                QObject::connect(slider, &QSlider::sliderReleased, [this]() {
+                    if (sliderReleasedFunc) {
+                        sliderReleasedFunc();
+                    }
+                });
+            }
+            
+            // Set up sliderMoved connection
+            if (sliderMovedFunc) {
+                QObject::connect(slider, &QSlider::sliderMoved, [this](int value) {
+                    if (sliderMovedFunc) {
+                        sliderMovedFunc(value);
+                    }
+                });
+            }
         }
-        
-        widget = button;
-        setupEventFilter();
-        setupConnections();
     }
 }
 
-SwiftQPushButton::SwiftQPushButton() : SwiftQWidget() {
+SwiftQSlider::SwiftQSlider()
+    : SwiftQWidget(), sliderValue(0), sliderMin(0), sliderMax(100), sliderOrientation(1) {
 }
 
-SwiftQPushButton::SwiftQPushButton(const std::string& text) 
-    : SwiftQWidget(), buttonText(text) {
+SwiftQSlider::SwiftQSlider(int orientation)
+    : SwiftQWidget(), sliderValue(0), sliderMin(0), sliderMax(100), sliderOrientation(orientation) {
 }
 
-SwiftQPushButton::SwiftQPushButton(const std::string& text, SwiftQWidget* parent)
-    : SwiftQWidget(parent), buttonText(text) {
+SwiftQSlider::SwiftQSlider(int orientation, SwiftQWidget* parent)
+    : SwiftQWidget(parent), sliderValue(0), sliderMin(0), sliderMax(100), sliderOrientation(orientation) {
 }
 
-SwiftQPushButton::~SwiftQPushButton() {
-    // Clear stored functions first to prevent callbacks during cleanup
-    clickedFunc = nullptr;
-    pressedFunc = nullptr;
-    releasedFunc = nullptr;
-    toggledFunc = nullptr;
-    
-    // Note: We don't need to manually disconnect signals here.
-    // Qt automatically handles signal disconnection when widgets are destroyed.
-    // Trying to disconnect signals during destruction can cause crashes if
-    // Qt is already in the process of cleaning up the widget hierarchy.
-    // The std::function destructors above ensure our callbacks are cleaned up.
+SwiftQSlider::~SwiftQSlider() {
+    // Clear callbacks to prevent any dangling references
+    valueChangedFunc = nullptr;
+    sliderPressedFunc = nullptr;
+    sliderReleasedFunc = nullptr;
+    sliderMovedFunc = nullptr;
 }
 
-void SwiftQPushButton::setText(const std::string& text) {
-    buttonText = text;
+void SwiftQSlider::setValue(int value) {
+    sliderValue = value;
     ensureWidget();
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button) {
-            button->setText(QString::fromStdString(text));
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setValue(value);
         }
     }
 }
 
-std::string SwiftQPushButton::text() const {
+int SwiftQSlider::value() const {
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button) {
-            return button->text().toStdString();
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            return slider->value();
         }
     }
-    return buttonText;
+    return sliderValue;
 }
 
-void SwiftQPushButton::setDefault(bool isDefault) {
+void SwiftQSlider::setMinimum(int min) {
+    sliderMin = min;
     ensureWidget();
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button) {
-            button->setDefault(isDefault);
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setMinimum(min);
         }
     }
 }
 
-void SwiftQPushButton::setFlat(bool flat) {
-    ensureWidget();
+int SwiftQSlider::minimum() const {
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button) {
-            button->setFlat(flat);
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            return slider->minimum();
         }
     }
+    return sliderMin;
 }
 
-void SwiftQPushButton::setCheckable(bool checkable) {
+void SwiftQSlider::setMaximum(int max) {
+    sliderMax = max;
     ensureWidget();
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button) {
-            button->setCheckable(checkable);
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setMaximum(max);
         }
     }
 }
 
-bool SwiftQPushButton::isChecked() const {
+int SwiftQSlider::maximum() const {
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button) {
-            return button->isChecked();
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            return slider->maximum();
         }
     }
-    return false;
+    return sliderMax;
 }
 
-void SwiftQPushButton::setChecked(bool checked) {
+void SwiftQSlider::setRange(int min, int max) {
+    sliderMin = min;
+    sliderMax = max;
     ensureWidget();
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button && button->isCheckable()) {
-            button->setChecked(checked);
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setRange(min, max);
         }
     }
 }
 
-void SwiftQPushButton::setupConnections() {
+void SwiftQSlider::setOrientation(int orientation) {
+    sliderOrientation = orientation;
+    ensureWidget();
     if (widget) {
-        QPushButton* button = qobject_cast<QPushButton*>(widget);
-        if (button) {
-            // Disconnect existing connections for specific signals
-            QObject::disconnect(button, &QPushButton::clicked, nullptr, nullptr);
-            QObject::disconnect(button, &QPushButton::pressed, nullptr, nullptr);
-            QObject::disconnect(button, &QPushButton::released, nullptr, nullptr);
-            QObject::disconnect(button, &QPushButton::toggled, nullptr, nullptr);
-            
-            // Connect signals to stored functions
-            if (clickedFunc) {
-                QObject::connect(button, &QPushButton::clicked, clickedFunc);
-            }
-            if (pressedFunc) {
-                QObject::connect(button, &QPushButton::pressed, pressedFunc);
-            }
-            if (releasedFunc) {
-                QObject::connect(button, &QPushButton::released, releasedFunc);
-            }
-            if (toggledFunc) {
-                QObject::connect(button, &QPushButton::toggled, toggledFunc);
-            }
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setOrientation(static_cast<Qt::Orientation>(orientation));
         }
     }
 }
 
-void SwiftQPushButton::setClickHandler(SwiftCallback callback) {
-    // Legacy support - convert to new system
-    if (callback.handler) {
-        // Capture the callback data in a lambda
-        clickedFunc = [callback]() {
-            if (callback.handler) {
-                callback.handler(callback.context);
-            }
-        };
-    } else {
-        clickedFunc = nullptr;
-    }
-    
-    // Ensure widget exists and reconnect signals
-    ensureWidget();
-    setupConnections();
-}
-
-void SwiftQPushButton::setClickedHandler(SwiftEventCallback callback) {
-    if (callback.handler) {
-        clickedFunc = [callback]() {
-            QtEventInfo info = {QtEventType::Clicked, 0, 0, nullptr, false, nullptr};
-            callback.handler(callback.context, &info);
-        };
-    } else {
-        clickedFunc = nullptr;
-    }
-    
-    // Ensure widget exists and reconnect signals
-    ensureWidget();
-    setupConnections();
-}
-
-void SwiftQPushButton::setPressedHandler(SwiftEventCallback callback) {
-    if (callback.handler) {
-        pressedFunc = [callback]() {
-            QtEventInfo info = {QtEventType::Pressed, 0, 0, nullptr, false, nullptr};
-            callback.handler(callback.context, &info);
-        };
-    } else {
-        pressedFunc = nullptr;
-    }
-    
-    // Ensure widget exists and reconnect signals
-    ensureWidget();
-    setupConnections();
-}
-
-void SwiftQPushButton::setReleasedHandler(SwiftEventCallback callback) {
-    if (callback.handler) {
-        releasedFunc = [callback]() {
-            QtEventInfo info = {QtEventType::Released, 0, 0, nullptr, false, nullptr};
-            callback.handler(callback.context, &info);
-        };
-    } else {
-        releasedFunc = nullptr;
+int SwiftQSlider::orientation() const {
+    if (widget) {
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            return static_cast<int>(slider->orientation());
+        }
     }
-    
-    // Ensure widget exists and reconnect signals
-    ensureWidget();
-    setupConnections();
+    return sliderOrientation;
 }
 
-void SwiftQPushButton::setToggledHandler(SwiftEventCallback callback) {
-    if (callback.handler) {
-        toggledFunc = [callback](bool checked) {
-            QtEventInfo info = {QtEventType::Toggled, 0, 0, nullptr, checked, nullptr};
-            callback.handler(callback.context, &info);
-        };
-    } else {
-        toggledFunc = nullptr;
-    }
-    
-    // Ensure widget exists and reconnect signals
+void SwiftQSlider::setTickPosition(int position) {
     ensureWidget();
-    setupConnections();
-}
-
-// SwiftQLineEdit implementation
-void SwiftQLineEdit::ensureWidget() {
-    if (!widget && QApplication::instance()) {
-        QLineEdit* edit = nullptr;
-        if (parentWidget) {
-            edit = new QLineEdit(parentWidget->getQWidget());
-        } else {
-            edit = new QLineEdit(nullptr);
-        }
-        
-        if (!lineText.empty()) {
-            edit->setText(QString::fromStdString(lineText));
-        }
-        if (!placeholderText.empty()) {
-            edit->setPlaceholderText(QString::fromStdString(placeholderText));
+    if (widget) {
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setTickPosition(static_cast<QSlider::TickPosition>(position));
         }
-        
-        widget = edit;
     }
 }
 
-SwiftQLineEdit::SwiftQLineEdit() : SwiftQWidget() {}
-
-SwiftQLineEdit::SwiftQLineEdit(const std::string& text) 
-    : SwiftQWidget(), lineText(text) {}
-
-SwiftQLineEdit::SwiftQLineEdit(const std::string& text, SwiftQWidget* parent)
-    : SwiftQWidget(parent), lineText(text) {}
-
-void SwiftQLineEdit::setText(const std::string& text) {
-    lineText = text;
+void SwiftQSlider::setTickInterval(int interval) {
     ensureWidget();
     if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            edit->setText(QString::fromStdString(text));
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setTickInterval(interval);
         }
     }
 }
 
-std::string SwiftQLineEdit::text() const {
+int SwiftQSlider::tickInterval() const {
     if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            return edit->text().toStdString();
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            return slider->tickInterval();
         }
     }
-    return lineText;
+    return 0;
 }
 
-void SwiftQLineEdit::setPlaceholderText(const std::string& text) {
-    placeholderText = text;
+void SwiftQSlider::setSingleStep(int step) {
     ensureWidget();
     if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            edit->setPlaceholderText(QString::fromStdString(text));
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setSingleStep(step);
         }
     }
 }
 
-std::string SwiftQLineEdit::getPlaceholderText() const {
+int SwiftQSlider::singleStep() const {
     if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            return edit->placeholderText().toStdString();
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            return slider->singleStep();
         }
     }
-    return placeholderText;
+    return 1;
 }
 
-void SwiftQLineEdit::setMaxLength(int length) {
+void SwiftQSlider::setPageStep(int step) {
     ensureWidget();
     if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            edit->setMaxLength(length);
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            slider->setPageStep(step);
         }
     }
 }
 
-void SwiftQLineEdit::setReadOnly(bool readOnly) {
-    ensureWidget();
+int SwiftQSlider::pageStep() const {
     if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            edit->setReadOnly(readOnly);
+        QSlider* slider = qobject_cast<QSlider*>(widget);
+        if (slider) {
+            return slider->pageStep();
         }
     }
+    return 10;
 }
 
-void SwiftQLineEdit::clear() {
-    lineText.clear();
-    if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            edit->clear();
+void SwiftQSlider::setValueChangedHandler(SwiftEventCallback callback) {
+    valueChangedFunc = [callback](int value) {
+        if (callback.handler) {
+            QtEventInfo info;
+            info.type = QtEventType::Custom;
+            info.intValue = value;
+            info.intValue2 = 0;
+            info.stringValue = nullptr;
+            info.boolValue = false;
+            info.customData = nullptr;
+            callback.handler(callback.context, &info);
         }
-    }
+    };
+    setupConnections();
 }
 
-void SwiftQLineEdit::selectAll() {
-    ensureWidget();
-    if (widget) {
-        QLineEdit* edit = qobject_cast<QLineEdit*>(widget);
-        if (edit) {
-            edit->selectAll();
+void SwiftQSlider::setSliderPressedHandler(SwiftEventCallback callback) {
+    sliderPressedFunc = [callback]() {
+        if (callback.handler) {
+            QtEventInfo info;
+            info.type = QtEventType::Pressed;
+            info.intValue = 0;
+            info.intValue2 = 0;
+            info.stringValue = nullptr;
+            info.boolValue = false;
+            info.customData = nullptr;
+            callback.handler(callback.context, &info);
         }
-    }
+    };
+    setupConnections();
 }
 
-// SwiftQTextEdit implementation
-void SwiftQTextEdit::ensureWidget() {
+void SwiftQSlider::setSliderReleasedHandler(SwiftEventCallback callback) {
+    sliderReleasedFunc = [callback]() {
+        if (callback.handler) {
+            QtEventInfo info;
+            info.type = QtEventType::Released;
+            info.intValue = 0;
+            info.intValue2 = 0;
+            info.stringValue = nullptr;
+            info.boolValue = false;
+            info.customData = nullptr;
+            callback.handler(callback.context, &info);
+        }
+    };
+    setupConnections();
+}
+
+void SwiftQSlider::setSliderMovedHandler(SwiftEventCallback callback) {
+    sliderMovedFunc = [callback](int value) {
+        if (callback.handler) {
+            QtEventInfo info;
+            info.type = QtEventType::Move;
+            info.intValue = value;
+            info.intValue2 = 0;
+            info.stringValue = nullptr;
+            info.boolValue = false;
+            info.customData = nullptr;
+            callback.handler(callback.context, &info);
+        }
+    };
+    setupConnections();
+}
+
+// SwiftProgressChannel implementation
+struct SwiftProgressCounter {
+    std::atomic<long long> value{0};
+};
+
+SwiftProgressChannel::SwiftProgressChannel() : counter(std::make_shared<SwiftProgressCounter>()) {
+}
+
+void SwiftProgressChannel::add(long long delta) const {
+    counter->value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+void SwiftProgressChannel::set(long long value) const {
+    counter->value.store(value, std::memory_order_relaxed);
+}
+
+long long SwiftProgressChannel::value() const {
+    return counter->value.load(std::memory_order_relaxed);
+}
+
+static const char* const progressChannelTimerName = "swiftProgressChannel";
+
+static void detachProgressTimer(QWidget* widget) {
+    delete widget->findChild<QTimer*>(QLatin1String(progressChannelTimerName), Qt::FindDirectChildrenOnly);
+}
+
+// Samples a channel on a timer owned by the widget and calls apply when the value moved.
+// Hidden widgets skip the sample and catch up on the first tick after being shown.
+static void attachProgressTimer(QWidget* widget, std::shared_ptr<SwiftProgressCounter> counter, int intervalMs,
+                                std::function<void(long long)> apply) {
+    detachProgressTimer(widget);
+    QTimer* timer = new QTimer(widget);
+    timer->setObjectName(QLatin1String(progressChannelTimerName));
+    timer->setInterval(intervalMs > 0 ? intervalMs : frameIntervalMs(widget));
+    auto last = std::make_shared<long long>(std::numeric_limits<long long>::min());
+    QObject::connect(timer, &QTimer::timeout, widget, [widget, counter, last, apply]() {
+        const long long sample = counter->value.load(std::memory_order_relaxed);
+        if (sample != *last && widget->isVisible()) {
+            *last = sample;
+            apply(sample);
+        }
+    });
+    timer->start();
+}
+
+// SwiftQProgressBar implementation
+void SwiftQProgressBar::ensureWidget() {
     if (!widget && QApplication::instance()) {
-        QTextEdit* edit = nullptr;
+        QProgressBar* progressBar = nullptr;
         if (parentWidget) {
-            edit = new QTextEdit(parentWidget->getQWidget());
+            progressBar = new QProgressBar(parentWidget->getQWidget());
         } else {
-            edit = new QTextEdit(nullptr);
+            progressBar = new QProgressBar(nullptr);
         }
         
-        if (!textContent.empty()) {
-            edit->setPlainText(QString::fromStdString(textContent));
+        progressBar->setMinimum(progressMin);
+        progressBar->setMaximum(progressMax);
+        progressBar->setValue(progressValue);
+        if (!progressFormat.empty()) {
+            progressBar->setFormat(QString::fromStdString(progressFormat));
         }
         
-        widget = edit;
+        widget = progressBar;
+        ownsWidget = true;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
     }
 }
 
-SwiftQTextEdit::SwiftQTextEdit() : SwiftQWidget() {}
-
-SwiftQTextEdit::SwiftQTextEdit(const std::string& text) 
-    : SwiftQWidget(), textContent(text) {}
-
-SwiftQTextEdit::SwiftQTextEdit(SwiftQWidget* parent) 
-    : SwiftQWidget(parent) {}
+SwiftQProgressBar::SwiftQProgressBar()
+    : SwiftQWidget(), progressValue(0), progressMin(0), progressMax(100), progressFormat("%p%") {
+}
 
-void SwiftQTextEdit::setText(const std::string& text) {
-    setPlainText(text);
+SwiftQProgressBar::SwiftQProgressBar(SwiftQWidget* parent)
+    : SwiftQWidget(parent), progressValue(0), progressMin(0), progressMax(100), progressFormat("%p%") {
 }
 
-std::string SwiftQTextEdit::toPlainText() const {
+void SwiftQProgressBar::setValue(int value) {
+    progressValue = value;
+    ensureWidget();
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            return edit->toPlainText().toStdString();
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->setValue(value);
         }
     }
-    return textContent;
 }
 
-void SwiftQTextEdit::setPlainText(const std::string& text) {
-    textContent = text;
-    ensureWidget();
+int SwiftQProgressBar::value() const {
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            edit->setPlainText(QString::fromStdString(text));
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            return progressBar->value();
         }
     }
+    return progressValue;
 }
 
-void SwiftQTextEdit::setHtml(const std::string& html) {
-    textContent = html;
+void SwiftQProgressBar::setMinimum(int min) {
+    progressMin = min;
     ensureWidget();
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            edit->setHtml(QString::fromStdString(html));
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->setMinimum(min);
         }
     }
 }
 
-std::string SwiftQTextEdit::toHtml() const {
+int SwiftQProgressBar::minimum() const {
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            return edit->toHtml().toStdString();
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            return progressBar->minimum();
         }
     }
-    return textContent;
+    return progressMin;
 }
 
-void SwiftQTextEdit::clear() {
-    textContent.clear();
+void SwiftQProgressBar::setMaximum(int max) {
+    progressMax = max;
+    ensureWidget();
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            edit->clear();
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->setMaximum(max);
         }
     }
 }
 
-void SwiftQTextEdit::setReadOnly(bool readOnly) {
-    ensureWidget();
+int SwiftQProgressBar::maximum() const {
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            edit->setReadOnly(readOnly);
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            return progressBar->maximum();
         }
     }
+    return progressMax;
 }
 
-void SwiftQTextEdit::setPlaceholderText(const std::string& text) {
+void SwiftQProgressBar::setRange(int min, int max) {
+    progressMin = min;
+    progressMax = max;
     ensureWidget();
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            edit->setPlaceholderText(QString::fromStdString(text));
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->setRange(min, max);
         }
     }
 }
 
-std::string SwiftQTextEdit::placeholderText() const {
+void SwiftQProgressBar::setTextVisible(bool visible) {
+    ensureWidget();
     if (widget) {
-        QTextEdit* edit = qobject_cast<QTextEdit*>(widget);
-        if (edit) {
-            return edit->placeholderText().toStdString();
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->setTextVisible(visible);
         }
     }
-    return "";
 }
 
-// SwiftQCheckBox implementation
-void SwiftQCheckBox::ensureWidget() {
-    if (!widget && QApplication::instance()) {
-        QCheckBox* box = nullptr;
-        if (parentWidget) {
-            box = new QCheckBox(parentWidget->getQWidget());
-        } else {
-            box = new QCheckBox(nullptr);
-        }
-        
-        if (!checkText.empty()) {
-            box->setText(QString::fromStdString(checkText));
+bool SwiftQProgressBar::isTextVisible() const {
+    if (widget) {
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            return progressBar->isTextVisible();
         }
-        box->setCheckState(static_cast<Qt::CheckState>(checkState));
-        
-        widget = box;
     }
+    return true;
 }
 
-SwiftQCheckBox::SwiftQCheckBox() : SwiftQWidget(), checkState(0) {}
-
-SwiftQCheckBox::SwiftQCheckBox(const std::string& text) 
-    : SwiftQWidget(), checkText(text), checkState(0) {}
-
-SwiftQCheckBox::SwiftQCheckBox(const std::string& text, SwiftQWidget* parent)
-    : SwiftQWidget(parent), checkText(text), checkState(0) {}
-
-void SwiftQCheckBox::setText(const std::string& text) {
-    checkText = text;
+void SwiftQProgressBar::setFormat(const std::string& format) {
+    progressFormat = format;
     ensureWidget();
     if (widget) {
-        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
-        if (box) {
-            box->setText(QString::fromStdString(text));
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->setFormat(QString::fromStdString(format));
         }
     }
 }
 
-std::string SwiftQCheckBox::text() const {
+std::string SwiftQProgressBar::format() const {
     if (widget) {
-        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
-        if (box) {
-            return box->text().toStdString();
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            return progressBar->format().toStdString();
         }
     }
-    return checkText;
+    return progressFormat;
 }
 
-void SwiftQCheckBox::setChecked(bool checked) {
-    checkState = checked ? 2 : 0;
+void SwiftQProgressBar::setOrientation(int orientation) {
     ensureWidget();
     if (widget) {
-        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
-        if (box) {
-            box->setChecked(checked);
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->setOrientation(static_cast<Qt::Orientation>(orientation));
         }
     }
 }
 
-bool SwiftQCheckBox::isChecked() const {
+int SwiftQProgressBar::orientation() const {
     if (widget) {
-        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
-        if (box) {
-            return box->isChecked();
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            return static_cast<int>(progressBar->orientation());
         }
     }
-    return checkState == 2;
+    return 1; // Qt::Horizontal
 }
 
-void SwiftQCheckBox::setTristate(bool tristate) {
+void SwiftQProgressBar::reset() {
+    progressValue = progressMin;
     ensureWidget();
     if (widget) {
-        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
-        if (box) {
-            box->setTristate(tristate);
+        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+        if (progressBar) {
+            progressBar->reset();
         }
     }
 }
 
-void SwiftQCheckBox::setCheckState(int state) {
-    checkState = state;
+void SwiftQProgressBar::attachProgressChannel(const SwiftProgressChannel& channel, int intervalMs) {
     ensureWidget();
-    if (widget) {
-        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
-        if (box) {
-            box->setCheckState(static_cast<Qt::CheckState>(state));
-        }
+    QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
+    if (!progressBar) {
+        return;
     }
+    // What the bar shows for a value; samples mapping to the same state are not applied
+    auto shown = std::make_shared<std::tuple<int, int, int>>(-1, -1, -1);
+    attachProgressTimer(progressBar, channel.shared(), intervalMs, [progressBar, shown](long long sample) {
+        const int minimum = progressBar->minimum(), maximum = progressBar->maximum();
+        const int value = static_cast<int>(std::clamp<long long>(sample, minimum, std::max(minimum, maximum)));
+        const double fraction = maximum > minimum ? double(value - minimum) / (double(maximum) - minimum) : 0.0;
+        const int extent = progressBar->orientation() == Qt::Horizontal ? progressBar->width() : progressBar->height();
+        const bool showsValue = progressBar->isTextVisible() && progressBar->format().contains(QLatin1String("%v"));
+        const std::tuple<int, int, int> state(int(fraction * extent), int(fraction * 100), showsValue ? value : 0);
+        if (state != *shown) {
+            *shown = state;
+            progressBar->setValue(value);
+        }
+    });
 }
 
-int SwiftQCheckBox::getCheckState() const {
+void SwiftQProgressBar::detachProgressChannel() {
     if (widget) {
-        QCheckBox* box = qobject_cast<QCheckBox*>(widget);
-        if (box) {
-            return static_cast<int>(box->checkState());
-        }
+        detachProgressTimer(widget);
     }
-    return checkState;
 }
 
-// SwiftQRadioButton implementation
-void SwiftQRadioButton::ensureWidget() {
+// SwiftQScrollArea implementation
+void SwiftQScrollArea::ensureWidget() {
     if (!widget && QApplication::instance()) {
-        QRadioButton* button = nullptr;
+        QScrollArea* scrollArea = nullptr;
         if (parentWidget) {
-            button = new QRadioButton(parentWidget->getQWidget());
+            scrollArea = new QScrollArea(parentWidget->getQWidget());
         } else {
-            button = new QRadioButton(nullptr);
+            scrollArea = new QScrollArea(nullptr);
         }
         
-        if (!radioText.empty()) {
-            button->setText(QString::fromStdString(radioText));
-        }
-        button->setChecked(checked);
+        scrollArea->setWidgetResizable(true);
         
-        widget = button;
+        widget = scrollArea;
+        ownsWidget = true;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
     }
 }
 
-SwiftQRadioButton::SwiftQRadioButton() : SwiftQWidget(), checked(false) {}
+SwiftQScrollArea::SwiftQScrollArea()
+    : SwiftQWidget(), contentWidget(nullptr), viewportOverscan(0) {
+}
 
-SwiftQRadioButton::SwiftQRadioButton(const std::string& text) 
-    : SwiftQWidget(), radioText(text), checked(false) {}
+SwiftQScrollArea::SwiftQScrollArea(SwiftQWidget* parent)
+    : SwiftQWidget(parent), contentWidget(nullptr), viewportOverscan(0) {
+}
 
-SwiftQRadioButton::SwiftQRadioButton(const std::string& text, SwiftQWidget* parent)
-    : SwiftQWidget(parent), radioText(text), checked(false) {}
+SwiftQScrollArea::~SwiftQScrollArea() {
+    // The content widget will be deleted automatically by Qt
+    contentWidget = nullptr;
+}
 
-void SwiftQRadioButton::setText(const std::string& text) {
-    radioText = text;
+void SwiftQScrollArea::setWidget(SwiftQWidget* widget) {
+    contentWidget = widget;
+    ensureWidget();
+    if (this->widget) {
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(this->widget);
+        if (scrollArea) {
+            if (widget) {
+                scrollArea->setWidget(widget->getQWidget());
+            } else {
+                scrollArea->setWidget(nullptr);
+            }
+        }
+    }
+}
+
+SwiftQWidget* SwiftQScrollArea::getWidget() const {
+    return contentWidget;
+}
+
+void SwiftQScrollArea::setWidgetResizable(bool resizable) {
     ensureWidget();
     if (widget) {
-        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
-        if (button) {
-            button->setText(QString::fromStdString(text));
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            scrollArea->setWidgetResizable(resizable);
         }
     }
 }
 
-std::string SwiftQRadioButton::text() const {
+bool SwiftQScrollArea::widgetResizable() const {
     if (widget) {
-        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
-        if (button) {
-            return button->text().toStdString();
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            return scrollArea->widgetResizable();
         }
     }
-    return radioText;
+    return true;
 }
 
-void SwiftQRadioButton::setChecked(bool isChecked) {
-    checked = isChecked;
+void SwiftQScrollArea::setHorizontalScrollBarPolicy(int policy) {
     ensureWidget();
     if (widget) {
-        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
-        if (button) {
-            button->setChecked(isChecked);
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            scrollArea->setHorizontalScrollBarPolicy(static_cast<Qt::ScrollBarPolicy>(policy));
         }
     }
 }
 
-bool SwiftQRadioButton::isChecked() const {
+void SwiftQScrollArea::setVerticalScrollBarPolicy(int policy) {
+    ensureWidget();
     if (widget) {
-        QRadioButton* button = qobject_cast<QRadioButton*>(widget);
-        if (button) {
-            return button->isChecked();
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            scrollArea->setVerticalScrollBarPolicy(static_cast<Qt::ScrollBarPolicy>(policy));
         }
     }
-    return checked;
 }
 
-// SwiftQComboBox implementation
-void SwiftQComboBox::ensureWidget() {
-    if (!widget && QApplication::instance()) {
-        QComboBox* combo = nullptr;
-        if (parentWidget) {
-            combo = new QComboBox(parentWidget->getQWidget());
-        } else {
-            combo = new QComboBox(nullptr);
-        }
-        
-        for (const auto& item : items) {
-            combo->addItem(QString::fromStdString(item));
-        }
-        if (currentIdx >= 0 && currentIdx < static_cast<int>(items.size())) {
-            combo->setCurrentIndex(currentIdx);
+int SwiftQScrollArea::horizontalScrollBarPolicy() const {
+    if (widget) {
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            return static_cast<int>(scrollArea->horizontalScrollBarPolicy());
         }
-        
-        widget = combo;
-        setupEventFilter();
-        setupConnections();
     }
+    return 0; // Qt::ScrollBarAsNeeded
 }
 
-SwiftQComboBox::SwiftQComboBox() : SwiftQWidget(), currentIdx(-1) {
+int SwiftQScrollArea::verticalScrollBarPolicy() const {
+    if (widget) {
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            return static_cast<int>(scrollArea->verticalScrollBarPolicy());
+        }
+    }
+    return 0; // Qt::ScrollBarAsNeeded
 }
 
-SwiftQComboBox::SwiftQComboBox(SwiftQWidget* parent) 
-    : SwiftQWidget(parent), currentIdx(-1) {
+void SwiftQScrollArea::ensureVisible(int x, int y, int xmargin, int ymargin) {
+    ensureWidget();
+    if (widget) {
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            scrollArea->ensureVisible(x, y, xmargin, ymargin);
+        }
+    }
 }
 
-SwiftQComboBox::~SwiftQComboBox() {
-    // Clear stored functions first to prevent callbacks during cleanup
-    indexChangedFunc = nullptr;
-    textChangedFunc = nullptr;
-    activatedFunc = nullptr;
-    editTextChangedFunc = nullptr;
-    
-    // Note: We don't need to manually disconnect signals here.
-    // Qt automatically handles signal disconnection when widgets are destroyed.
-    // Trying to disconnect signals during destruction can cause crashes if
-    // Qt is already in the process of cleaning up the widget hierarchy.
-    // The std::function destructors above ensure our callbacks are cleaned up.
+void SwiftQScrollArea::ensureWidgetVisible(SwiftQWidget* childWidget, int xmargin, int ymargin) {
+    if (!childWidget) return;
+    ensureWidget();
+    if (widget) {
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea) {
+            QWidget* child = childWidget->getQWidget();
+            if (child) {
+                scrollArea->ensureWidgetVisible(child, xmargin, ymargin);
+            }
+        }
+    }
 }
 
-void SwiftQComboBox::addItem(const std::string& text) {
-    items.push_back(text);
+int SwiftQScrollArea::horizontalScrollValue() const {
     if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo) {
-            combo->addItem(QString::fromStdString(text));
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea && scrollArea->horizontalScrollBar()) {
+            return scrollArea->horizontalScrollBar()->value();
         }
     }
+    return 0;
 }
 
-void SwiftQComboBox::insertItem(int index, const std::string& text) {
-    if (index >= 0 && index <= static_cast<int>(items.size())) {
-        items.insert(items.begin() + index, text);
-        if (widget) {
-            QComboBox* combo = qobject_cast<QComboBox*>(widget);
-            if (combo) {
-                combo->insertItem(index, QString::fromStdString(text));
-            }
+void SwiftQScrollArea::setHorizontalScrollValue(int value) {
+    ensureWidget();
+    if (widget) {
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea && scrollArea->horizontalScrollBar()) {
+            scrollArea->horizontalScrollBar()->setValue(value);
         }
     }
 }
 
-void SwiftQComboBox::removeItem(int index) {
-    if (index >= 0 && index < static_cast<int>(items.size())) {
-        items.erase(items.begin() + index);
-        if (widget) {
-            QComboBox* combo = qobject_cast<QComboBox*>(widget);
-            if (combo) {
-                combo->removeItem(index);
-            }
+int SwiftQScrollArea::verticalScrollValue() const {
+    if (widget) {
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea && scrollArea->verticalScrollBar()) {
+            return scrollArea->verticalScrollBar()->value();
         }
     }
+    return 0;
 }
 
-void SwiftQComboBox::clear() {
-    items.clear();
-    currentIdx = -1;
+void SwiftQScrollArea::setVerticalScrollValue(int value) {
+    ensureWidget();
     if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo) {
-            combo->clear();
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea && scrollArea->verticalScrollBar()) {
+            scrollArea->verticalScrollBar()->setValue(value);
         }
     }
 }
 
-int SwiftQComboBox::count() const {
+int SwiftQScrollArea::horizontalScrollMaximum() const {
     if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo) {
-            return combo->count();
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea && scrollArea->horizontalScrollBar()) {
+            return scrollArea->horizontalScrollBar()->maximum();
         }
     }
-    return static_cast<int>(items.size());
+    return 0;
 }
 
-int SwiftQComboBox::currentIndex() const {
+int SwiftQScrollArea::verticalScrollMaximum() const {
     if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo) {
-            return combo->currentIndex();
+        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+        if (scrollArea && scrollArea->verticalScrollBar()) {
+            return scrollArea->verticalScrollBar()->maximum();
         }
     }
-    return currentIdx;
+    return 0;
 }
 
-void SwiftQComboBox::setCurrentIndex(int index) {
-    currentIdx = index;
-    ensureWidget();
-    if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo && index >= 0 && index < combo->count()) {
-            combo->setCurrentIndex(index);
-            // Ensure our cached index is in sync
-            currentIdx = combo->currentIndex();
-        }
+void SwiftQScrollArea::visibleContentRect(int* x, int* y, int* width, int* height) const {
+    QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+    QRect visible;
+    if (scrollArea) {
+        const QWidget* viewport = scrollArea->viewport();
+        const QWidget* content = scrollArea->widget();
+        const QPoint offset = content ? -content->pos()
+                                      : QPoint(scrollArea->horizontalScrollBar()->value(), scrollArea->verticalScrollBar()->value());
+        visible = QRect(offset, viewport->size());
     }
+    if (x) *x = visible.x();
+    if (y) *y = visible.y();
+    if (width) *width = visible.width();
+    if (height) *height = visible.height();
 }
 
-std::string SwiftQComboBox::currentText() const {
-    // IMPORTANT: This method should NOT be called during Qt signal emission (callbacks)
-    // as it can cause crashes in Qt's accessibility system. Use the cached value instead.
-    
-    // First try to get from our cached items to avoid Qt accessibility issues
-    if (currentIdx >= 0 && currentIdx < static_cast<int>(items.size())) {
-        return items[currentIdx];
+void SwiftQScrollArea::setViewportChangedHandler(SwiftEventCallback callback, int overscan) {
+    ensureWidget();
+    QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
+    if (!scrollArea) {
+        return;
     }
-    
-    // Fallback to Qt widget if we don't have cached data
-    // WARNING: This path can crash if called during signal emission!
-    if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo && combo->count() > 0) {
-            // Check if we're in the middle of signal emission
-            // If so, return empty to avoid crash
-            if (combo->signalsBlocked()) {
-                return "";
-            }
-            
-            // Safely get the text, avoiding potential crashes in callbacks
-            int idx = combo->currentIndex();
-            if (idx >= 0 && idx < combo->count()) {
-                try {
-                    // Temporarily block signals to prevent re-entrancy issues
-                    bool oldState = combo->blockSignals(true);
-                    QString text = combo->itemText(idx);
-                    combo->blockSignals(oldState);
-                    
-                    if (!text.isNull()) {
-                        // Update cache for next time
-                        const_cast<SwiftQComboBox*>(this)->currentIdx = idx;
-                        while (static_cast<int>(const_cast<SwiftQComboBox*>(this)->items.size()) <= idx) {
-                            const_cast<SwiftQComboBox*>(this)->items.push_back("");
-                        }
-                        const_cast<SwiftQComboBox*>(this)->items[idx] = text.toStdString();
-                        return text.toStdString();
-                    }
-                } catch (...) {
-                    // If Qt throws, return empty
-                    return "";
+    setEventHandler(QtEventType::ViewportChanged, callback);
+    viewportOverscan = qMax(0, overscan);
+    if (!viewportCoalescer) {
+        viewportCoalescer = std::make_shared<SwiftSignalCoalescer>(frameIntervalMs(scrollArea), false, [this]() {
+            deliverViewport();
+        });
+        // Scrolling moves the value; content or area size changes move the range
+        for (QScrollBar* bar : {scrollArea->horizontalScrollBar(), scrollArea->verticalScrollBar()}) {
+            QObject::connect(bar, &QScrollBar::valueChanged, [this](int) {
+                if (viewportCoalescer) {
+                    viewportCoalescer->trigger();
                 }
-            }
+            });
+            QObject::connect(bar, &QScrollBar::rangeChanged, [this](int, int) {
+                if (viewportCoalescer) {
+                    viewportCoalescer->trigger();
+                }
+            });
         }
     }
-    return "";
+    deliverViewport();
 }
 
-std::string SwiftQComboBox::itemText(int index) const {
-    if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo && index >= 0 && index < combo->count()) {
-            return combo->itemText(index).toStdString();
-        }
+void SwiftQScrollArea::flushViewportChanged() {
+    if (viewportCoalescer) {
+        viewportCoalescer->flush();
     }
-    if (index >= 0 && index < static_cast<int>(items.size())) {
-        return items[index];
+}
+
+bool SwiftQScrollArea::handleEvent(QEvent* event) {
+    if (event->type() == QEvent::Resize && viewportCoalescer) {
+        viewportCoalescer->trigger();
     }
-    return "";
+    return SwiftQWidget::handleEvent(event);
 }
 
-void SwiftQComboBox::setEditable(bool editable) {
+void SwiftQScrollArea::deliverViewport() {
+    auto it = eventCallbacks.find(QtEventType::ViewportChanged);
+    if (it == eventCallbacks.end() || !it->second.handler) {
+        return;
+    }
+    SwiftEventCallback callback = it->second;
+    QtViewportRect rect = {0, 0, 0, 0, viewportOverscan};
+    visibleContentRect(&rect.x, &rect.y, &rect.width, &rect.height);
+    QtEventInfo info = {QtEventType::ViewportChanged, rect.x, rect.y, nullptr, false, &rect};
+    callback.handler(callback.context, &info);
+}
+
+// SwiftQTabWidget implementation
+void SwiftQTabWidget::ensureWidget() {
+    if (!widget) {
+        widget = new QTabWidget();
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
+    }
+    if (!tabWidget) {
+        tabWidget = qobject_cast<QTabWidget*>(widget);
+    }
+}
+
+SwiftQTabWidget::SwiftQTabWidget() 
+    : SwiftQWidget(), tabWidget(nullptr), nextLazyTabId(1), activationCount(0), 
+      evictAfterActivations(0), connected(false) {
     ensureWidget();
-    if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo) {
-            combo->setEditable(editable);
+}
+
+SwiftQTabWidget::SwiftQTabWidget(SwiftQWidget* parent) 
+    : SwiftQWidget(parent), tabWidget(nullptr), nextLazyTabId(1), activationCount(0), 
+      evictAfterActivations(0), connected(false) {
+    ensureWidget();
+}
+
+void SwiftQTabWidget::setupConnections() {
+    // Connected on first use rather than in the constructor: Swift copies the
+    // constructed value, so `this` there belongs to a temporary
+    ensureWidget();
+    if (connected || !tabWidget) {
+        return;
+    }
+    connected = true;
+    QObject::connect(tabWidget, &QTabWidget::currentChanged, tabWidget, [this](int index) {
+        handleCurrentChanged(index);
+    });
+}
+
+void SwiftQTabWidget::handleCurrentChanged(int index) {
+    ++activationCount;
+    QWidget* current = tabWidget ? tabWidget->widget(index) : nullptr;
+    for (LazyTab& tab : lazyTabs) {
+        if (tab.placeholder != current) {
+            continue;
         }
+        tab.lastActivation = activationCount;
+        if (!tab.page && tab.factory.handler) {
+            // Copy: the factory may add or remove tabs and reallocate lazyTabs
+            SwiftEventCallback factory = tab.factory;
+            QtEventInfo info = {QtEventType::PageRequested, tab.id, index, nullptr, false, nullptr};
+            factory.handler(factory.context, &info);
+        }
+        break;
+    }
+    
+    evictIdleTabs();
+    
+    std::function<void(int)> fn = currentChangedFunc;
+    if (fn) {
+        fn(index);
     }
 }
 
-bool SwiftQComboBox::isEditable() const {
-    if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo) {
-            return combo->isEditable();
+void SwiftQTabWidget::evictIdleTabs() {
+    if (evictAfterActivations <= 0 || !tabWidget) {
+        return;
+    }
+    QWidget* current = tabWidget->currentWidget();
+    for (size_t i = 0; i < lazyTabs.size(); ++i) {
+        LazyTab& tab = lazyTabs[i];
+        if (!tab.page || tab.placeholder == current ||
+            activationCount - tab.lastActivation <= evictAfterActivations) {
+            continue;
+        }
+        QWidget* page = tab.page;
+        SwiftEventCallback factory = tab.factory;
+        QtEventInfo info = {QtEventType::PageEvicted, tab.id, tabWidget->indexOf(tab.placeholder), 
+                            nullptr, false, nullptr};
+        tab.page = nullptr;
+        
+        // The page is still alive here so the owner can save its state
+        if (factory.handler) {
+            factory.handler(factory.context, &info);
         }
+        releaseLazyTab(page);
     }
-    return false;
 }
 
-void SwiftQComboBox::setupConnections() {
-    if (widget) {
-        QComboBox* combo = qobject_cast<QComboBox*>(widget);
-        if (combo) {
-            // Disconnect existing connections for specific signals
-            typedef void (QComboBox::*IndexSignal)(int);
-            typedef void (QComboBox::*TextSignal)(const QString&);
-            
-            QObject::disconnect(combo, static_cast<IndexSignal>(&QComboBox::currentIndexChanged), nullptr, nullptr);
-            QObject::disconnect(combo, static_cast<TextSignal>(&QComboBox::currentTextChanged), nullptr, nullptr);
-            QObject::disconnect(combo, static_cast<IndexSignal>(&QComboBox::activated), nullptr, nullptr);
-            QObject::disconnect(combo, &QComboBox::editTextChanged, nullptr, nullptr);
-            
-            // Connect signals to stored functions
-            if (indexChangedFunc) {
-                QObject::connect(combo, QOverload<int>::of(&QComboBox::currentIndexChanged), 
-                    [this, combo](int index) {
-                        // Update our cached index when user changes selection
-                        currentIdx = index;
-                        
-                        // Cache the text BEFORE calling the handler to avoid Qt accessibility crashes
-                        // This prevents issues when accessing Qt properties during signal emission
-                        if (index >= 0 && index < static_cast<int>(items.size())) {
-                            // We already have the text cached, no need to query Qt
-                        } else if (index >= 0 && combo && index < combo->count()) {
-                            // If we don't have it cached, get it now before the callback
-                            try {
-                                QString qtText = combo->itemText(index);
-                                if (!qtText.isNull()) {
-                                    // Ensure our items vector is large enough
-                                    while (static_cast<int>(items.size()) <= index) {
-                                        items.push_back("");
-                                    }
-                                    items[index] = qtText.toStdString();
-                                }
-                            } catch (...) {
-                                // Ignore any exceptions during text retrieval
-                            }
-                        }
-                        
-                        if (indexChangedFunc) {
-                            indexChangedFunc(index);
-                        }
-                    });
-            }
-            
-            if (textChangedFunc) {
-                QObject::connect(combo, &QComboBox::currentTextChanged,
-                    [this](const QString& text) {
-                        if (textChangedFunc) {
-                            textChangedFunc(text.toStdString());
-                        }
-                    });
-            }
-            
-            if (activatedFunc) {
-                QObject::connect(combo, QOverload<int>::of(&QComboBox::activated),
-                    activatedFunc);
-            }
-            
-            if (editTextChangedFunc) {
-                QObject::connect(combo, &QComboBox::editTextChanged,
-                    [this](const QString& text) {
-                        if (editTextChangedFunc) {
-                            editTextChangedFunc(text.toStdString());
-                        }
-                    });
-            }
+void SwiftQTabWidget::releaseLazyTab(QWidget* page) {
+    // Stays parented until deleted, so a Swift wrapper released in the meantime
+    // leaves it alone
+    page->hide();
+    if (QWidget* placeholder = page->parentWidget()) {
+        if (placeholder->layout()) {
+            placeholder->layout()->removeWidget(page);
         }
     }
+    page->deleteLater();
 }
 
-void SwiftQComboBox::setIndexChangedHandler(SwiftCallbackInt callback) {
-    // Legacy support - convert to new system
-    if (callback.handler) {
-        // Capture the callback data in a lambda
-        indexChangedFunc = [callback](int index) {
-            if (callback.handler) {
-                callback.handler(callback.context, index);
-            }
-        };
-    } else {
-        indexChangedFunc = nullptr;
+int SwiftQTabWidget::addLazyTab(const std::string& label, SwiftEventCallback factory) {
+    setupConnections();
+    if (!tabWidget) {
+        return -1;
     }
+    QWidget* placeholder = new QWidget();
+    SwiftLiveObjects::trackWidget(placeholder);
+    QVBoxLayout* layout = new QVBoxLayout(placeholder);
+    layout->setContentsMargins(0, 0, 0, 0);
     
-    if (widget) {
-        setupConnections();
+    LazyTab tab = {nextLazyTabId++, placeholder, nullptr, factory, activationCount};
+    lazyTabs.push_back(tab);
+    
+    // Adding the first tab makes it current, which requests its page right away
+    tabWidget->addTab(placeholder, QString::fromStdString(label));
+    return tab.id;
+}
+
+void SwiftQTabWidget::setLazyTabPage(int tabId, SwiftQWidget* page) {
+    QWidget* content = page ? page->getQWidget() : nullptr;
+    if (!content) {
+        return;
+    }
+    for (LazyTab& tab : lazyTabs) {
+        if (tab.id != tabId) {
+            continue;
+        }
+        if (tab.page == content) {
+            return;
+        }
+        if (tab.page) {
+            releaseLazyTab(tab.page);
+        }
+        tab.page = content;
+        tab.placeholder->layout()->addWidget(content);
+        content->show();
+        return;
     }
 }
 
-void SwiftQComboBox::setTextChangedHandler(SwiftCallbackString callback) {
-    // Legacy support - convert to new system
-    if (callback.handler) {
-        // Capture the callback data in a lambda
-        // Note: We need to store the string to ensure it remains valid
-        textChangedFunc = [callback](const std::string& text) {
-            if (callback.handler) {
-                callback.handler(callback.context, text.c_str());
-            }
-        };
-    } else {
-        textChangedFunc = nullptr;
+int SwiftQTabWidget::lazyTabIndex(int tabId) const {
+    for (const LazyTab& tab : lazyTabs) {
+        if (tab.id == tabId) {
+            return tabWidget ? tabWidget->indexOf(tab.placeholder) : -1;
+        }
     }
-    
-    if (widget) {
-        setupConnections();
+    return -1;
+}
+
+bool SwiftQTabWidget::isLazyTabMaterialized(int tabId) const {
+    for (const LazyTab& tab : lazyTabs) {
+        if (tab.id == tabId) {
+            return tab.page != nullptr;
+        }
     }
+    return false;
 }
 
-void SwiftQComboBox::setCurrentIndexChangedHandler(SwiftEventCallback callback) {
+void SwiftQTabWidget::setLazyTabEviction(int maxIdleActivations) {
+    evictAfterActivations = maxIdleActivations > 0 ? maxIdleActivations : 0;
+}
+
+void SwiftQTabWidget::setCurrentChangedHandler(SwiftEventCallback callback) {
     if (callback.handler) {
-        indexChangedFunc = [this, callback](int index) {
-            // Get the text from our cache to avoid Qt accessibility issues
-            const char* textPtr = nullptr;
-            std::string text;
-            if (index >= 0 && index < static_cast<int>(items.size())) {
-                text = items[index];
-                textPtr = text.c_str();
-            }
-            
-            QtEventInfo info = {QtEventType::CurrentIndexChanged, index, 0, textPtr, false, nullptr};
+        currentChangedFunc = [callback](int index) {
+            QtEventInfo info = {QtEventType::CurrentIndexChanged, index, 0, nullptr, false, nullptr};
             callback.handler(callback.context, &info);
         };
     } else {
-        indexChangedFunc = nullptr;
+        currentChangedFunc = nullptr;
     }
-    
-    if (widget) {
-        setupConnections();
+    setupConnections();
+}
+
+SwiftQTabWidget::~SwiftQTabWidget() {
+    // Widget is deleted by base class
+}
+
+int SwiftQTabWidget::addTab(SwiftQWidget* widget, const std::string& label) {
+    ensureWidget();
+    if (tabWidget && widget && widget->getQWidget()) {
+        return tabWidget->addTab(widget->getQWidget(), QString::fromStdString(label));
     }
+    return -1;
 }
 
-void SwiftQComboBox::setCurrentTextChangedHandler(SwiftEventCallback callback) {
-    if (callback.handler) {
-        // We need to store the string safely
-        textChangedFunc = [callback](const std::string& text) {
-            QtEventInfo info = {QtEventType::CurrentTextChanged, 0, 0, text.c_str(), false, nullptr};
-            callback.handler(callback.context, &info);
-        };
-    } else {
-        textChangedFunc = nullptr;
+int SwiftQTabWidget::insertTab(int index, SwiftQWidget* widget, const std::string& label) {
+    ensureWidget();
+    if (tabWidget && widget && widget->getQWidget()) {
+        return tabWidget->insertTab(index, widget->getQWidget(), QString::fromStdString(label));
     }
-    
-    if (widget) {
-        setupConnections();
+    return -1;
+}
+
+void SwiftQTabWidget::removeTab(int index) {
+    ensureWidget();
+    if (tabWidget) {
+        QWidget* page = tabWidget->widget(index);
+        bool lazy = false;
+        for (auto it = lazyTabs.begin(); page && it != lazyTabs.end(); ++it) {
+            if (it->placeholder == page) {
+                // Forget the tab before QTabWidget::removeTab: the currentChanged it emits runs
+                // factories and eviction, and this tab's factory context is being released
+                lazyTabs.erase(it);
+                lazy = true;
+                break;
+            }
+        }
+        tabWidget->removeTab(index);
+        if (lazy) {
+            // Placeholders belong to the tab widget; take the materialized page with them
+            page->deleteLater();
+        }
     }
 }
 
-void SwiftQComboBox::setActivatedHandler(SwiftEventCallback callback) {
-    if (callback.handler) {
-        activatedFunc = [callback](int index) {
-            QtEventInfo info = {QtEventType::Activated, index, 0, nullptr, false, nullptr};
-            callback.handler(callback.context, &info);
-        };
-    } else {
-        activatedFunc = nullptr;
-    }
-    
-    if (widget) {
-        setupConnections();
+void SwiftQTabWidget::setTabText(int index, const std::string& text) {
+    ensureWidget();
+    if (tabWidget) {
+        tabWidget->setTabText(index, QString::fromStdString(text));
     }
 }
 
-void SwiftQComboBox::setEditTextChangedHandler(SwiftEventCallback callback) {
-    if (callback.handler) {
-        editTextChangedFunc = [callback](const std::string& text) {
-            QtEventInfo info = {QtEventType::TextEdited, 0, 0, text.c_str(), false, nullptr};
-            callback.handler(callback.context, &info);
-        };
-    } else {
-        editTextChangedFunc = nullptr;
+std::string SwiftQTabWidget::tabText(int index) const {
+    if (tabWidget) {
+        return tabWidget->tabText(index).toStdString();
     }
-    
-    if (widget) {
-        setupConnections();
+    return "";
+}
+
+void SwiftQTabWidget::setTabEnabled(int index, bool enabled) {
+    ensureWidget();
+    if (tabWidget) {
+        tabWidget->setTabEnabled(index, enabled);
     }
 }
 
-// SwiftQGroupBox implementation
-void SwiftQGroupBox::ensureWidget() {
-    if (!widget && QApplication::instance()) {
-        QGroupBox* group = nullptr;
-        if (parentWidget) {
-            group = new QGroupBox(parentWidget->getQWidget());
-        } else {
-            group = new QGroupBox(nullptr);
-        }
-        
-        if (!title.empty()) {
-            group->setTitle(QString::fromStdString(title));
-        }
-        
-        widget = group;
+bool SwiftQTabWidget::isTabEnabled(int index) const {
+    if (tabWidget) {
+        return tabWidget->isTabEnabled(index);
     }
+    return false;
 }
 
-SwiftQGroupBox::SwiftQGroupBox() : SwiftQWidget() {}
+int SwiftQTabWidget::currentIndex() const {
+    if (tabWidget) {
+        return tabWidget->currentIndex();
+    }
+    return -1;
+}
 
-SwiftQGroupBox::SwiftQGroupBox(const std::string& groupTitle) 
-    : SwiftQWidget(), title(groupTitle) {}
+void SwiftQTabWidget::setCurrentIndex(int index) {
+    ensureWidget();
+    if (tabWidget) {
+        tabWidget->setCurrentIndex(index);
+    }
+}
 
-SwiftQGroupBox::SwiftQGroupBox(const std::string& groupTitle, SwiftQWidget* parent)
-    : SwiftQWidget(parent), title(groupTitle) {}
+SwiftQWidget* SwiftQTabWidget::currentWidget() const {
+    // This would require maintaining a mapping of QWidget* to SwiftQWidget*
+    // For now, returning nullptr
+    return nullptr;
+}
 
-void SwiftQGroupBox::setTitle(const std::string& groupTitle) {
-    title = groupTitle;
+void SwiftQTabWidget::setCurrentWidget(SwiftQWidget* widget) {
     ensureWidget();
-    if (widget) {
-        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
-        if (group) {
-            group->setTitle(QString::fromStdString(groupTitle));
-        }
+    if (tabWidget && widget && widget->getQWidget()) {
+        tabWidget->setCurrentWidget(widget->getQWidget());
     }
 }
 
-std::string SwiftQGroupBox::getTitle() const {
-    if (widget) {
-        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
-        if (group) {
-            return group->title().toStdString();
-        }
+int SwiftQTabWidget::count() const {
+    if (tabWidget) {
+        return tabWidget->count();
     }
-    return title;
+    return 0;
 }
 
-void SwiftQGroupBox::setCheckable(bool checkable) {
+void SwiftQTabWidget::clear() {
     ensureWidget();
-    if (widget) {
-        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
-        if (group) {
-            group->setCheckable(checkable);
+    if (tabWidget) {
+        std::vector<LazyTab> removed;
+        removed.swap(lazyTabs);
+        tabWidget->clear();
+        for (const LazyTab& tab : removed) {
+            tab.placeholder->deleteLater();
         }
     }
 }
 
-void SwiftQGroupBox::setChecked(bool checked) {
+void SwiftQTabWidget::setTabPosition(int position) {
     ensureWidget();
-    if (widget) {
-        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
-        if (group && group->isCheckable()) {
-            group->setChecked(checked);
-        }
+    if (tabWidget) {
+        tabWidget->setTabPosition(static_cast<QTabWidget::TabPosition>(position));
     }
 }
 
-bool SwiftQGroupBox::isChecked() const {
-    if (widget) {
-        QGroupBox* group = qobject_cast<QGroupBox*>(widget);
-        if (group && group->isCheckable()) {
-            return group->isChecked();
-        }
+int SwiftQTabWidget::tabPosition() const {
+    if (tabWidget) {
+        return static_cast<int>(tabWidget->tabPosition());
     }
-    return false;
+    return 0;
 }
 
-// SwiftQSlider implementation
-void SwiftQSlider::ensureWidget() {
-    if (!widget && QApplication::instance()) {
-        QSlider* slider = nullptr;
-        if (parentWidget) {
-            slider = new QSlider(static_cast<Qt::Orientation>(sliderOrientation), parentWidget->getQWidget());
-        } else {
-            slider = new QSlider(static_cast<Qt::Orientation>(sliderOrientation));
-        }
-        
-        slider->setMinimum(sliderMin);
-        slider->setMaximum(sliderMax);
-        slider->setValue(sliderValue);
-        
-        widget = slider;
-        ownsWidget = true;
-        setupEventFilter();
-        setupConnections();
+void SwiftQTabWidget::setMovable(bool movable) {
+    ensureWidget();
+    if (tabWidget) {
+        tabWidget->setMovable(movable);
     }
 }
 
-void SwiftQSlider::setupConnections() {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            // Disconnect any existing connections
-            QObject::disconnect(slider, nullptr, nullptr, nullptr);
-            
-            // Set up valueChanged connection
-            if (valueChangedFunc) {
-                QObject::connect(slider, &QSlider::valueChanged, [this](int value) {
-                    if (valueChangedFunc) {
-                        valueChangedFunc(value);
-                    }
-                });
-            }
-            
-            // Set up sliderPressed connection
-            if (sliderPressedFunc) {
-                QObject::connect(slider, &QSlider::sliderPressed, [this]() {
-                    if (sliderPressedFunc) {
-                        sliderPressedFunc();
-                    }
-                });
-            }
-            
-            // Set up sliderReleased connection
-            if (sliderReleasedFunc) {
-                QObject::connect(slider, &QSlider::sliderReleased, [this]() {
-                    if (sliderReleasedFunc) {
-                        sliderReleasedFunc();
-                    }
-                });
-            }
-            
-            // Set up sliderMoved connection
-            if (sliderMovedFunc) {
-                QObject::connect(slider, &QSlider::sliderMoved, [this](int value) {
-                    if (sliderMovedFunc) {
-                        sliderMovedFunc(value);
-                    }
-                });
-            }
-        }
+bool SwiftQTabWidget::isMovable() const {
+    if (tabWidget) {
+        return tabWidget->isMovable();
     }
+    return false;
 }
 
-SwiftQSlider::SwiftQSlider()
-    : SwiftQWidget(), sliderValue(0), sliderMin(0), sliderMax(100), sliderOrientation(1) {
+void SwiftQTabWidget::setTabBarAutoHide(bool hide) {
+    ensureWidget();
+    if (tabWidget) {
+        tabWidget->setTabsClosable(hide); // Using closable as a similar feature
+    }
 }
 
-SwiftQSlider::SwiftQSlider(int orientation)
-    : SwiftQWidget(), sliderValue(0), sliderMin(0), sliderMax(100), sliderOrientation(orientation) {
+bool SwiftQTabWidget::tabBarAutoHide() const {
+    if (tabWidget) {
+        return tabWidget->tabsClosable();
+    }
+    return false;
 }
 
-SwiftQSlider::SwiftQSlider(int orientation, SwiftQWidget* parent)
-    : SwiftQWidget(parent), sliderValue(0), sliderMin(0), sliderMax(100), sliderOrientation(orientation) {
+// SwiftQSplitter implementation
+void SwiftQSplitter::ensureWidget() {
+    if (!SwiftQWidget::widget) {
+        SwiftQWidget::widget = new QSplitter();
+        SwiftLiveObjects::trackWidget(SwiftQWidget::widget);
+        registerWrapper();
+    }
+    if (!splitter) {
+        splitter = qobject_cast<QSplitter*>(SwiftQWidget::widget);
+    }
 }
 
-SwiftQSlider::~SwiftQSlider() {
-    // Clear callbacks to prevent any dangling references
-    valueChangedFunc = nullptr;
-    sliderPressedFunc = nullptr;
-    sliderReleasedFunc = nullptr;
-    sliderMovedFunc = nullptr;
+SwiftQSplitter::SwiftQSplitter() : SwiftQWidget(), splitter(nullptr) {
+    ensureWidget();
 }
 
-void SwiftQSlider::setValue(int value) {
-    sliderValue = value;
+SwiftQSplitter::SwiftQSplitter(int orientation) : SwiftQWidget(), splitter(nullptr) {
+    SwiftQWidget::widget = new QSplitter(static_cast<Qt::Orientation>(orientation));
+    SwiftLiveObjects::trackWidget(SwiftQWidget::widget);
+    splitter = qobject_cast<QSplitter*>(SwiftQWidget::widget);
+}
+
+SwiftQSplitter::SwiftQSplitter(SwiftQWidget* parent) : SwiftQWidget(parent), splitter(nullptr) {
     ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setValue(value);
-        }
-    }
 }
 
-int SwiftQSlider::value() const {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            return slider->value();
-        }
-    }
-    return sliderValue;
+SwiftQSplitter::SwiftQSplitter(int orientation, SwiftQWidget* parent) : SwiftQWidget(parent), splitter(nullptr) {
+    SwiftQWidget::widget = new QSplitter(static_cast<Qt::Orientation>(orientation), parent ? parent->getQWidget() : nullptr);
+    SwiftLiveObjects::trackWidget(SwiftQWidget::widget);
+    splitter = qobject_cast<QSplitter*>(SwiftQWidget::widget);
 }
 
-void SwiftQSlider::setMinimum(int min) {
-    sliderMin = min;
-    ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setMinimum(min);
-        }
-    }
+SwiftQSplitter::~SwiftQSplitter() {
+    // Widget is deleted by base class
 }
 
-int SwiftQSlider::minimum() const {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            return slider->minimum();
-        }
+void SwiftQSplitter::addWidget(SwiftQWidget* widget) {
+    ensureWidget();
+    if (splitter && widget && widget->getQWidget()) {
+        splitter->addWidget(widget->getQWidget());
     }
-    return sliderMin;
 }
 
-void SwiftQSlider::setMaximum(int max) {
-    sliderMax = max;
+void SwiftQSplitter::insertWidget(int index, SwiftQWidget* widget) {
     ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setMaximum(max);
-        }
+    if (splitter && widget && widget->getQWidget()) {
+        splitter->insertWidget(index, widget->getQWidget());
     }
 }
 
-int SwiftQSlider::maximum() const {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            return slider->maximum();
-        }
+int SwiftQSplitter::count() const {
+    if (splitter) {
+        return splitter->count();
     }
-    return sliderMax;
+    return 0;
 }
 
-void SwiftQSlider::setRange(int min, int max) {
-    sliderMin = min;
-    sliderMax = max;
-    ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setRange(min, max);
-        }
+SwiftQWidget* SwiftQSplitter::widget(int index) const {
+    // This would require maintaining a mapping of QWidget* to SwiftQWidget*
+    // For now, returning nullptr
+    return nullptr;
+}
+
+int SwiftQSplitter::indexOf(SwiftQWidget* widget) const {
+    if (splitter && widget && widget->getQWidget()) {
+        return splitter->indexOf(widget->getQWidget());
     }
+    return -1;
 }
 
-void SwiftQSlider::setOrientation(int orientation) {
-    sliderOrientation = orientation;
+void SwiftQSplitter::setOrientation(int orientation) {
     ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setOrientation(static_cast<Qt::Orientation>(orientation));
-        }
+    if (splitter) {
+        splitter->setOrientation(static_cast<Qt::Orientation>(orientation));
     }
 }
 
-int SwiftQSlider::orientation() const {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            return static_cast<int>(slider->orientation());
-        }
+int SwiftQSplitter::orientation() const {
+    if (splitter) {
+        return static_cast<int>(splitter->orientation());
     }
-    return sliderOrientation;
+    return 1; // Horizontal
 }
 
-void SwiftQSlider::setTickPosition(int position) {
+void SwiftQSplitter::setSizes(const std::vector<int>& sizes) {
     ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setTickPosition(static_cast<QSlider::TickPosition>(position));
+    if (splitter) {
+        QList<int> qsizes;
+        for (int size : sizes) {
+            qsizes.append(size);
         }
+        splitter->setSizes(qsizes);
     }
 }
 
-void SwiftQSlider::setTickInterval(int interval) {
+void SwiftQSplitter::setSizesArray(const int* sizes, int count) {
     ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setTickInterval(interval);
+    if (splitter && sizes && count > 0) {
+        QList<int> qsizes;
+        for (int i = 0; i < count; ++i) {
+            qsizes.append(sizes[i]);
         }
+        splitter->setSizes(qsizes);
     }
 }
 
-int SwiftQSlider::tickInterval() const {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            return slider->tickInterval();
+std::vector<int> SwiftQSplitter::sizes() const {
+    std::vector<int> result;
+    if (splitter) {
+        QList<int> qsizes = splitter->sizes();
+        for (int size : qsizes) {
+            result.push_back(size);
         }
     }
-    return 0;
+    return result;
 }
 
-void SwiftQSlider::setSingleStep(int step) {
-    ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setSingleStep(step);
+int SwiftQSplitter::getSizeAt(int index) const {
+    if (splitter) {
+        QList<int> qsizes = splitter->sizes();
+        if (index >= 0 && index < qsizes.size()) {
+            return qsizes[index];
         }
     }
+    return 0;
 }
 
-int SwiftQSlider::singleStep() const {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            return slider->singleStep();
-        }
+int SwiftQSplitter::sizesCount() const {
+    if (splitter) {
+        return splitter->sizes().size();
     }
-    return 1;
+    return 0;
 }
 
-void SwiftQSlider::setPageStep(int step) {
+void SwiftQSplitter::setStretchFactor(int index, int stretch) {
     ensureWidget();
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            slider->setPageStep(step);
-        }
+    if (splitter) {
+        splitter->setStretchFactor(index, stretch);
     }
 }
 
-int SwiftQSlider::pageStep() const {
-    if (widget) {
-        QSlider* slider = qobject_cast<QSlider*>(widget);
-        if (slider) {
-            return slider->pageStep();
-        }
+void SwiftQSplitter::setCollapsible(int index, bool collapsible) {
+    ensureWidget();
+    if (splitter) {
+        splitter->setCollapsible(index, collapsible);
     }
-    return 10;
-}
-
-void SwiftQSlider::setValueChangedHandler(SwiftEventCallback callback) {
-    valueChangedFunc = [callback](int value) {
-        if (callback.handler) {
-            QtEventInfo info;
-            info.type = QtEventType::Custom;
-            info.intValue = value;
-            info.intValue2 = 0;
-            info.stringValue = nullptr;
-            info.boolValue = false;
-            info.customData = nullptr;
-            callback.handler(callback.context, &info);
-        }
-    };
-    setupConnections();
-}
-
-void SwiftQSlider::setSliderPressedHandler(SwiftEventCallback callback) {
-    sliderPressedFunc = [callback]() {
-        if (callback.handler) {
-            QtEventInfo info;
-            info.type = QtEventType::Pressed;
-            info.intValue = 0;
-            info.intValue2 = 0;
-            info.stringValue = nullptr;
-            info.boolValue = false;
-            info.customData = nullptr;
-            callback.handler(callback.context, &info);
-        }
-    };
-    setupConnections();
 }
 
-void SwiftQSlider::setSliderReleasedHandler(SwiftEventCallback callback) {
-    sliderReleasedFunc = [callback]() {
-        if (callback.handler) {
-            QtEventInfo info;
-            info.type = QtEventType::Released;
-            info.intValue = 0;
-            info.intValue2 = 0;
-            info.stringValue = nullptr;
-            info.boolValue = false;
-            info.customData = nullptr;
-            callback.handler(callback.context, &info);
-        }
-    };
-    setupConnections();
+bool SwiftQSplitter::isCollapsible(int index) const {
+    if (splitter) {
+        return splitter->isCollapsible(index);
+    }
+    return true;
 }
 
-void SwiftQSlider::setSliderMovedHandler(SwiftEventCallback callback) {
-    sliderMovedFunc = [callback](int value) {
-        if (callback.handler) {
-            QtEventInfo info;
-            info.type = QtEventType::Move;
-            info.intValue = value;
-            info.intValue2 = 0;
-            info.stringValue = nullptr;
-            info.boolValue = false;
-            info.customData = nullptr;
-            callback.handler(callback.context, &info);
-        }
-    };
-    setupConnections();
+void SwiftQSplitter::setChildrenCollapsible(bool collapsible) {
+    ensureWidget();
+    if (splitter) {
+        splitter->setChildrenCollapsible(collapsible);
+    }
 }
 
-// SwiftQProgressBar implementation
-void SwiftQProgressBar::ensureWidget() {
-    if (!widget && QApplication::instance()) {
-        QProgressBar* progressBar = nullptr;
-        if (parentWidget) {
-            progressBar = new QProgressBar(parentWidget->getQWidget());
-        } else {
-            progressBar = new QProgressBar(nullptr);
-        }
-        
-        progressBar->setMinimum(progressMin);
-        progressBar->setMaximum(progressMax);
-        progressBar->setValue(progressValue);
-        if (!progressFormat.empty()) {
-            progressBar->setFormat(QString::fromStdString(progressFormat));
-        }
-        
-        widget = progressBar;
-        ownsWidget = true;
-        setupEventFilter();
+bool SwiftQSplitter::childrenCollapsible() const {
+    if (splitter) {
+        return splitter->childrenCollapsible();
     }
+    return true;
 }
 
-SwiftQProgressBar::SwiftQProgressBar()
-    : SwiftQWidget(), progressValue(0), progressMin(0), progressMax(100), progressFormat("%p%") {
+void SwiftQSplitter::setHandleWidth(int width) {
+    ensureWidget();
+    if (splitter) {
+        splitter->setHandleWidth(width);
+    }
 }
 
-SwiftQProgressBar::SwiftQProgressBar(SwiftQWidget* parent)
-    : SwiftQWidget(parent), progressValue(0), progressMin(0), progressMax(100), progressFormat("%p%") {
+int SwiftQSplitter::handleWidth() const {
+    if (splitter) {
+        return splitter->handleWidth();
+    }
+    return 0;
 }
 
-void SwiftQProgressBar::setValue(int value) {
-    progressValue = value;
-    ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->setValue(value);
-        }
+// SwiftQSpinBox implementation
+void SwiftQSpinBox::ensureWidget() {
+    if (!widget) {
+        widget = new QSpinBox();
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
+    }
+    if (!spinBox) {
+        spinBox = qobject_cast<QSpinBox*>(widget);
     }
 }
 
-int SwiftQProgressBar::value() const {
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            return progressBar->value();
-        }
+SwiftQSpinBox::SwiftQSpinBox() : SwiftQWidget(), spinBox(nullptr) {
+    ensureWidget();
+}
+
+SwiftQSpinBox::SwiftQSpinBox(SwiftQWidget* parent) : SwiftQWidget(parent), spinBox(nullptr) {
+    ensureWidget();
+}
+
+SwiftQSpinBox::~SwiftQSpinBox() {
+    // Widget is deleted by base class
+}
+
+int SwiftQSpinBox::value() const {
+    if (spinBox) {
+        return spinBox->value();
     }
-    return progressValue;
+    return 0;
 }
 
-void SwiftQProgressBar::setMinimum(int min) {
-    progressMin = min;
+void SwiftQSpinBox::setValue(int value) {
     ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->setMinimum(min);
-        }
+    if (spinBox) {
+        spinBox->setValue(value);
     }
 }
 
-int SwiftQProgressBar::minimum() const {
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            return progressBar->minimum();
-        }
+int SwiftQSpinBox::minimum() const {
+    if (spinBox) {
+        return spinBox->minimum();
     }
-    return progressMin;
+    return 0;
 }
 
-void SwiftQProgressBar::setMaximum(int max) {
-    progressMax = max;
+void SwiftQSpinBox::setMinimum(int min) {
     ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->setMaximum(max);
-        }
+    if (spinBox) {
+        spinBox->setMinimum(min);
     }
 }
 
-int SwiftQProgressBar::maximum() const {
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            return progressBar->maximum();
-        }
+int SwiftQSpinBox::maximum() const {
+    if (spinBox) {
+        return spinBox->maximum();
     }
-    return progressMax;
+    return 99;
 }
 
-void SwiftQProgressBar::setRange(int min, int max) {
-    progressMin = min;
-    progressMax = max;
+void SwiftQSpinBox::setMaximum(int max) {
     ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->setRange(min, max);
-        }
+    if (spinBox) {
+        spinBox->setMaximum(max);
     }
 }
 
-void SwiftQProgressBar::setTextVisible(bool visible) {
+void SwiftQSpinBox::setRange(int min, int max) {
     ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->setTextVisible(visible);
-        }
+    if (spinBox) {
+        spinBox->setRange(min, max);
     }
 }
 
-bool SwiftQProgressBar::isTextVisible() const {
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            return progressBar->isTextVisible();
-        }
+int SwiftQSpinBox::singleStep() const {
+    if (spinBox) {
+        return spinBox->singleStep();
     }
-    return true;
+    return 1;
 }
 
-void SwiftQProgressBar::setFormat(const std::string& format) {
-    progressFormat = format;
+void SwiftQSpinBox::setSingleStep(int step) {
     ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->setFormat(QString::fromStdString(format));
-        }
+    if (spinBox) {
+        spinBox->setSingleStep(step);
     }
 }
 
-std::string SwiftQProgressBar::format() const {
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            return progressBar->format().toStdString();
-        }
+std::string SwiftQSpinBox::prefix() const {
+    if (spinBox) {
+        return spinBox->prefix().toStdString();
     }
-    return progressFormat;
+    return "";
 }
 
-void SwiftQProgressBar::setOrientation(int orientation) {
+void SwiftQSpinBox::setPrefix(const std::string& prefix) {
     ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->setOrientation(static_cast<Qt::Orientation>(orientation));
-        }
+    if (spinBox) {
+        spinBox->setPrefix(QString::fromStdString(prefix));
     }
 }
 
-int SwiftQProgressBar::orientation() const {
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            return static_cast<int>(progressBar->orientation());
-        }
+std::string SwiftQSpinBox::suffix() const {
+    if (spinBox) {
+        return spinBox->suffix().toStdString();
     }
-    return 1; // Qt::Horizontal
+    return "";
 }
 
-void SwiftQProgressBar::reset() {
-    progressValue = progressMin;
+void SwiftQSpinBox::setSuffix(const std::string& suffix) {
     ensureWidget();
-    if (widget) {
-        QProgressBar* progressBar = qobject_cast<QProgressBar*>(widget);
-        if (progressBar) {
-            progressBar->reset();
-        }
+    if (spinBox) {
+        spinBox->setSuffix(QString::fromStdString(suffix));
     }
 }
 
-// SwiftQScrollArea implementation
-void SwiftQScrollArea::ensureWidget() {
-    if (!widget && QApplication::instance()) {
-        QScrollArea* scrollArea = nullptr;
-        if (parentWidget) {
-            scrollArea = new QScrollArea(parentWidget->getQWidget());
-        } else {
-            scrollArea = new QScrollArea(nullptr);
-        }
-        
-        scrollArea->setWidgetResizable(true);
-        
-        widget = scrollArea;
-        ownsWidget = true;
-        setupEventFilter();
+std::string SwiftQSpinBox::specialValueText() const {
+    if (spinBox) {
+        return spinBox->specialValueText().toStdString();
     }
+    return "";
 }
 
-SwiftQScrollArea::SwiftQScrollArea()
-    : SwiftQWidget(), contentWidget(nullptr) {
-}
-
-SwiftQScrollArea::SwiftQScrollArea(SwiftQWidget* parent)
-    : SwiftQWidget(parent), contentWidget(nullptr) {
+void SwiftQSpinBox::setSpecialValueText(const std::string& text) {
+    ensureWidget();
+    if (spinBox) {
+        spinBox->setSpecialValueText(QString::fromStdString(text));
+    }
 }
 
-SwiftQScrollArea::~SwiftQScrollArea() {
-    // The content widget will be deleted automatically by Qt
-    contentWidget = nullptr;
+bool SwiftQSpinBox::wrapping() const {
+    if (spinBox) {
+        return spinBox->wrapping();
+    }
+    return false;
 }
 
-void SwiftQScrollArea::setWidget(SwiftQWidget* widget) {
-    contentWidget = widget;
+void SwiftQSpinBox::setWrapping(bool wrap) {
     ensureWidget();
-    if (this->widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(this->widget);
-        if (scrollArea) {
-            if (widget) {
-                scrollArea->setWidget(widget->getQWidget());
-            } else {
-                scrollArea->setWidget(nullptr);
-            }
-        }
+    if (spinBox) {
+        spinBox->setWrapping(wrap);
     }
 }
 
-SwiftQWidget* SwiftQScrollArea::getWidget() const {
-    return contentWidget;
+void SwiftQSpinBox::setButtonSymbols(int symbols) {
+    ensureWidget();
+    if (spinBox) {
+        spinBox->setButtonSymbols(static_cast<QAbstractSpinBox::ButtonSymbols>(symbols));
+    }
 }
 
-void SwiftQScrollArea::setWidgetResizable(bool resizable) {
-    ensureWidget();
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            scrollArea->setWidgetResizable(resizable);
-        }
+int SwiftQSpinBox::buttonSymbols() const {
+    if (spinBox) {
+        return static_cast<int>(spinBox->buttonSymbols());
     }
+    return 0;
 }
 
-bool SwiftQScrollArea::widgetResizable() const {
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            return scrollArea->widgetResizable();
-        }
+void SwiftQSpinBox::setAlignment(int alignment) {
+    ensureWidget();
+    if (spinBox) {
+        spinBox->setAlignment(static_cast<Qt::Alignment>(alignment));
     }
-    return true;
 }
 
-void SwiftQScrollArea::setHorizontalScrollBarPolicy(int policy) {
-    ensureWidget();
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            scrollArea->setHorizontalScrollBarPolicy(static_cast<Qt::ScrollBarPolicy>(policy));
-        }
+int SwiftQSpinBox::alignment() const {
+    if (spinBox) {
+        return static_cast<int>(spinBox->alignment());
     }
+    return 0;
 }
 
-void SwiftQScrollArea::setVerticalScrollBarPolicy(int policy) {
-    ensureWidget();
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            scrollArea->setVerticalScrollBarPolicy(static_cast<Qt::ScrollBarPolicy>(policy));
-        }
+bool SwiftQSpinBox::isReadOnly() const {
+    if (spinBox) {
+        return spinBox->isReadOnly();
     }
+    return false;
 }
 
-int SwiftQScrollArea::horizontalScrollBarPolicy() const {
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            return static_cast<int>(scrollArea->horizontalScrollBarPolicy());
-        }
+void SwiftQSpinBox::setReadOnly(bool readOnly) {
+    ensureWidget();
+    if (spinBox) {
+        spinBox->setReadOnly(readOnly);
     }
-    return 0; // Qt::ScrollBarAsNeeded
 }
 
-int SwiftQScrollArea::verticalScrollBarPolicy() const {
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            return static_cast<int>(scrollArea->verticalScrollBarPolicy());
-        }
+// SwiftQDoubleSpinBox implementation
+void SwiftQDoubleSpinBox::ensureWidget() {
+    if (!widget) {
+        widget = new QDoubleSpinBox();
+        SwiftLiveObjects::trackWidget(widget);
+        registerWrapper();
+    }
+    if (!spinBox) {
+        spinBox = qobject_cast<QDoubleSpinBox*>(widget);
     }
-    return 0; // Qt::ScrollBarAsNeeded
 }
 
-void SwiftQScrollArea::ensureVisible(int x, int y, int xmargin, int ymargin) {
+SwiftQDoubleSpinBox::SwiftQDoubleSpinBox() : SwiftQWidget(), spinBox(nullptr) {
     ensureWidget();
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            scrollArea->ensureVisible(x, y, xmargin, ymargin);
-        }
-    }
 }
 
-void SwiftQScrollArea::ensureWidgetVisible(SwiftQWidget* childWidget, int xmargin, int ymargin) {
-    if (!childWidget) return;
+SwiftQDoubleSpinBox::SwiftQDoubleSpinBox(SwiftQWidget* parent) : SwiftQWidget(parent), spinBox(nullptr) {
     ensureWidget();
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea) {
-            QWidget* child = childWidget->getQWidget();
-            if (child) {
-                scrollArea->ensureWidgetVisible(child, xmargin, ymargin);
-            }
-        }
-    }
 }
 
-int SwiftQScrollArea::horizontalScrollValue() const {
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea && scrollArea->horizontalScrollBar()) {
-            return scrollArea->horizontalScrollBar()->value();
-        }
+SwiftQDoubleSpinBox::~SwiftQDoubleSpinBox() {
+    // Widget is deleted by base class
+}
+
+double SwiftQDoubleSpinBox::value() const {
+    if (spinBox) {
+        return spinBox->value();
     }
-    return 0;
+    return 0.0;
 }
 
-void SwiftQScrollArea::setHorizontalScrollValue(int value) {
+void SwiftQDoubleSpinBox::setValue(double value) {
     ensureWidget();
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea && scrollArea->horizontalScrollBar()) {
-            scrollArea->horizontalScrollBar()->setValue(value);
-        }
+    if (spinBox) {
+        spinBox->setValue(value);
     }
 }
 
-int SwiftQScrollArea::verticalScrollValue() const {
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea && scrollArea->verticalScrollBar()) {
-            return scrollArea->verticalScrollBar()->value();
-        }
+double SwiftQDoubleSpinBox::minimum() const {
+    if (spinBox) {
+        return spinBox->minimum();
     }
-    return 0;
+    return 0.0;
 }
 
-void SwiftQScrollArea::setVerticalScrollValue(int value) {
+void SwiftQDoubleSpinBox::setMinimum(double min) {
     ensureWidget();
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea && scrollArea->verticalScrollBar()) {
-            scrollArea->verticalScrollBar()->setValue(value);
-        }
+    if (spinBox) {
+        spinBox->setMinimum(min);
     }
 }
 
-int SwiftQScrollArea::horizontalScrollMaximum() const {
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea && scrollArea->horizontalScrollBar()) {
-            return scrollArea->horizontalScrollBar()->maximum();
-        }
+double SwiftQDoubleSpinBox::maximum() const {
+    if (spinBox) {
+        return spinBox->maximum();
     }
-    return 0;
+    return 99.99;
 }
 
-int SwiftQScrollArea::verticalScrollMaximum() const {
-    if (widget) {
-        QScrollArea* scrollArea = qobject_cast<QScrollArea*>(widget);
-        if (scrollArea && scrollArea->verticalScrollBar()) {
-            return scrollArea->verticalScrollBar()->maximum();
-        }
+void SwiftQDoubleSpinBox::setMaximum(double max) {
+    ensureWidget();
+    if (spinBox) {
+        spinBox->setMaximum(max);
     }
-    return 0;
 }
 
-// SwiftQTabWidget implementation
-void SwiftQTabWidget::ensureWidget() {
-    if (!widget) {
-        widget = new QTabWidget();
-    }
-    if (!tabWidget) {
-        tabWidget = qobject_cast<QTabWidget*>(widget);
+void SwiftQDoubleSpinBox::setRange(double min, double max) {
+    ensureWidget();
+    if (spinBox) {
+        spinBox->setRange(min, max);
     }
 }
 
-SwiftQTabWidget::SwiftQTabWidget() : SwiftQWidget(), tabWidget(nullptr) {
-    ensureWidget();
+double SwiftQDoubleSpinBox::singleStep() const {
+    if (spinBox) {
+        return spinBox->singleStep();
+    }
+    return 1.0;
 }
 
-SwiftQTabWidget::SwiftQTabWidget(SwiftQWidget* parent) : SwiftQWidget(parent), tabWidget(nullptr) {
+void SwiftQDoubleSpinBox::setSingleStep(double step) {
     ensureWidget();
+    if (spinBox) {
+        spinBox->setSingleStep(step);
+    }
 }
 
-SwiftQTabWidget::~SwiftQTabWidget() {
-    // Widget is deleted by base class
+int SwiftQDoubleSpinBox::decimals() const {
+    if (spinBox) {
+        return spinBox->decimals();
+    }
+    return 2;
 }
 
-int SwiftQTabWidget::addTab(SwiftQWidget* widget, const std::string& label) {
+void SwiftQDoubleSpinBox::setDecimals(int prec) {
     ensureWidget();
-    if (tabWidget && widget && widget->getQWidget()) {
-        return tabWidget->addTab(widget->getQWidget(), QString::fromStdString(label));
+    if (spinBox) {
+        spinBox->setDecimals(prec);
     }
-    return -1;
 }
 
-int SwiftQTabWidget::insertTab(int index, SwiftQWidget* widget, const std::string& label) {
-    ensureWidget();
-    if (tabWidget && widget && widget->getQWidget()) {
-        return tabWidget->insertTab(index, widget->getQWidget(), QString::fromStdString(label));
+std::string SwiftQDoubleSpinBox::prefix() const {
+    if (spinBox) {
+        return spinBox->prefix().toStdString();
     }
-    return -1;
+    return "";
 }
 
-void SwiftQTabWidget::removeTab(int index) {
+void SwiftQDoubleSpinBox::setPrefix(const std::string& prefix) {
     ensureWidget();
-    if (tabWidget) {
-        tabWidget->removeTab(index);
+    if (spinBox) {
+        spinBox->setPrefix(QString::fromStdString(prefix));
     }
 }
 
-void SwiftQTabWidget::setTabText(int index, const std::string& text) {
+std::string SwiftQDoubleSpinBox::suffix() const {
+    if (spinBox) {
+        return spinBox->suffix().toStdString();
+    }
+    return "";
+}
+
+void SwiftQDoubleSpinBox::setSuffix(const std::string& suffix) {
     ensureWidget();
-    if (tabWidget) {
-        tabWidget->setTabText(index, QString::fromStdString(text));
+    if (spinBox) {
+        spinBox->setSuffix(QString::fromStdString(suffix));
     }
 }
 
-std::string SwiftQTabWidget::tabText(int index) const {
-    if (tabWidget) {
-        return tabWidget->tabText(index).toStdString();
+std::string SwiftQDoubleSpinBox::specialValueText() const {
+    if (spinBox) {
+        return spinBox->specialValueText().toStdString();
     }
     return "";
 }
 
-void SwiftQTabWidget::setTabEnabled(int index, bool enabled) {
+void SwiftQDoubleSpinBox::setSpecialValueText(const std::string& text) {
     ensureWidget();
-    if (tabWidget) {
-        tabWidget->setTabEnabled(index, enabled);
+    if (spinBox) {
+        spinBox->setSpecialValueText(QString::fromStdString(text));
     }
 }
 
-bool SwiftQTabWidget::isTabEnabled(int index) const {
-    if (tabWidget) {
-        return tabWidget->isTabEnabled(index);
+bool SwiftQDoubleSpinBox::wrapping() const {
+    if (spinBox) {
+        return spinBox->wrapping();
     }
     return false;
 }
 
-int SwiftQTabWidget::currentIndex() const {
-    if (tabWidget) {
-        return tabWidget->currentIndex();
+void SwiftQDoubleSpinBox::setWrapping(bool wrap) {
+    ensureWidget();
+    if (spinBox) {
+        spinBox->setWrapping(wrap);
     }
-    return -1;
 }
 
-void SwiftQTabWidget::setCurrentIndex(int index) {
+void SwiftQDoubleSpinBox::setButtonSymbols(int symbols) {
     ensureWidget();
-    if (tabWidget) {
-        tabWidget->setCurrentIndex(index);
+    if (spinBox) {
+        spinBox->setButtonSymbols(static_cast<QAbstractSpinBox::ButtonSymbols>(symbols));
     }
 }
 
-SwiftQWidget* SwiftQTabWidget::currentWidget() const {
-    // This would require maintaining a mapping of QWidget* to SwiftQWidget*
-    // For now, returning nullptr
-    return nullptr;
+int SwiftQDoubleSpinBox::buttonSymbols() const {
+    if (spinBox) {
+        return static_cast<int>(spinBox->buttonSymbols());
+    }
+    return 0;
 }
 
-void SwiftQTabWidget::setCurrentWidget(SwiftQWidget* widget) {
+void SwiftQDoubleSpinBox::setAlignment(int alignment) {
     ensureWidget();
-    if (tabWidget && widget && widget->getQWidget()) {
-        tabWidget->setCurrentWidget(widget->getQWidget());
+    if (spinBox) {
+        spinBox->setAlignment(static_cast<Qt::Alignment>(alignment));
     }
 }
 
-int SwiftQTabWidget::count() const {
-    if (tabWidget) {
-        return tabWidget->count();
+int SwiftQDoubleSpinBox::alignment() const {
+    if (spinBox) {
+        return static_cast<int>(spinBox->alignment());
+    }
+    return 0;
+}
+
+bool SwiftQDoubleSpinBox::isReadOnly() const {
+    if (spinBox) {
+        return spinBox->isReadOnly();
     }
-    return 0;
+    return false;
 }
 
-void SwiftQTabWidget::clear() {
+void SwiftQDoubleSpinBox::setReadOnly(bool readOnly) {
     ensureWidget();
-    if (tabWidget) {
-        tabWidget->clear();
+    if (spinBox) {
+        spinBox->setReadOnly(readOnly);
     }
 }
 
-void SwiftQTabWidget::setTabPosition(int position) {
-    ensureWidget();
-    if (tabWidget) {
-        tabWidget->setTabPosition(static_cast<QTabWidget::TabPosition>(position));
-    }
+// Factory functions
+SwiftQWidget* createWidget(SwiftQWidget* parent) {
+    return new SwiftQWidget(parent);
 }
 
-int SwiftQTabWidget::tabPosition() const {
-    if (tabWidget) {
-        return static_cast<int>(tabWidget->tabPosition());
-    }
-    return 0;
+SwiftQLabel* createLabel(const std::string& text, SwiftQWidget* parent) {
+    return new SwiftQLabel(text, parent);
 }
 
-void SwiftQTabWidget::setMovable(bool movable) {
-    ensureWidget();
-    if (tabWidget) {
-        tabWidget->setMovable(movable);
-    }
+SwiftQPushButton* createButton(const std::string& text, SwiftQWidget* parent) {
+    return new SwiftQPushButton(text, parent);
 }
 
-bool SwiftQTabWidget::isMovable() const {
-    if (tabWidget) {
-        return tabWidget->isMovable();
-    }
-    return false;
+SwiftQLineEdit* createLineEdit(const std::string& text, SwiftQWidget* parent) {
+    return new SwiftQLineEdit(text, parent);
 }
 
-void SwiftQTabWidget::setTabBarAutoHide(bool hide) {
-    ensureWidget();
-    if (tabWidget) {
-        tabWidget->setTabsClosable(hide); // Using closable as a similar feature
-    }
+SwiftQTextEdit* createTextEdit(SwiftQWidget* parent) {
+    return new SwiftQTextEdit(parent);
 }
 
-bool SwiftQTabWidget::tabBarAutoHide() const {
-    if (tabWidget) {
-        return tabWidget->tabsClosable();
-    }
-    return false;
+SwiftQCheckBox* createCheckBox(const std::string& text, SwiftQWidget* parent) {
+    return new SwiftQCheckBox(text, parent);
 }
 
-// SwiftQSplitter implementation
-void SwiftQSplitter::ensureWidget() {
-    if (!SwiftQWidget::widget) {
-        SwiftQWidget::widget = new QSplitter();
-    }
-    if (!splitter) {
-        splitter = qobject_cast<QSplitter*>(SwiftQWidget::widget);
-    }
+SwiftQRadioButton* createRadioButton(const std::string& text, SwiftQWidget* parent) {
+    return new SwiftQRadioButton(text, parent);
 }
 
-SwiftQSplitter::SwiftQSplitter() : SwiftQWidget(), splitter(nullptr) {
-    ensureWidget();
+SwiftQComboBox* createComboBox(SwiftQWidget* parent) {
+    return new SwiftQComboBox(parent);
 }
 
-SwiftQSplitter::SwiftQSplitter(int orientation) : SwiftQWidget(), splitter(nullptr) {
-    SwiftQWidget::widget = new QSplitter(static_cast<Qt::Orientation>(orientation));
-    splitter = qobject_cast<QSplitter*>(SwiftQWidget::widget);
+SwiftQGroupBox* createGroupBox(const std::string& title, SwiftQWidget* parent) {
+    return new SwiftQGroupBox(title, parent);
 }
 
-SwiftQSplitter::SwiftQSplitter(SwiftQWidget* parent) : SwiftQWidget(parent), splitter(nullptr) {
-    ensureWidget();
+SwiftQSlider* createSlider(int orientation, SwiftQWidget* parent) {
+    return new SwiftQSlider(orientation, parent);
 }
 
-SwiftQSplitter::SwiftQSplitter(int orientation, SwiftQWidget* parent) : SwiftQWidget(parent), splitter(nullptr) {
-    SwiftQWidget::widget = new QSplitter(static_cast<Qt::Orientation>(orientation), parent ? parent->getQWidget() : nullptr);
-    splitter = qobject_cast<QSplitter*>(SwiftQWidget::widget);
+SwiftQProgressBar* createProgressBar(SwiftQWidget* parent) {
+    return new SwiftQProgressBar(parent);
 }
 
-SwiftQSplitter::~SwiftQSplitter() {
-    // Widget is deleted by base class
+SwiftQScrollArea* createScrollArea(SwiftQWidget* parent) {
+    return new SwiftQScrollArea(parent);
 }
 
-void SwiftQSplitter::addWidget(SwiftQWidget* widget) {
-    ensureWidget();
-    if (splitter && widget && widget->getQWidget()) {
-        splitter->addWidget(widget->getQWidget());
+// Delete function for proper cleanup
+void deleteQWidget(SwiftQWidget* widget) {
+    if (widget) {
+        delete widget;
     }
 }
 
-void SwiftQSplitter::insertWidget(int index, SwiftQWidget* widget) {
+// SwiftQDateEdit implementation
+SwiftQDateEdit::SwiftQDateEdit() : SwiftQWidget(), dateEdit(nullptr) {
     ensureWidget();
-    if (splitter && widget && widget->getQWidget()) {
-        splitter->insertWidget(index, widget->getQWidget());
-    }
 }
 
-int SwiftQSplitter::count() const {
-    if (splitter) {
-        return splitter->count();
-    }
-    return 0;
+SwiftQDateEdit::SwiftQDateEdit(SwiftQWidget* parent) : SwiftQWidget(parent), dateEdit(nullptr) {
+    ensureWidget();
 }
 
-SwiftQWidget* SwiftQSplitter::widget(int index) const {
-    // This would require maintaining a mapping of QWidget* to SwiftQWidget*
-    // For now, returning nullptr
-    return nullptr;
+SwiftQDateEdit::~SwiftQDateEdit() {
+    // Widget cleanup handled by base class
 }
 
-int SwiftQSplitter::indexOf(SwiftQWidget* widget) const {
-    if (splitter && widget && widget->getQWidget()) {
-        return splitter->indexOf(widget->getQWidget());
+void SwiftQDateEdit::ensureWidget() {
+    if (!widget) {
+        dateEdit = new QDateEdit(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = dateEdit;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
     }
-    return -1;
 }
 
-void SwiftQSplitter::setOrientation(int orientation) {
-    ensureWidget();
-    if (splitter) {
-        splitter->setOrientation(static_cast<Qt::Orientation>(orientation));
+void SwiftQDateEdit::setDate(int year, int month, int day) {
+    if (dateEdit) {
+        dateEdit->setDate(QDate(year, month, day));
     }
 }
 
-int SwiftQSplitter::orientation() const {
-    if (splitter) {
-        return static_cast<int>(splitter->orientation());
+void SwiftQDateEdit::getDate(int* year, int* month, int* day) const {
+    if (dateEdit) {
+        QDate date = dateEdit->date();
+        if (year) *year = date.year();
+        if (month) *month = date.month();
+        if (day) *day = date.day();
     }
-    return 1; // Horizontal
 }
 
-void SwiftQSplitter::setSizes(const std::vector<int>& sizes) {
-    ensureWidget();
-    if (splitter) {
-        QList<int> qsizes;
-        for (int size : sizes) {
-            qsizes.append(size);
-        }
-        splitter->setSizes(qsizes);
+void SwiftQDateEdit::setMinimumDate(int year, int month, int day) {
+    if (dateEdit) {
+        dateEdit->setMinimumDate(QDate(year, month, day));
     }
 }
 
-void SwiftQSplitter::setSizesArray(const int* sizes, int count) {
-    ensureWidget();
-    if (splitter && sizes && count > 0) {
-        QList<int> qsizes;
-        for (int i = 0; i < count; ++i) {
-            qsizes.append(sizes[i]);
-        }
-        splitter->setSizes(qsizes);
+void SwiftQDateEdit::getMinimumDate(int* year, int* month, int* day) const {
+    if (dateEdit) {
+        QDate date = dateEdit->minimumDate();
+        if (year) *year = date.year();
+        if (month) *month = date.month();
+        if (day) *day = date.day();
     }
 }
 
-std::vector<int> SwiftQSplitter::sizes() const {
-    std::vector<int> result;
-    if (splitter) {
-        QList<int> qsizes = splitter->sizes();
-        for (int size : qsizes) {
-            result.push_back(size);
-        }
+void SwiftQDateEdit::setMaximumDate(int year, int month, int day) {
+    if (dateEdit) {
+        dateEdit->setMaximumDate(QDate(year, month, day));
     }
-    return result;
 }
 
-int SwiftQSplitter::getSizeAt(int index) const {
-    if (splitter) {
-        QList<int> qsizes = splitter->sizes();
-        if (index >= 0 && index < qsizes.size()) {
-            return qsizes[index];
-        }
+void SwiftQDateEdit::getMaximumDate(int* year, int* month, int* day) const {
+    if (dateEdit) {
+        QDate date = dateEdit->maximumDate();
+        if (year) *year = date.year();
+        if (month) *month = date.month();
+        if (day) *day = date.day();
     }
-    return 0;
 }
 
-int SwiftQSplitter::sizesCount() const {
-    if (splitter) {
-        return splitter->sizes().size();
+void SwiftQDateEdit::setDisplayFormat(const std::string& format) {
+    if (dateEdit) {
+        dateEdit->setDisplayFormat(QString::fromStdString(format));
     }
-    return 0;
 }
 
-void SwiftQSplitter::setStretchFactor(int index, int stretch) {
-    ensureWidget();
-    if (splitter) {
-        splitter->setStretchFactor(index, stretch);
+std::string SwiftQDateEdit::displayFormat() const {
+    if (dateEdit) {
+        return dateEdit->displayFormat().toStdString();
     }
+    return "";
 }
 
-void SwiftQSplitter::setCollapsible(int index, bool collapsible) {
-    ensureWidget();
-    if (splitter) {
-        splitter->setCollapsible(index, collapsible);
+void SwiftQDateEdit::setCalendarPopup(bool enable) {
+    if (dateEdit) {
+        dateEdit->setCalendarPopup(enable);
     }
 }
 
-bool SwiftQSplitter::isCollapsible(int index) const {
-    if (splitter) {
-        return splitter->isCollapsible(index);
-    }
-    return true;
+bool SwiftQDateEdit::calendarPopup() const {
+    return dateEdit ? dateEdit->calendarPopup() : false;
 }
 
-void SwiftQSplitter::setChildrenCollapsible(bool collapsible) {
-    ensureWidget();
-    if (splitter) {
-        splitter->setChildrenCollapsible(collapsible);
-    }
+bool SwiftQDateEdit::isReadOnly() const {
+    return dateEdit ? dateEdit->isReadOnly() : false;
 }
 
-bool SwiftQSplitter::childrenCollapsible() const {
-    if (splitter) {
-        return splitter->childrenCollapsible();
+void SwiftQDateEdit::setReadOnly(bool readOnly) {
+    if (dateEdit) {
+        dateEdit->setReadOnly(readOnly);
     }
-    return true;
 }
 
-void SwiftQSplitter::setHandleWidth(int width) {
+// SwiftQTimeEdit implementation
+SwiftQTimeEdit::SwiftQTimeEdit() : SwiftQWidget(), timeEdit(nullptr) {
     ensureWidget();
-    if (splitter) {
-        splitter->setHandleWidth(width);
-    }
 }
 
-int SwiftQSplitter::handleWidth() const {
-    if (splitter) {
-        return splitter->handleWidth();
-    }
-    return 0;
+SwiftQTimeEdit::SwiftQTimeEdit(SwiftQWidget* parent) : SwiftQWidget(parent), timeEdit(nullptr) {
+    ensureWidget();
 }
 
-// SwiftQSpinBox implementation
-void SwiftQSpinBox::ensureWidget() {
+SwiftQTimeEdit::~SwiftQTimeEdit() {
+    // Widget cleanup handled by base class
+}
+
+void SwiftQTimeEdit::ensureWidget() {
     if (!widget) {
-        widget = new QSpinBox();
-    }
-    if (!spinBox) {
-        spinBox = qobject_cast<QSpinBox*>(widget);
+        timeEdit = new QTimeEdit(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = timeEdit;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
     }
 }
 
-SwiftQSpinBox::SwiftQSpinBox() : SwiftQWidget(), spinBox(nullptr) {
-    ensureWidget();
-}
-
-SwiftQSpinBox::SwiftQSpinBox(SwiftQWidget* parent) : SwiftQWidget(parent), spinBox(nullptr) {
-    ensureWidget();
+void SwiftQTimeEdit::setTime(int hour, int minute, int second) {
+    if (timeEdit) {
+        timeEdit->setTime(QTime(hour, minute, second));
+    }
 }
 
-SwiftQSpinBox::~SwiftQSpinBox() {
-    // Widget is deleted by base class
+void SwiftQTimeEdit::getTime(int* hour, int* minute, int* second) const {
+    if (timeEdit) {
+        QTime time = timeEdit->time();
+        if (hour) *hour = time.hour();
+        if (minute) *minute = time.minute();
+        if (second) *second = time.second();
+    }
 }
 
-int SwiftQSpinBox::value() const {
-    if (spinBox) {
-        return spinBox->value();
+void SwiftQTimeEdit::setMinimumTime(int hour, int minute, int second) {
+    if (timeEdit) {
+        timeEdit->setMinimumTime(QTime(hour, minute, second));
     }
-    return 0;
 }
 
-void SwiftQSpinBox::setValue(int value) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setValue(value);
+void SwiftQTimeEdit::getMinimumTime(int* hour, int* minute, int* second) const {
+    if (timeEdit) {
+        QTime time = timeEdit->minimumTime();
+        if (hour) *hour = time.hour();
+        if (minute) *minute = time.minute();
+        if (second) *second = time.second();
     }
 }
 
-int SwiftQSpinBox::minimum() const {
-    if (spinBox) {
-        return spinBox->minimum();
+void SwiftQTimeEdit::setMaximumTime(int hour, int minute, int second) {
+    if (timeEdit) {
+        timeEdit->setMaximumTime(QTime(hour, minute, second));
     }
-    return 0;
 }
 
-void SwiftQSpinBox::setMinimum(int min) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setMinimum(min);
+void SwiftQTimeEdit::getMaximumTime(int* hour, int* minute, int* second) const {
+    if (timeEdit) {
+        QTime time = timeEdit->maximumTime();
+        if (hour) *hour = time.hour();
+        if (minute) *minute = time.minute();
+        if (second) *second = time.second();
     }
 }
 
-int SwiftQSpinBox::maximum() const {
-    if (spinBox) {
-        return spinBox->maximum();
+void SwiftQTimeEdit::setDisplayFormat(const std::string& format) {
+    if (timeEdit) {
+        timeEdit->setDisplayFormat(QString::fromStdString(format));
     }
-    return 99;
 }
 
-void SwiftQSpinBox::setMaximum(int max) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setMaximum(max);
+std::string SwiftQTimeEdit::displayFormat() const {
+    if (timeEdit) {
+        return timeEdit->displayFormat().toStdString();
     }
+    return "";
 }
 
-void SwiftQSpinBox::setRange(int min, int max) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setRange(min, max);
-    }
+bool SwiftQTimeEdit::isReadOnly() const {
+    return timeEdit ? timeEdit->isReadOnly() : false;
 }
 
-int SwiftQSpinBox::singleStep() const {
-    if (spinBox) {
-        return spinBox->singleStep();
+void SwiftQTimeEdit::setReadOnly(bool readOnly) {
+    if (timeEdit) {
+        timeEdit->setReadOnly(readOnly);
     }
-    return 1;
 }
 
-void SwiftQSpinBox::setSingleStep(int step) {
+// SwiftQDateTimeEdit implementation
+SwiftQDateTimeEdit::SwiftQDateTimeEdit() : SwiftQWidget(), dateTimeEdit(nullptr) {
     ensureWidget();
-    if (spinBox) {
-        spinBox->setSingleStep(step);
-    }
 }
 
-std::string SwiftQSpinBox::prefix() const {
-    if (spinBox) {
-        return spinBox->prefix().toStdString();
-    }
-    return "";
+SwiftQDateTimeEdit::SwiftQDateTimeEdit(SwiftQWidget* parent) : SwiftQWidget(parent), dateTimeEdit(nullptr) {
+    ensureWidget();
 }
 
-void SwiftQSpinBox::setPrefix(const std::string& prefix) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setPrefix(QString::fromStdString(prefix));
-    }
+SwiftQDateTimeEdit::~SwiftQDateTimeEdit() {
+    // Widget cleanup handled by base class
 }
 
-std::string SwiftQSpinBox::suffix() const {
-    if (spinBox) {
-        return spinBox->suffix().toStdString();
+void SwiftQDateTimeEdit::ensureWidget() {
+    if (!widget) {
+        dateTimeEdit = new QDateTimeEdit(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = dateTimeEdit;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
     }
-    return "";
 }
 
-void SwiftQSpinBox::setSuffix(const std::string& suffix) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setSuffix(QString::fromStdString(suffix));
+void SwiftQDateTimeEdit::setDateTime(int year, int month, int day, int hour, int minute, int second) {
+    if (dateTimeEdit) {
+        dateTimeEdit->setDateTime(QDateTime(QDate(year, month, day), QTime(hour, minute, second)));
     }
 }
 
-std::string SwiftQSpinBox::specialValueText() const {
-    if (spinBox) {
-        return spinBox->specialValueText().toStdString();
+void SwiftQDateTimeEdit::getDateTime(int* year, int* month, int* day, int* hour, int* minute, int* second) const {
+    if (dateTimeEdit) {
+        QDateTime dt = dateTimeEdit->dateTime();
+        QDate date = dt.date();
+        QTime time = dt.time();
+        if (year) *year = date.year();
+        if (month) *month = date.month();
+        if (day) *day = date.day();
+        if (hour) *hour = time.hour();
+        if (minute) *minute = time.minute();
+        if (second) *second = time.second();
     }
-    return "";
 }
 
-void SwiftQSpinBox::setSpecialValueText(const std::string& text) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setSpecialValueText(QString::fromStdString(text));
+void SwiftQDateTimeEdit::setMinimumDateTime(int year, int month, int day, int hour, int minute, int second) {
+    if (dateTimeEdit) {
+        dateTimeEdit->setMinimumDateTime(QDateTime(QDate(year, month, day), QTime(hour, minute, second)));
     }
 }
 
-bool SwiftQSpinBox::wrapping() const {
-    if (spinBox) {
-        return spinBox->wrapping();
+void SwiftQDateTimeEdit::getMinimumDateTime(int* year, int* month, int* day, int* hour, int* minute, int* second) const {
+    if (dateTimeEdit) {
+        QDateTime dt = dateTimeEdit->minimumDateTime();
+        QDate date = dt.date();
+        QTime time = dt.time();
+        if (year) *year = date.year();
+        if (month) *month = date.month();
+        if (day) *day = date.day();
+        if (hour) *hour = time.hour();
+        if (minute) *minute = time.minute();
+        if (second) *second = time.second();
     }
-    return false;
 }
 
-void SwiftQSpinBox::setWrapping(bool wrap) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setWrapping(wrap);
+void SwiftQDateTimeEdit::setMaximumDateTime(int year, int month, int day, int hour, int minute, int second) {
+    if (dateTimeEdit) {
+        dateTimeEdit->setMaximumDateTime(QDateTime(QDate(year, month, day), QTime(hour, minute, second)));
     }
 }
 
-void SwiftQSpinBox::setButtonSymbols(int symbols) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setButtonSymbols(static_cast<QAbstractSpinBox::ButtonSymbols>(symbols));
+void SwiftQDateTimeEdit::getMaximumDateTime(int* year, int* month, int* day, int* hour, int* minute, int* second) const {
+    if (dateTimeEdit) {
+        QDateTime dt = dateTimeEdit->maximumDateTime();
+        QDate date = dt.date();
+        QTime time = dt.time();
+        if (year) *year = date.year();
+        if (month) *month = date.month();
+        if (day) *day = date.day();
+        if (hour) *hour = time.hour();
+        if (minute) *minute = time.minute();
+        if (second) *second = time.second();
     }
 }
 
-int SwiftQSpinBox::buttonSymbols() const {
-    if (spinBox) {
-        return static_cast<int>(spinBox->buttonSymbols());
+void SwiftQDateTimeEdit::setDisplayFormat(const std::string& format) {
+    if (dateTimeEdit) {
+        dateTimeEdit->setDisplayFormat(QString::fromStdString(format));
     }
-    return 0;
 }
 
-void SwiftQSpinBox::setAlignment(int alignment) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setAlignment(static_cast<Qt::Alignment>(alignment));
+std::string SwiftQDateTimeEdit::displayFormat() const {
+    if (dateTimeEdit) {
+        return dateTimeEdit->displayFormat().toStdString();
     }
+    return "";
 }
 
-int SwiftQSpinBox::alignment() const {
-    if (spinBox) {
-        return static_cast<int>(spinBox->alignment());
+void SwiftQDateTimeEdit::setCalendarPopup(bool enable) {
+    if (dateTimeEdit) {
+        dateTimeEdit->setCalendarPopup(enable);
     }
-    return 0;
 }
 
-bool SwiftQSpinBox::isReadOnly() const {
-    if (spinBox) {
-        return spinBox->isReadOnly();
-    }
-    return false;
+bool SwiftQDateTimeEdit::calendarPopup() const {
+    return dateTimeEdit ? dateTimeEdit->calendarPopup() : false;
 }
 
-void SwiftQSpinBox::setReadOnly(bool readOnly) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setReadOnly(readOnly);
-    }
+bool SwiftQDateTimeEdit::isReadOnly() const {
+    return dateTimeEdit ? dateTimeEdit->isReadOnly() : false;
 }
 
-// SwiftQDoubleSpinBox implementation
-void SwiftQDoubleSpinBox::ensureWidget() {
-    if (!widget) {
-        widget = new QDoubleSpinBox();
-    }
-    if (!spinBox) {
-        spinBox = qobject_cast<QDoubleSpinBox*>(widget);
+void SwiftQDateTimeEdit::setReadOnly(bool readOnly) {
+    if (dateTimeEdit) {
+        dateTimeEdit->setReadOnly(readOnly);
     }
 }
 
-SwiftQDoubleSpinBox::SwiftQDoubleSpinBox() : SwiftQWidget(), spinBox(nullptr) {
+// SwiftQDial implementation
+SwiftQDial::SwiftQDial() : SwiftQWidget(), dial(nullptr) {
     ensureWidget();
 }
 
-SwiftQDoubleSpinBox::SwiftQDoubleSpinBox(SwiftQWidget* parent) : SwiftQWidget(parent), spinBox(nullptr) {
+SwiftQDial::SwiftQDial(SwiftQWidget* parent) : SwiftQWidget(parent), dial(nullptr) {
     ensureWidget();
 }
 
-SwiftQDoubleSpinBox::~SwiftQDoubleSpinBox() {
-    // Widget is deleted by base class
+SwiftQDial::~SwiftQDial() {
+    // Widget cleanup handled by base class
 }
 
-double SwiftQDoubleSpinBox::value() const {
-    if (spinBox) {
-        return spinBox->value();
+void SwiftQDial::ensureWidget() {
+    if (!widget) {
+        dial = new QDial(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = dial;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
     }
-    return 0.0;
 }
 
-void SwiftQDoubleSpinBox::setValue(double value) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setValue(value);
-    }
+int SwiftQDial::value() const {
+    return dial ? dial->value() : 0;
 }
 
-double SwiftQDoubleSpinBox::minimum() const {
-    if (spinBox) {
-        return spinBox->minimum();
+void SwiftQDial::setValue(int value) {
+    if (dial) {
+        dial->setValue(value);
     }
-    return 0.0;
 }
 
-void SwiftQDoubleSpinBox::setMinimum(double min) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setMinimum(min);
+int SwiftQDial::minimum() const {
+    return dial ? dial->minimum() : 0;
+}
+
+void SwiftQDial::setMinimum(int min) {
+    if (dial) {
+        dial->setMinimum(min);
     }
 }
 
-double SwiftQDoubleSpinBox::maximum() const {
-    if (spinBox) {
-        return spinBox->maximum();
-    }
-    return 99.99;
+int SwiftQDial::maximum() const {
+    return dial ? dial->maximum() : 99;
 }
 
-void SwiftQDoubleSpinBox::setMaximum(double max) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setMaximum(max);
+void SwiftQDial::setMaximum(int max) {
+    if (dial) {
+        dial->setMaximum(max);
     }
 }
 
-void SwiftQDoubleSpinBox::setRange(double min, double max) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setRange(min, max);
+void SwiftQDial::setRange(int min, int max) {
+    if (dial) {
+        dial->setRange(min, max);
     }
 }
 
-double SwiftQDoubleSpinBox::singleStep() const {
-    if (spinBox) {
-        return spinBox->singleStep();
-    }
-    return 1.0;
+int SwiftQDial::singleStep() const {
+    return dial ? dial->singleStep() : 1;
 }
 
-void SwiftQDoubleSpinBox::setSingleStep(double step) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setSingleStep(step);
+void SwiftQDial::setSingleStep(int step) {
+    if (dial) {
+        dial->setSingleStep(step);
     }
 }
 
-int SwiftQDoubleSpinBox::decimals() const {
-    if (spinBox) {
-        return spinBox->decimals();
-    }
-    return 2;
+int SwiftQDial::pageStep() const {
+    return dial ? dial->pageStep() : 10;
 }
 
-void SwiftQDoubleSpinBox::setDecimals(int prec) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setDecimals(prec);
+void SwiftQDial::setPageStep(int step) {
+    if (dial) {
+        dial->setPageStep(step);
     }
 }
 
-std::string SwiftQDoubleSpinBox::prefix() const {
-    if (spinBox) {
-        return spinBox->prefix().toStdString();
-    }
-    return "";
+bool SwiftQDial::notchesVisible() const {
+    return dial ? dial->notchesVisible() : false;
 }
 
-void SwiftQDoubleSpinBox::setPrefix(const std::string& prefix) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setPrefix(QString::fromStdString(prefix));
+void SwiftQDial::setNotchesVisible(bool visible) {
+    if (dial) {
+        dial->setNotchesVisible(visible);
     }
 }
 
-std::string SwiftQDoubleSpinBox::suffix() const {
-    if (spinBox) {
-        return spinBox->suffix().toStdString();
-    }
-    return "";
+int SwiftQDial::notchSize() const {
+    return dial ? dial->notchSize() : 1;
 }
 
-void SwiftQDoubleSpinBox::setSuffix(const std::string& suffix) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setSuffix(QString::fromStdString(suffix));
+void SwiftQDial::setNotchTarget(double target) {
+    if (dial) {
+        dial->setNotchTarget(target);
     }
 }
 
-std::string SwiftQDoubleSpinBox::specialValueText() const {
-    if (spinBox) {
-        return spinBox->specialValueText().toStdString();
-    }
-    return "";
+double SwiftQDial::notchTarget() const {
+    return dial ? dial->notchTarget() : 3.7;
 }
 
-void SwiftQDoubleSpinBox::setSpecialValueText(const std::string& text) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setSpecialValueText(QString::fromStdString(text));
-    }
+bool SwiftQDial::wrapping() const {
+    return dial ? dial->wrapping() : false;
 }
 
-bool SwiftQDoubleSpinBox::wrapping() const {
-    if (spinBox) {
-        return spinBox->wrapping();
+void SwiftQDial::setWrapping(bool wrap) {
+    if (dial) {
+        dial->setWrapping(wrap);
     }
-    return false;
 }
 
-void SwiftQDoubleSpinBox::setWrapping(bool wrap) {
+// SwiftQLCDNumber implementation
+SwiftQLCDNumber::SwiftQLCDNumber() : SwiftQWidget(), lcdNumber(nullptr) {
     ensureWidget();
-    if (spinBox) {
-        spinBox->setWrapping(wrap);
-    }
 }
 
-void SwiftQDoubleSpinBox::setButtonSymbols(int symbols) {
+SwiftQLCDNumber::SwiftQLCDNumber(SwiftQWidget* parent) : SwiftQWidget(parent), lcdNumber(nullptr) {
     ensureWidget();
-    if (spinBox) {
-        spinBox->setButtonSymbols(static_cast<QAbstractSpinBox::ButtonSymbols>(symbols));
-    }
 }
 
-int SwiftQDoubleSpinBox::buttonSymbols() const {
-    if (spinBox) {
-        return static_cast<int>(spinBox->buttonSymbols());
+SwiftQLCDNumber::SwiftQLCDNumber(int numDigits, SwiftQWidget* parent) : SwiftQWidget(parent), lcdNumber(nullptr) {
+    ensureWidget();
+    if (lcdNumber) {
+        lcdNumber->setDigitCount(numDigits);
     }
-    return 0;
 }
 
-void SwiftQDoubleSpinBox::setAlignment(int alignment) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setAlignment(static_cast<Qt::Alignment>(alignment));
-    }
+SwiftQLCDNumber::~SwiftQLCDNumber() {
+    // Widget cleanup handled by base class
 }
 
-int SwiftQDoubleSpinBox::alignment() const {
-    if (spinBox) {
-        return static_cast<int>(spinBox->alignment());
+void SwiftQLCDNumber::ensureWidget() {
+    if (!widget) {
+        lcdNumber = new QLCDNumber(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = lcdNumber;
+        SwiftLiveObjects::trackWidget(widget);
+        setupEventFilter();
     }
-    return 0;
 }
 
-bool SwiftQDoubleSpinBox::isReadOnly() const {
-    if (spinBox) {
-        return spinBox->isReadOnly();
+void SwiftQLCDNumber::display(int value) {
+    if (lcdNumber) {
+        lcdNumber->display(value);
     }
-    return false;
 }
 
-void SwiftQDoubleSpinBox::setReadOnly(bool readOnly) {
-    ensureWidget();
-    if (spinBox) {
-        spinBox->setReadOnly(readOnly);
+void SwiftQLCDNumber::display(double value) {
+    if (lcdNumber) {
+        lcdNumber->display(value);
     }
 }
 
-// Factory functions
-SwiftQWidget* createWidget(SwiftQWidget* parent) {
-    return new SwiftQWidget(parent);
+void SwiftQLCDNumber::display(const std::string& text) {
+    if (lcdNumber) {
+        lcdNumber->display(QString::fromStdString(text));
+    }
 }
 
-SwiftQLabel* createLabel(const std::string& text, SwiftQWidget* parent) {
-    return new SwiftQLabel(text, parent);
+int SwiftQLCDNumber::intValue() const {
+    return lcdNumber ? lcdNumber->intValue() : 0;
 }
 
-SwiftQPushButton* createButton(const std::string& text, SwiftQWidget* parent) {
-    return new SwiftQPushButton(text, parent);
+double SwiftQLCDNumber::value() const {
+    return lcdNumber ? lcdNumber->value() : 0.0;
 }
 
-SwiftQLineEdit* createLineEdit(const std::string& text, SwiftQWidget* parent) {
-    return new SwiftQLineEdit(text, parent);
+int SwiftQLCDNumber::digitCount() const {
+    return lcdNumber ? lcdNumber->digitCount() : 5;
 }
 
-SwiftQTextEdit* createTextEdit(SwiftQWidget* parent) {
-    return new SwiftQTextEdit(parent);
+void SwiftQLCDNumber::setDigitCount(int count) {
+    if (lcdNumber) {
+        lcdNumber->setDigitCount(count);
+    }
 }
 
-SwiftQCheckBox* createCheckBox(const std::string& text, SwiftQWidget* parent) {
-    return new SwiftQCheckBox(text, parent);
+void SwiftQLCDNumber::setMode(int mode) {
+    if (lcdNumber) {
+        lcdNumber->setMode(static_cast<QLCDNumber::Mode>(mode));
+    }
 }
 
-SwiftQRadioButton* createRadioButton(const std::string& text, SwiftQWidget* parent) {
-    return new SwiftQRadioButton(text, parent);
+int SwiftQLCDNumber::mode() const {
+    return lcdNumber ? static_cast<int>(lcdNumber->mode()) : 1;
 }
 
-SwiftQComboBox* createComboBox(SwiftQWidget* parent) {
-    return new SwiftQComboBox(parent);
+void SwiftQLCDNumber::setSegmentStyle(int style) {
+    if (lcdNumber) {
+        lcdNumber->setSegmentStyle(static_cast<QLCDNumber::SegmentStyle>(style));
+    }
 }
 
-SwiftQGroupBox* createGroupBox(const std::string& title, SwiftQWidget* parent) {
-    return new SwiftQGroupBox(title, parent);
+int SwiftQLCDNumber::segmentStyle() const {
+    return lcdNumber ? static_cast<int>(lcdNumber->segmentStyle()) : 1;
 }
 
-SwiftQSlider* createSlider(int orientation, SwiftQWidget* parent) {
-    return new SwiftQSlider(orientation, parent);
+bool SwiftQLCDNumber::smallDecimalPoint() const {
+    return lcdNumber ? lcdNumber->smallDecimalPoint() : false;
 }
 
-SwiftQProgressBar* createProgressBar(SwiftQWidget* parent) {
-    return new SwiftQProgressBar(parent);
+void SwiftQLCDNumber::setSmallDecimalPoint(bool small) {
+    if (lcdNumber) {
+        lcdNumber->setSmallDecimalPoint(small);
+    }
 }
 
-SwiftQScrollArea* createScrollArea(SwiftQWidget* parent) {
-    return new SwiftQScrollArea(parent);
+void SwiftQLCDNumber::attachProgressChannel(const SwiftProgressChannel& channel, int intervalMs) {
+    if (QLCDNumber* lcd = lcdNumber) {
+        attachProgressTimer(lcd, channel.shared(), intervalMs, [lcd](long long sample) {
+            lcd->display(QString::number(sample));
+        });
+    }
 }
 
-// Delete function for proper cleanup
-void deleteQWidget(SwiftQWidget* widget) {
-    if (widget) {
-        delete widget;
+void SwiftQLCDNumber::detachProgressChannel() {
+    if (lcdNumber) {
+        detachProgressTimer(lcdNumber);
     }
 }
 
-// SwiftQDateEdit implementation
-SwiftQDateEdit::SwiftQDateEdit() : SwiftQWidget(), dateEdit(nullptr) {
+// SwiftQCalendarWidget implementation
+SwiftQCalendarWidget::SwiftQCalendarWidget() : SwiftQWidget(), calendarWidget(nullptr) {
     ensureWidget();
 }
 
-SwiftQDateEdit::SwiftQDateEdit(SwiftQWidget* parent) : SwiftQWidget(parent), dateEdit(nullptr) {
+SwiftQCalendarWidget::SwiftQCalendarWidget(SwiftQWidget* parent) : SwiftQWidget(parent), calendarWidget(nullptr) {
     ensureWidget();
 }
 
-SwiftQDateEdit::~SwiftQDateEdit() {
+SwiftQCalendarWidget::~SwiftQCalendarWidget() {
     // Widget cleanup handled by base class
 }
 
-void SwiftQDateEdit::ensureWidget() {
+void SwiftQCalendarWidget::ensureWidget() {
     if (!widget) {
-        dateEdit = new QDateEdit(parentWidget ? parentWidget->getQWidget() : nullptr);
-        widget = dateEdit;
+        calendarWidget = new QCalendarWidget(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = calendarWidget;
+        SwiftLiveObjects::trackWidget(widget);
         setupEventFilter();
     }
 }
 
-void SwiftQDateEdit::setDate(int year, int month, int day) {
-    if (dateEdit) {
-        dateEdit->setDate(QDate(year, month, day));
+void SwiftQCalendarWidget::setSelectedDate(int year, int month, int day) {
+    if (calendarWidget) {
+        calendarWidget->setSelectedDate(QDate(year, month, day));
+    }
+}
+
+void SwiftQCalendarWidget::getSelectedDate(int* year, int* month, int* day) const {
+    if (calendarWidget) {
+        QDate date = calendarWidget->selectedDate();
+        if (year) *year = date.year();
+        if (month) *month = date.month();
+        if (day) *day = date.day();
+    }
+}
+
+void SwiftQCalendarWidget::setMinimumDate(int year, int month, int day) {
+    if (calendarWidget) {
+        calendarWidget->setMinimumDate(QDate(year, month, day));
     }
 }
 
-void SwiftQDateEdit::getDate(int* year, int* month, int* day) const {
-    if (dateEdit) {
-        QDate date = dateEdit->date();
+void SwiftQCalendarWidget::getMinimumDate(int* year, int* month, int* day) const {
+    if (calendarWidget) {
+        QDate date = calendarWidget->minimumDate();
         if (year) *year = date.year();
         if (month) *month = date.month();
         if (day) *day = date.day();
     }
 }
 
-void SwiftQDateEdit::setMinimumDate(int year, int month, int day) {
-    if (dateEdit) {
-        dateEdit->setMinimumDate(QDate(year, month, day));
+void SwiftQCalendarWidget::setMaximumDate(int year, int month, int day) {
+    if (calendarWidget) {
+        calendarWidget->setMaximumDate(QDate(year, month, day));
     }
 }
 
-void SwiftQDateEdit::getMinimumDate(int* year, int* month, int* day) const {
-    if (dateEdit) {
-        QDate date = dateEdit->minimumDate();
+void SwiftQCalendarWidget::getMaximumDate(int* year, int* month, int* day) const {
+    if (calendarWidget) {
+        QDate date = calendarWidget->maximumDate();
         if (year) *year = date.year();
         if (month) *month = date.month();
         if (day) *day = date.day();
     }
 }
 
-void SwiftQDateEdit::setMaximumDate(int year, int month, int day) {
-    if (dateEdit) {
-        dateEdit->setMaximumDate(QDate(year, month, day));
+void SwiftQCalendarWidget::setFirstDayOfWeek(int dayOfWeek) {
+    if (calendarWidget) {
+        calendarWidget->setFirstDayOfWeek(static_cast<Qt::DayOfWeek>(dayOfWeek));
     }
 }
 
-void SwiftQDateEdit::getMaximumDate(int* year, int* month, int* day) const {
-    if (dateEdit) {
-        QDate date = dateEdit->maximumDate();
-        if (year) *year = date.year();
-        if (month) *month = date.month();
-        if (day) *day = date.day();
+int SwiftQCalendarWidget::firstDayOfWeek() const {
+    return calendarWidget ? static_cast<int>(calendarWidget->firstDayOfWeek()) : 1;
+}
+
+void SwiftQCalendarWidget::setGridVisible(bool show) {
+    if (calendarWidget) {
+        calendarWidget->setGridVisible(show);
     }
 }
 
-void SwiftQDateEdit::setDisplayFormat(const std::string& format) {
-    if (dateEdit) {
-        dateEdit->setDisplayFormat(QString::fromStdString(format));
+bool SwiftQCalendarWidget::isGridVisible() const {
+    return calendarWidget ? calendarWidget->isGridVisible() : false;
+}
+
+void SwiftQCalendarWidget::setNavigationBarVisible(bool visible) {
+    if (calendarWidget) {
+        calendarWidget->setNavigationBarVisible(visible);
     }
 }
 
-std::string SwiftQDateEdit::displayFormat() const {
-    if (dateEdit) {
-        return dateEdit->displayFormat().toStdString();
+bool SwiftQCalendarWidget::isNavigationBarVisible() const {
+    return calendarWidget ? calendarWidget->isNavigationBarVisible() : true;
+}
+
+void SwiftQCalendarWidget::setSelectionMode(int mode) {
+    if (calendarWidget) {
+        calendarWidget->setSelectionMode(static_cast<QCalendarWidget::SelectionMode>(mode));
     }
-    return "";
 }
 
-void SwiftQDateEdit::setCalendarPopup(bool enable) {
-    if (dateEdit) {
-        dateEdit->setCalendarPopup(enable);
+int SwiftQCalendarWidget::selectionMode() const {
+    return calendarWidget ? static_cast<int>(calendarWidget->selectionMode()) : 1;
+}
+
+// SwiftQCanvas implementation
+
+// Display list records, in native byte order:
+//   u32 id, u8 kind, u8[3] reserved, u32 payload size, payload
+// Payloads (f32 = float, color = u32 0xAARRGGBB where alpha 0 draws nothing):
+//   1 rect:  f32 x, y, width, height, color fill, color stroke, f32 lineWidth, f32 cornerRadius
+//   2 line:  f32 x1, y1, x2, y2, color, f32 lineWidth
+//   3 path:  color fill, color stroke, f32 lineWidth, u32 command count, then per command an
+//            u8 op and its f32 coordinates: 0 moveTo (2), 1 lineTo (2), 2 quadTo (4),
+//            3 cubicTo (6), 4 closeSubpath (0)
+//   4 text:  f32 x, baseline y, f32 pointSize (0 = widget font), color, u32 byte count, UTF-8
+//   5 image: f32 x, y, width, height, u32 pixel width, pixel height, ARGB32 pixels
+static const size_t canvasRecordHeader = 12;
+
+// Bounds-checked reads from a display list buffer
+struct SwiftCanvasCursor {
+    const unsigned char* data;
+    size_t size;
+    size_t pos;
+    bool valid;
+    
+    template <typename T>
+    T read() {
+        T value{};
+        if (valid && size - pos >= sizeof(T)) {
+            std::memcpy(&value, data + pos, sizeof(T));
+            pos += sizeof(T);
+        } else {
+            valid = false;
+        }
+        return value;
+    }
+    
+    const unsigned char* take(size_t count) {
+        if (!valid || size - pos < count) {
+            valid = false;
+            return nullptr;
+        }
+        const unsigned char* start = data + pos;
+        pos += count;
+        return start;
+    }
+};
+
+// One display list item. The record bytes in the arena are authoritative (they are what
+// updates are compared against); path, image and text are decoded once when recorded.
+struct SwiftCanvasItem {
+    int id;
+    int kind;
+    size_t offset;
+    size_t length;
+    QRectF bounds;
+    bool alive;
+    QPainterPath path;
+    QImage image;
+    QString text;
+    QFont font;
+};
+
+static QPen canvasPen(quint32 color, float width) {
+    if (qAlpha(color) == 0 || width <= 0) {
+        return QPen(Qt::NoPen);
     }
+    return QPen(QColor::fromRgba(color), width);
 }
 
-bool SwiftQDateEdit::calendarPopup() const {
-    return dateEdit ? dateEdit->calendarPopup() : false;
+static QBrush canvasBrush(quint32 color) {
+    return qAlpha(color) == 0 ? QBrush(Qt::NoBrush) : QBrush(QColor::fromRgba(color));
 }
 
-bool SwiftQDateEdit::isReadOnly() const {
-    return dateEdit ? dateEdit->isReadOnly() : false;
+// Widget space covered by a stroke of the given width around `rect`, with room for antialiasing
+static QRectF strokedBounds(const QRectF& rect, quint32 stroke, float width) {
+    const qreal margin = (qAlpha(stroke) != 0 && width > 0 ? width / 2.0 : 0.0) + 1.0;
+    return rect.normalized().adjusted(-margin, -margin, margin, margin);
 }
 
-void SwiftQDateEdit::setReadOnly(bool readOnly) {
-    if (dateEdit) {
-        dateEdit->setReadOnly(readOnly);
+class SwiftCanvasWidget : public QWidget {
+public:
+    explicit SwiftCanvasWidget(QWidget* parent) : QWidget(parent), garbage(0), lastPainted(0) {}
+    
+    int apply(const unsigned char* data, size_t size, bool replace) {
+        QRectF dirty;
+        QSet<int> present;
+        int changed = 0;
+        SwiftCanvasCursor cursor{data, data ? size : 0, 0, true};
+        while (cursor.valid && cursor.pos < cursor.size) {
+            const size_t start = cursor.pos;
+            const int id = static_cast<int>(cursor.read<quint32>());
+            cursor.take(4);
+            const quint32 payload = cursor.read<quint32>();
+            if (!cursor.take(payload)) {
+                break;  // Truncated record
+            }
+            const unsigned char* record = data + start;
+            const size_t length = canvasRecordHeader + payload;
+            if (replace) {
+                present.insert(id);
+            }
+            
+            auto it = index.constFind(id);
+            if (it != index.constEnd()) {
+                const SwiftCanvasItem& current = items[it.value()];
+                if (current.length == length && std::memcmp(arena.data() + current.offset, record, length) == 0) {
+                    continue;
+                }
+            }
+            SwiftCanvasItem item{id, record[4], arena.size(), length, QRectF(), true, QPainterPath(), QImage(), QString(), QFont()};
+            if (!decode(item, record, length)) {
+                continue;
+            }
+            arena.insert(arena.end(), record, record + length);
+            dirty |= item.bounds;
+            if (it != index.constEnd()) {
+                SwiftCanvasItem& current = items[it.value()];
+                dirty |= current.bounds;
+                garbage += current.length;
+                current = std::move(item);  // Keeps its place in the paint order
+            } else {
+                index.insert(id, static_cast<int>(items.size()));
+                items.push_back(std::move(item));
+            }
+            ++changed;
+        }
+        
+        if (replace) {
+            for (SwiftCanvasItem& item : items) {
+                if (item.alive && !present.contains(item.id)) {
+                    dirty |= item.bounds;
+                    kill(item);
+                    ++changed;
+                }
+            }
+        }
+        finish(dirty);
+        return changed;
     }
-}
+    
+    int remove(const int* ids, int count) {
+        QRectF dirty;
+        int removed = 0;
+        for (int i = 0; ids && i < count; ++i) {
+            auto it = index.constFind(ids[i]);
+            if (it != index.constEnd()) {
+                SwiftCanvasItem& item = items[it.value()];
+                dirty |= item.bounds;
+                kill(item);
+                ++removed;
+            }
+        }
+        finish(dirty);
+        return removed;
+    }
+    
+    void clear() {
+        if (!items.empty()) {
+            items.clear();
+            index.clear();
+            arena.clear();
+            garbage = 0;
+            update();
+        }
+    }
+    
+    int count() const { return static_cast<int>(index.size()); }
+    int lastPaintedCount() const { return lastPainted; }
+    
+protected:
+    void paintEvent(QPaintEvent* event) override {
+        QPainter painter(this);
+        painter.setRenderHint(QPainter::Antialiasing);
+        const QRegion& region = event->region();
+        const QRectF clip = region.boundingRect();
+        const bool complexRegion = region.rectCount() > 1;
+        int painted = 0;
+        for (const SwiftCanvasItem& item : items) {
+            if (!item.alive || !item.bounds.intersects(clip)) {
+                continue;
+            }
+            if (complexRegion && !region.intersects(item.bounds.toAlignedRect())) {
+                continue;
+            }
+            paintItem(painter, item);
+            ++painted;
+        }
+        lastPainted = painted;
+    }
+    
+private:
+    std::vector<unsigned char> arena;       // Record bytes of every item, including replaced ones until compacted
+    std::vector<SwiftCanvasItem> items;     // Paint order
+    QHash<int, int> index;                  // Item id to position in items
+    size_t garbage;                         // Arena bytes no live item refers to
+    int lastPainted;
+    
+    bool decode(SwiftCanvasItem& item, const unsigned char* record, size_t length) {
+        SwiftCanvasCursor cursor{record, length, canvasRecordHeader, true};
+        switch (item.kind) {
+        case 1: {
+            const float x = cursor.read<float>(), y = cursor.read<float>();
+            const float w = cursor.read<float>(), h = cursor.read<float>();
+            cursor.read<quint32>();
+            const quint32 stroke = cursor.read<quint32>();
+            const float lineWidth = cursor.read<float>();
+            cursor.read<float>();
+            item.bounds = strokedBounds(QRectF(x, y, w, h), stroke, lineWidth);
+            break;
+        }
+        case 2: {
+            const float x1 = cursor.read<float>(), y1 = cursor.read<float>();
+            const float x2 = cursor.read<float>(), y2 = cursor.read<float>();
+            const quint32 color = cursor.read<quint32>();
+            const float lineWidth = cursor.read<float>();
+            item.bounds = strokedBounds(QRectF(QPointF(x1, y1), QPointF(x2, y2)), color, lineWidth);
+            break;
+        }
+        case 3: {
+            cursor.read<quint32>();
+            const quint32 stroke = cursor.read<quint32>();
+            const float lineWidth = cursor.read<float>();
+            const quint32 commands = cursor.read<quint32>();
+            for (quint32 i = 0; i < commands && cursor.valid; ++i) {
+                float p[6] = {};
+                const quint8 op = cursor.read<quint8>();
+                static const int pointCount[] = {2, 2, 4, 6, 0};
+                if (op > 4) {
+                    return false;
+                }
+                for (int k = 0; k < pointCount[op]; ++k) {
+                    p[k] = cursor.read<float>();
+                }
+                switch (op) {
+                case 0: item.path.moveTo(p[0], p[1]); break;
+                case 1: item.path.lineTo(p[0], p[1]); break;
+                case 2: item.path.quadTo(p[0], p[1], p[2], p[3]); break;
+                case 3: item.path.cubicTo(p[0], p[1], p[2], p[3], p[4], p[5]); break;
+                default: item.path.closeSubpath(); break;
+                }
+            }
+            item.bounds = strokedBounds(item.path.controlPointRect(), stroke, lineWidth);
+            break;
+        }
+        case 4: {
+            const float x = cursor.read<float>(), y = cursor.read<float>();
+            const float pointSize = cursor.read<float>();
+            cursor.read<quint32>();
+            const quint32 bytes = cursor.read<quint32>();
+            const unsigned char* utf8 = cursor.take(bytes);
+            if (!utf8) {
+                return false;
+            }
+            item.text = QString::fromUtf8(reinterpret_cast<const char*>(utf8), static_cast<qsizetype>(bytes));
+            item.font = font();
+            if (pointSize > 0) {
+                item.font.setPointSizeF(pointSize);
+            }
+            item.bounds = QFontMetricsF(item.font).boundingRect(item.text).translated(x, y).adjusted(-1, -1, 1, 1);
+            break;
+        }
+        case 5: {
+            const float x = cursor.read<float>(), y = cursor.read<float>();
+            const float w = cursor.read<float>(), h = cursor.read<float>();
+            const quint32 pixelWidth = cursor.read<quint32>(), pixelHeight = cursor.read<quint32>();
+            if (pixelWidth == 0 || pixelHeight == 0 || pixelWidth > 32768 || pixelHeight > 32768) {
+                return false;
+            }
+            const unsigned char* pixels = cursor.take(size_t(pixelWidth) * pixelHeight * 4);
+            if (!pixels) {
+                return false;
+            }
+            item.image = QImage(pixels, int(pixelWidth), int(pixelHeight), int(pixelWidth * 4), QImage::Format_ARGB32).copy();
+            item.bounds = QRectF(x, y, w, h).normalized();
+            break;
+        }
+        default:
+            return false;
+        }
+        return cursor.valid;
+    }
+    
+    void paintItem(QPainter& painter, const SwiftCanvasItem& item) {
+        SwiftCanvasCursor cursor{arena.data() + item.offset, item.length, canvasRecordHeader, true};
+        switch (item.kind) {
+        case 1: {
+            const float x = cursor.read<float>(), y = cursor.read<float>();
+            const float w = cursor.read<float>(), h = cursor.read<float>();
+            const quint32 fill = cursor.read<quint32>(), stroke = cursor.read<quint32>();
+            const float lineWidth = cursor.read<float>(), radius = cursor.read<float>();
+            painter.setPen(canvasPen(stroke, lineWidth));
+            painter.setBrush(canvasBrush(fill));
+            if (radius > 0) {
+                painter.drawRoundedRect(QRectF(x, y, w, h), radius, radius);
+            } else {
+                painter.drawRect(QRectF(x, y, w, h));
+            }
+            break;
+        }
+        case 2: {
+            const float x1 = cursor.read<float>(), y1 = cursor.read<float>();
+            const float x2 = cursor.read<float>(), y2 = cursor.read<float>();
+            const quint32 color = cursor.read<quint32>();
+            const float lineWidth = cursor.read<float>();
+            painter.setPen(canvasPen(color, lineWidth));
+            painter.drawLine(QPointF(x1, y1), QPointF(x2, y2));
+            break;
+        }
+        case 3: {
+            const quint32 fill = cursor.read<quint32>(), stroke = cursor.read<quint32>();
+            const float lineWidth = cursor.read<float>();
+            painter.setPen(canvasPen(stroke, lineWidth));
+            painter.setBrush(canvasBrush(fill));
+            painter.drawPath(item.path);
+            break;
+        }
+        case 4: {
+            const float x = cursor.read<float>(), y = cursor.read<float>();
+            cursor.read<float>();
+            const quint32 color = cursor.read<quint32>();
+            painter.setPen(canvasPen(color, 1));
+            painter.setFont(item.font);
+            painter.drawText(QPointF(x, y), item.text);
+            break;
+        }
+        case 5: {
+            const float x = cursor.read<float>(), y = cursor.read<float>();
+            const float w = cursor.read<float>(), h = cursor.read<float>();
+            painter.drawImage(QRectF(x, y, w, h), item.image);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    
+    void kill(SwiftCanvasItem& item) {
+        item.alive = false;
+        garbage += item.length;
+        index.remove(item.id);
+    }
+    
+    // Repaints what changed and drops dead records once they make up half the arena
+    void finish(const QRectF& dirty) {
+        if (garbage * 2 > arena.size()) {
+            std::vector<unsigned char> packed;
+            packed.reserve(arena.size() - garbage);
+            std::vector<SwiftCanvasItem> kept;
+            kept.reserve(index.size());
+            index.clear();
+            for (SwiftCanvasItem& item : items) {
+                if (!item.alive) {
+                    continue;
+                }
+                const size_t offset = packed.size();
+                packed.insert(packed.end(), arena.begin() + item.offset, arena.begin() + item.offset + item.length);
+                item.offset = offset;
+                index.insert(item.id, static_cast<int>(kept.size()));
+                kept.push_back(std::move(item));
+            }
+            arena.swap(packed);
+            items.swap(kept);
+            garbage = 0;
+        }
+        if (!dirty.isEmpty()) {
+            update(dirty.toAlignedRect());
+        }
+    }
+};
 
-// SwiftQTimeEdit implementation
-SwiftQTimeEdit::SwiftQTimeEdit() : SwiftQWidget(), timeEdit(nullptr) {
+SwiftQCanvas::SwiftQCanvas() : SwiftQWidget(), canvas(nullptr) {
     ensureWidget();
 }
 
-SwiftQTimeEdit::SwiftQTimeEdit(SwiftQWidget* parent) : SwiftQWidget(parent), timeEdit(nullptr) {
+SwiftQCanvas::SwiftQCanvas(SwiftQWidget* parent) : SwiftQWidget(parent), canvas(nullptr) {
     ensureWidget();
 }
 
-SwiftQTimeEdit::~SwiftQTimeEdit() {
+SwiftQCanvas::~SwiftQCanvas() {
     // Widget cleanup handled by base class
 }
 
-void SwiftQTimeEdit::ensureWidget() {
+void SwiftQCanvas::ensureWidget() {
     if (!widget) {
-        timeEdit = new QTimeEdit(parentWidget ? parentWidget->getQWidget() : nullptr);
-        widget = timeEdit;
+        canvas = new SwiftCanvasWidget(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = canvas;
+        SwiftLiveObjects::trackWidget(widget);
         setupEventFilter();
     }
 }
 
-void SwiftQTimeEdit::setTime(int hour, int minute, int second) {
-    if (timeEdit) {
-        timeEdit->setTime(QTime(hour, minute, second));
-    }
+int SwiftQCanvas::setDisplayList(const unsigned char* data, size_t size) {
+    return canvas ? canvas->apply(data, size, true) : 0;
 }
 
-void SwiftQTimeEdit::getTime(int* hour, int* minute, int* second) const {
-    if (timeEdit) {
-        QTime time = timeEdit->time();
-        if (hour) *hour = time.hour();
-        if (minute) *minute = time.minute();
-        if (second) *second = time.second();
-    }
+int SwiftQCanvas::updateDisplayList(const unsigned char* data, size_t size) {
+    return canvas ? canvas->apply(data, size, false) : 0;
 }
 
-void SwiftQTimeEdit::setMinimumTime(int hour, int minute, int second) {
-    if (timeEdit) {
-        timeEdit->setMinimumTime(QTime(hour, minute, second));
-    }
+int SwiftQCanvas::removeItems(const int* ids, int count) {
+    return canvas ? canvas->remove(ids, count) : 0;
 }
 
-void SwiftQTimeEdit::getMinimumTime(int* hour, int* minute, int* second) const {
-    if (timeEdit) {
-        QTime time = timeEdit->minimumTime();
-        if (hour) *hour = time.hour();
-        if (minute) *minute = time.minute();
-        if (second) *second = time.second();
+void SwiftQCanvas::clearDisplayList() {
+    if (canvas) {
+        canvas->clear();
     }
 }
 
-void SwiftQTimeEdit::setMaximumTime(int hour, int minute, int second) {
-    if (timeEdit) {
-        timeEdit->setMaximumTime(QTime(hour, minute, second));
-    }
+int SwiftQCanvas::itemCount() const {
+    return canvas ? canvas->count() : 0;
 }
 
-void SwiftQTimeEdit::getMaximumTime(int* hour, int* minute, int* second) const {
-    if (timeEdit) {
-        QTime time = timeEdit->maximumTime();
-        if (hour) *hour = time.hour();
-        if (minute) *minute = time.minute();
-        if (second) *second = time.second();
-    }
+int SwiftQCanvas::lastPaintedItemCount() const {
+    return canvas ? canvas->lastPaintedCount() : 0;
 }
 
-void SwiftQTimeEdit::setDisplayFormat(const std::string& format) {
-    if (timeEdit) {
-        timeEdit->setDisplayFormat(QString::fromStdString(format));
+// SwiftQPlot implementation
+
+// Pyramid level 0 holds the min/max of every plotBaseBlock samples; each further level
+// combines plotFanout blocks of the level below.
+static const size_t plotBaseBlock = 16;
+static const size_t plotFanout = 8;
+
+// Vectorized reductions used to build and query the pyramid
+static double plotMin(const double* values, size_t count, double result) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    if (count >= 4) {
+        __m128d a = _mm_loadu_pd(values), b = _mm_loadu_pd(values + 2);
+        for (i = 4; i + 4 <= count; i += 4) {
+            a = _mm_min_pd(a, _mm_loadu_pd(values + i));
+            b = _mm_min_pd(b, _mm_loadu_pd(values + i + 2));
+        }
+        a = _mm_min_pd(a, b);
+        result = std::min(result, std::min(_mm_cvtsd_f64(a), _mm_cvtsd_f64(_mm_unpackhi_pd(a, a))));
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    if (count >= 4) {
+        float64x2_t a = vld1q_f64(values), b = vld1q_f64(values + 2);
+        for (i = 4; i + 4 <= count; i += 4) {
+            a = vminq_f64(a, vld1q_f64(values + i));
+            b = vminq_f64(b, vld1q_f64(values + i + 2));
+        }
+        result = std::min(result, vminvq_f64(vminq_f64(a, b)));
     }
+#endif
+    for (; i < count; ++i) {
+        result = std::min(result, values[i]);
+    }
+    return result;
 }
 
-std::string SwiftQTimeEdit::displayFormat() const {
-    if (timeEdit) {
-        return timeEdit->displayFormat().toStdString();
+static double plotMax(const double* values, size_t count, double result) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    if (count >= 4) {
+        __m128d a = _mm_loadu_pd(values), b = _mm_loadu_pd(values + 2);
+        for (i = 4; i + 4 <= count; i += 4) {
+            a = _mm_max_pd(a, _mm_loadu_pd(values + i));
+            b = _mm_max_pd(b, _mm_loadu_pd(values + i + 2));
+        }
+        a = _mm_max_pd(a, b);
+        result = std::max(result, std::max(_mm_cvtsd_f64(a), _mm_cvtsd_f64(_mm_unpackhi_pd(a, a))));
     }
-    return "";
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    if (count >= 4) {
+        float64x2_t a = vld1q_f64(values), b = vld1q_f64(values + 2);
+        for (i = 4; i + 4 <= count; i += 4) {
+            a = vmaxq_f64(a, vld1q_f64(values + i));
+            b = vmaxq_f64(b, vld1q_f64(values + i + 2));
+        }
+        result = std::max(result, vmaxvq_f64(vmaxq_f64(a, b)));
+    }
+#endif
+    for (; i < count; ++i) {
+        result = std::max(result, values[i]);
+    }
+    return result;
 }
 
-bool SwiftQTimeEdit::isReadOnly() const {
-    return timeEdit ? timeEdit->isReadOnly() : false;
-}
+struct SwiftPlotSeries {
+    QColor color;
+    double lineWidth;
+    bool implicitX;
+    std::vector<double> xs;                     // Empty when implicitX
+    std::vector<double> ys;
+    std::vector<std::vector<double>> mins;      // Pyramid levels
+    std::vector<std::vector<double>> maxs;
+    
+    size_t size() const { return ys.size(); }
+    double xAt(size_t i) const { return implicitX ? double(i) : xs[i]; }
+    
+    // First sample whose x is >= value
+    size_t lowerIndex(double value) const {
+        if (implicitX) {
+            if (!(value > 0)) {
+                return 0;
+            }
+            return value >= double(size()) ? size() : static_cast<size_t>(std::ceil(value));
+        }
+        return static_cast<size_t>(std::lower_bound(xs.begin(), xs.end(), value) - xs.begin());
+    }
+    
+    // First sample whose x is > value
+    size_t upperIndex(double value) const {
+        if (implicitX) {
+            if (!(value >= 0)) {
+                return 0;
+            }
+            return value >= double(size()) ? size() : static_cast<size_t>(std::floor(value)) + 1;
+        }
+        return static_cast<size_t>(std::upper_bound(xs.begin(), xs.end(), value) - xs.begin());
+    }
+    
+    // Recomputes every pyramid block that contains samples from `firstSample` on
+    void rebuildFrom(size_t firstSample) {
+        size_t childCount = size();
+        size_t first = firstSample / plotBaseBlock;
+        size_t level = 0;
+        for (size_t block = plotBaseBlock; childCount > 1 || level == 0; ++level) {
+            const size_t count = (childCount + block - 1) / block;
+            if (mins.size() <= level) {
+                mins.emplace_back();
+                maxs.emplace_back();
+            }
+            mins[level].resize(count);
+            maxs[level].resize(count);
+            for (size_t b = first; b < count; ++b) {
+                const size_t begin = b * block;
+                const size_t length = std::min(block, childCount - begin);
+                const double* lows = level == 0 ? ys.data() + begin : mins[level - 1].data() + begin;
+                const double* highs = level == 0 ? ys.data() + begin : maxs[level - 1].data() + begin;
+                mins[level][b] = plotMin(lows, length, std::numeric_limits<double>::infinity());
+                maxs[level][b] = plotMax(highs, length, -std::numeric_limits<double>::infinity());
+            }
+            childCount = count;
+            first /= plotFanout;
+            block = plotFanout;
+        }
+        mins.resize(level);
+        maxs.resize(level);
+    }
+    
+    // Min and max of y over samples [begin, end), folded into lo and hi
+    void rangeMinMax(size_t begin, size_t end, double& lo, double& hi) const {
+        size_t b0 = (begin + plotBaseBlock - 1) / plotBaseBlock;
+        size_t b1 = end / plotBaseBlock;
+        if (b0 >= b1) {
+            lo = plotMin(ys.data() + begin, end - begin, lo);
+            hi = plotMax(ys.data() + begin, end - begin, hi);
+            return;
+        }
+        // Partial blocks at both ends come from the samples themselves
+        lo = plotMin(ys.data() + begin, b0 * plotBaseBlock - begin, lo);
+        hi = plotMax(ys.data() + begin, b0 * plotBaseBlock - begin, hi);
+        lo = plotMin(ys.data() + b1 * plotBaseBlock, end - b1 * plotBaseBlock, lo);
+        hi = plotMax(ys.data() + b1 * plotBaseBlock, end - b1 * plotBaseBlock, hi);
+        // Then climb: blocks not aligned to the next level are taken at this one
+        for (size_t level = 0; b0 < b1; ++level) {
+            size_t p0 = (b0 + plotFanout - 1) / plotFanout;
+            size_t p1 = b1 / plotFanout;
+            if (level + 1 == mins.size() || p0 >= p1) {
+                p0 = p1 = b1;
+            }
+            const size_t headEnd = std::min(p0 * plotFanout, b1);
+            lo = plotMin(mins[level].data() + b0, headEnd - b0, lo);
+            hi = plotMax(maxs[level].data() + b0, headEnd - b0, hi);
+            if (p1 * plotFanout < b1 && p0 < p1) {
+                lo = plotMin(mins[level].data() + p1 * plotFanout, b1 - p1 * plotFanout, lo);
+                hi = plotMax(maxs[level].data() + p1 * plotFanout, b1 - p1 * plotFanout, hi);
+            }
+            if (p0 >= p1) {
+                break;
+            }
+            b0 = p0;
+            b1 = p1;
+        }
+    }
+};
 
-void SwiftQTimeEdit::setReadOnly(bool readOnly) {
-    if (timeEdit) {
-        timeEdit->setReadOnly(readOnly);
+class SwiftPlotWidget : public QWidget {
+public:
+    explicit SwiftPlotWidget(QWidget* parent)
+        : QWidget(parent), xMin(0), xMax(0), yMin(0), yMax(0), followWidth(0), lastPoints(0) {}
+    
+    std::vector<SwiftPlotSeries> series;
+    double xMin, xMax;
+    double yMin, yMax;
+    double followWidth;
+    int lastPoints;
+    
+    SwiftPlotSeries* find(int id) {
+        return id >= 0 && id < static_cast<int>(series.size()) ? &series[id] : nullptr;
     }
-}
+    
+protected:
+    void paintEvent(QPaintEvent*) override {
+        lastPoints = 0;
+        const int columns = width();
+        if (columns <= 0 || height() <= 0) {
+            return;
+        }
+        
+        // Visible x range
+        double left = xMin, right = xMax;
+        if (followWidth > 0 || left >= right) {
+            bool any = false;
+            for (const SwiftPlotSeries& s : series) {
+                if (s.size() == 0) {
+                    continue;
+                }
+                const double first = s.xAt(0), last = s.xAt(s.size() - 1);
+                left = any ? std::min(left, first) : first;
+                right = any ? std::max(right, last) : last;
+                any = true;
+            }
+            if (!any) {
+                return;
+            }
+            if (followWidth > 0) {
+                left = right - followWidth;
+            }
+        }
+        if (!(right > left)) {
+            return;
+        }
+        
+        // Visible y range
+        double bottom = yMin, top = yMax;
+        if (bottom >= top) {
+            bottom = std::numeric_limits<double>::infinity();
+            top = -std::numeric_limits<double>::infinity();
+            for (const SwiftPlotSeries& s : series) {
+                const size_t begin = s.lowerIndex(left), end = s.upperIndex(right);
+                if (begin < end) {
+                    s.rangeMinMax(begin, end, bottom, top);
+                }
+            }
+            if (!(top >= bottom)) {
+                return;
+            }
+            if (top == bottom) {
+                top += 0.5;
+                bottom -= 0.5;
+            }
+        }
+        
+        const double xScale = columns / (right - left);
+        const double yScale = height() / (top - bottom);
+        QPainter painter(this);
+        painter.setRenderHint(QPainter::Antialiasing);
+        for (const SwiftPlotSeries& s : series) {
+            const size_t begin = s.lowerIndex(left), end = s.upperIndex(right);
+            if (begin >= end) {
+                continue;
+            }
+            points.clear();
+            if (end - begin <= size_t(columns) * 2) {
+                // Few enough samples to draw as they are
+                for (size_t i = begin; i < end; ++i) {
+                    points.append(QPointF((s.xAt(i) - left) * xScale, (top - s.ys[i]) * yScale));
+                }
+            } else {
+                // One min/max pair per pixel column
+                const double step = (right - left) / columns;
+                size_t start = begin;
+                for (int column = 0; column < columns && start < end; ++column) {
+                    const size_t stop = column + 1 == columns ? end : std::min(end, std::max(start, s.upperIndex(left + (column + 1) * step)));
+                    if (stop == start) {
+                        continue;
+                    }
+                    double lo = std::numeric_limits<double>::infinity();
+                    double hi = -std::numeric_limits<double>::infinity();
+                    s.rangeMinMax(start, stop, lo, hi);
+                    const double x = column + 0.5;
+                    // Enter the column from the side nearer to where the line left the previous one
+                    const bool fallFirst = !points.isEmpty() && points.last().y() < (top - (lo + hi) / 2) * yScale;
+                    points.append(QPointF(x, (top - (fallFirst ? hi : lo)) * yScale));
+                    if (hi != lo) {
+                        points.append(QPointF(x, (top - (fallFirst ? lo : hi)) * yScale));
+                    }
+                    start = stop;
+                }
+            }
+            painter.setPen(QPen(s.color, s.lineWidth));
+            painter.drawPolyline(points.constData(), static_cast<int>(points.size()));
+            lastPoints += static_cast<int>(points.size());
+        }
+    }
+    
+private:
+    QPolygonF points;   // Reused between paints
+};
 
-// SwiftQDateTimeEdit implementation
-SwiftQDateTimeEdit::SwiftQDateTimeEdit() : SwiftQWidget(), dateTimeEdit(nullptr) {
+SwiftQPlot::SwiftQPlot() : SwiftQWidget(), plot(nullptr) {
     ensureWidget();
 }
 
-SwiftQDateTimeEdit::SwiftQDateTimeEdit(SwiftQWidget* parent) : SwiftQWidget(parent), dateTimeEdit(nullptr) {
+SwiftQPlot::SwiftQPlot(SwiftQWidget* parent) : SwiftQWidget(parent), plot(nullptr) {
     ensureWidget();
 }
 
-SwiftQDateTimeEdit::~SwiftQDateTimeEdit() {
+SwiftQPlot::~SwiftQPlot() {
     // Widget cleanup handled by base class
 }
 
-void SwiftQDateTimeEdit::ensureWidget() {
+void SwiftQPlot::ensureWidget() {
     if (!widget) {
-        dateTimeEdit = new QDateTimeEdit(parentWidget ? parentWidget->getQWidget() : nullptr);
-        widget = dateTimeEdit;
+        plot = new SwiftPlotWidget(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = plot;
+        SwiftLiveObjects::trackWidget(widget);
         setupEventFilter();
     }
 }
 
-void SwiftQDateTimeEdit::setDateTime(int year, int month, int day, int hour, int minute, int second) {
-    if (dateTimeEdit) {
-        dateTimeEdit->setDateTime(QDateTime(QDate(year, month, day), QTime(hour, minute, second)));
+int SwiftQPlot::addSeries(unsigned int argb, double lineWidth) {
+    if (!plot) {
+        return -1;
     }
+    SwiftPlotSeries series;
+    series.color = QColor::fromRgba(argb);
+    series.lineWidth = lineWidth;
+    series.implicitX = true;
+    plot->series.push_back(std::move(series));
+    return static_cast<int>(plot->series.size()) - 1;
 }
 
-void SwiftQDateTimeEdit::getDateTime(int* year, int* month, int* day, int* hour, int* minute, int* second) const {
-    if (dateTimeEdit) {
-        QDateTime dt = dateTimeEdit->dateTime();
-        QDate date = dt.date();
-        QTime time = dt.time();
-        if (year) *year = date.year();
-        if (month) *month = date.month();
-        if (day) *day = date.day();
-        if (hour) *hour = time.hour();
-        if (minute) *minute = time.minute();
-        if (second) *second = time.second();
+void SwiftQPlot::setSeriesData(int series, const double* x, const double* y, size_t count) {
+    SwiftPlotSeries* s = plot ? plot->find(series) : nullptr;
+    if (!s) {
+        return;
     }
+    if (!y) {
+        count = 0;
+    }
+    s->implicitX = x == nullptr;
+    s->xs.assign(x, x ? x + count : x);
+    s->ys.assign(y, y + count);
+    s->rebuildFrom(0);
+    plot->update();
 }
 
-void SwiftQDateTimeEdit::setMinimumDateTime(int year, int month, int day, int hour, int minute, int second) {
-    if (dateTimeEdit) {
-        dateTimeEdit->setMinimumDateTime(QDateTime(QDate(year, month, day), QTime(hour, minute, second)));
+void SwiftQPlot::appendSeriesData(int series, const double* x, const double* y, size_t count) {
+    SwiftPlotSeries* s = plot ? plot->find(series) : nullptr;
+    if (!s || !y || count == 0 || (x == nullptr) != s->implicitX) {
+        return;
     }
+    const size_t first = s->size();
+    if (x) {
+        s->xs.insert(s->xs.end(), x, x + count);
+    }
+    s->ys.insert(s->ys.end(), y, y + count);
+    s->rebuildFrom(first);
+    plot->update();
 }
 
-void SwiftQDateTimeEdit::getMinimumDateTime(int* year, int* month, int* day, int* hour, int* minute, int* second) const {
-    if (dateTimeEdit) {
-        QDateTime dt = dateTimeEdit->minimumDateTime();
-        QDate date = dt.date();
-        QTime time = dt.time();
-        if (year) *year = date.year();
-        if (month) *month = date.month();
-        if (day) *day = date.day();
-        if (hour) *hour = time.hour();
-        if (minute) *minute = time.minute();
-        if (second) *second = time.second();
-    }
+size_t SwiftQPlot::seriesSampleCount(int series) const {
+    SwiftPlotSeries* s = plot ? plot->find(series) : nullptr;
+    return s ? s->size() : 0;
 }
 
-void SwiftQDateTimeEdit::setMaximumDateTime(int year, int month, int day, int hour, int minute, int second) {
-    if (dateTimeEdit) {
-        dateTimeEdit->setMaximumDateTime(QDateTime(QDate(year, month, day), QTime(hour, minute, second)));
+bool SwiftQPlot::seriesRangeMinMax(int series, size_t begin, size_t end, double* min, double* max) const {
+    SwiftPlotSeries* s = plot ? plot->find(series) : nullptr;
+    if (!s || begin >= end || end > s->size()) {
+        return false;
     }
+    double lo = std::numeric_limits<double>::infinity();
+    double hi = -std::numeric_limits<double>::infinity();
+    s->rangeMinMax(begin, end, lo, hi);
+    if (min) *min = lo;
+    if (max) *max = hi;
+    return true;
 }
 
-void SwiftQDateTimeEdit::getMaximumDateTime(int* year, int* month, int* day, int* hour, int* minute, int* second) const {
-    if (dateTimeEdit) {
-        QDateTime dt = dateTimeEdit->maximumDateTime();
-        QDate date = dt.date();
-        QTime time = dt.time();
-        if (year) *year = date.year();
-        if (month) *month = date.month();
-        if (day) *day = date.day();
-        if (hour) *hour = time.hour();
-        if (minute) *minute = time.minute();
-        if (second) *second = time.second();
+void SwiftQPlot::clearSeries(int series) {
+    SwiftPlotSeries* s = plot ? plot->find(series) : nullptr;
+    if (s) {
+        s->xs.clear();
+        s->ys.clear();
+        s->rebuildFrom(0);
+        plot->update();
     }
 }
 
-void SwiftQDateTimeEdit::setDisplayFormat(const std::string& format) {
-    if (dateTimeEdit) {
-        dateTimeEdit->setDisplayFormat(QString::fromStdString(format));
+void SwiftQPlot::setXRange(double xMin, double xMax) {
+    if (plot) {
+        plot->xMin = xMin;
+        plot->xMax = xMax;
+        plot->update();
     }
 }
 
-std::string SwiftQDateTimeEdit::displayFormat() const {
-    if (dateTimeEdit) {
-        return dateTimeEdit->displayFormat().toStdString();
+void SwiftQPlot::setFollowWindow(double width) {
+    if (plot) {
+        plot->followWidth = width > 0 ? width : 0;
+        plot->update();
     }
-    return "";
 }
 
-void SwiftQDateTimeEdit::setCalendarPopup(bool enable) {
-    if (dateTimeEdit) {
-        dateTimeEdit->setCalendarPopup(enable);
+void SwiftQPlot::setYRange(double yMin, double yMax) {
+    if (plot) {
+        plot->yMin = yMin;
+        plot->yMax = yMax;
+        plot->update();
     }
 }
 
-bool SwiftQDateTimeEdit::calendarPopup() const {
-    return dateTimeEdit ? dateTimeEdit->calendarPopup() : false;
+int SwiftQPlot::lastPointCount() const {
+    return plot ? plot->lastPoints : 0;
 }
 
-bool SwiftQDateTimeEdit::isReadOnly() const {
-    return dateTimeEdit ? dateTimeEdit->isReadOnly() : false;
-}
+// SwiftQTiledImageView implementation
 
-void SwiftQDateTimeEdit::setReadOnly(bool readOnly) {
-    if (dateTimeEdit) {
-        dateTimeEdit->setReadOnly(readOnly);
+static const int tiledImageTileSize = 256;
+
+class SwiftTiledImageWidget : public QWidget {
+public:
+    explicit SwiftTiledImageWidget(QWidget* parent)
+        : QWidget(parent), zoomFactor(1), interactive(true), originX(0), originY(0), maxLevel(0),
+          generation(0), clipSupported(true), dragging(false) {
+        cache.setMaxCost(96 * 1024 * 1024);
+        pool.setMaxThreadCount(std::max(1, std::min(4, QThread::idealThreadCount())));
     }
-}
+    
+    ~SwiftTiledImageWidget() override {
+        // Decoders post their results to this widget, so none may outlive it
+        cancelPending();
+        pool.clear();
+        pool.waitForDone();
+    }
+    
+    bool load(const QString& file) {
+        cancelPending();
+        ++generation;
+        cache.clear();
+        failed.clear();
+        QImageReader reader(file);
+        const QSize size = reader.size();
+        if (!size.isValid() || size.isEmpty()) {
+            path.clear();
+            fullSize = QSize();
+            update();
+            return false;
+        }
+        path = file;
+        fullSize = size;
+        clipSupported = reader.supportsOption(QImageIOHandler::ClipRect)
+            && reader.supportsOption(QImageIOHandler::ScaledSize);
+        maxLevel = 0;
+        while ((fullSize.width() >> maxLevel) > tiledImageTileSize || (fullSize.height() >> maxLevel) > tiledImageTileSize) {
+            ++maxLevel;
+        }
+        fitToView();
+        return true;
+    }
+    
+    void setZoom(double zoom, double anchorX, double anchorY) {
+        if (fullSize.isEmpty()) {
+            return;
+        }
+        const double fit = std::min(double(std::max(1, width())) / fullSize.width(), double(std::max(1, height())) / fullSize.height());
+        zoom = std::clamp(zoom, std::min(fit, 1.0) / 4, 64.0);
+        const double imageX = originX + anchorX / zoomFactor;
+        const double imageY = originY + anchorY / zoomFactor;
+        zoomFactor = zoom;
+        originX = imageX - anchorX / zoomFactor;
+        originY = imageY - anchorY / zoomFactor;
+        update();
+    }
+    
+    void panBy(double dx, double dy) {
+        originX -= dx / zoomFactor;
+        originY -= dy / zoomFactor;
+        update();
+    }
+    
+    void fitToView() {
+        if (fullSize.isEmpty()) {
+            update();
+            return;
+        }
+        zoomFactor = std::min(double(std::max(1, width())) / fullSize.width(), double(std::max(1, height())) / fullSize.height());
+        originX = (fullSize.width() - width() / zoomFactor) / 2;
+        originY = (fullSize.height() - height() / zoomFactor) / 2;
+        update();
+    }
+    
+    QSize fullSize;
+    double zoomFactor;
+    QCache<quint64, QPixmap> cache;     // Tile key to tile, cost in bytes
+    QHash<quint64, std::shared_ptr<std::atomic<bool>>> pending;   // Tile key to cancel flag
+    QSet<quint64> failed;               // Request and tile keys that decoded to nothing this load
+    bool interactive;
+    
+protected:
+    void paintEvent(QPaintEvent*) override {
+        if (fullSize.isEmpty()) {
+            return;
+        }
+        QPainter painter(this);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        
+        int level = 0;
+        while (level < maxLevel && zoomFactor <= 1.0 / double(2 << level)) {
+            ++level;
+        }
+        const double scale = double(1 << level);
+        const QRectF visible = QRectF(originX, originY, width() / zoomFactor, height() / zoomFactor)
+            .intersected(QRectF(QPointF(0, 0), QSizeF(fullSize)));
+        if (visible.isEmpty()) {
+            return;
+        }
+        const double tileSpan = tiledImageTileSize * scale;     // Full-resolution pixels per tile
+        const int tx0 = int(visible.left() / tileSpan), tx1 = int(std::ceil(visible.right() / tileSpan));
+        const int ty0 = int(visible.top() / tileSpan), ty1 = int(std::ceil(visible.bottom() / tileSpan));
+        const QPointF center = visible.center();
+        
+        QSet<quint64> wanted;
+        for (int ty = ty0; ty < ty1; ++ty) {
+            for (int tx = tx0; tx < tx1; ++tx) {
+                const QRect source = tileSource(level, tx, ty);
+                if (source.isEmpty()) {
+                    continue;
+                }
+                const QRectF target = toWidget(source);
+                const quint64 key = tileKey(level, tx, ty);
+                if (QPixmap* tile = cache.object(key)) {
+                    painter.drawPixmap(target, *tile, QRectF(tile->rect()));
+                    continue;
+                }
+                wanted.insert(key);
+                const QPointF offset = QRectF(source).center() - center;
+                request(level, tx, ty, -int(std::hypot(offset.x(), offset.y()) / tileSpan));
+                drawCoarser(painter, level, source);
+            }
+        }
+        
+        // Tiles that scrolled or zoomed out of view are not worth decoding anymore
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (!wanted.contains(it.key()) && (it.key() >> 56) != 0xFF) {
+                it.value()->store(true);
+                it = pending.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    
+    void mousePressEvent(QMouseEvent* event) override {
+        if (interactive && event->button() == Qt::LeftButton) {
+            dragging = true;
+            lastDrag = event->position();
+        }
+    }
+    
+    void mouseMoveEvent(QMouseEvent* event) override {
+        if (dragging) {
+            const QPointF delta = event->position() - lastDrag;
+            lastDrag = event->position();
+            panBy(delta.x(), delta.y());
+        }
+    }
+    
+    void mouseReleaseEvent(QMouseEvent*) override {
+        dragging = false;
+    }
+    
+    void wheelEvent(QWheelEvent* event) override {
+        if (!interactive) {
+            event->ignore();
+            return;
+        }
+        setZoom(zoomFactor * std::pow(1.0015, event->angleDelta().y()), event->position().x(), event->position().y());
+    }
+    
+private:
+    QString path;
+    double originX, originY;            // Image point at the widget's top-left corner
+    int maxLevel;                       // First level that fits in one tile
+    quint64 generation;                 // Bumped per load so stale decodes are dropped
+    bool clipSupported;
+    bool dragging;
+    QPointF lastDrag;
+    QThreadPool pool;
+    
+    // Level in the top byte (0xFF marks whole-level decodes), then row and column
+    static quint64 tileKey(int level, int tx, int ty) {
+        return (quint64(level) << 56) | (quint64(ty) << 28) | quint64(tx);
+    }
+    
+    // Full-resolution rectangle covered by a tile
+    QRect tileSource(int level, int tx, int ty) const {
+        const int span = tiledImageTileSize << level;
+        return QRect(tx * span, ty * span, span, span).intersected(QRect(QPoint(0, 0), fullSize));
+    }
+    
+    // Size the tile decodes to
+    static QSize tileOutputSize(const QRect& source, int level) {
+        return QSize(std::max(1, (source.width() + (1 << level) - 1) >> level),
+                     std::max(1, (source.height() + (1 << level) - 1) >> level));
+    }
+    
+    QRectF toWidget(const QRectF& source) const {
+        return QRectF((source.x() - originX) * zoomFactor, (source.y() - originY) * zoomFactor,
+                      source.width() * zoomFactor, source.height() * zoomFactor);
+    }
+    
+    // Stands in for a missing tile with the nearest cached coarser level
+    void drawCoarser(QPainter& painter, int level, const QRect& source) {
+        for (int coarse = level + 1; coarse <= maxLevel; ++coarse) {
+            const int span = tiledImageTileSize << coarse;
+            const int tx = source.x() / span, ty = source.y() / span;
+            QPixmap* tile = cache.object(tileKey(coarse, tx, ty));
+            if (!tile) {
+                continue;
+            }
+            // Edge tiles are rounded up separately per axis, so the two scales can differ
+            const QRect covering = tileSource(coarse, tx, ty);
+            const double factorX = double(tile->width()) / covering.width();
+            const double factorY = double(tile->height()) / covering.height();
+            const QRectF part((source.x() - covering.x()) * factorX, (source.y() - covering.y()) * factorY,
+                              source.width() * factorX, source.height() * factorY);
+            painter.drawPixmap(toWidget(source), *tile, part);
+            return;
+        }
+    }
+    
+    void request(int level, int tx, int ty, int priority) {
+        const quint64 key = clipSupported ? tileKey(level, tx, ty) : tileKey(0xFF, level, 0);
+        // Failed decodes are not retried; the coarser level keeps standing in for them
+        if (pending.contains(key) || failed.contains(key) || failed.contains(tileKey(level, tx, ty))) {
+            return;
+        }
+        auto cancelled = std::make_shared<std::atomic<bool>>(false);
+        pending.insert(key, cancelled);
+        const QString file = path;
+        const quint64 requestGeneration = generation;
+        
+        if (clipSupported) {
+            const QRect source = tileSource(level, tx, ty);
+            const QSize output = tileOutputSize(source, level);
+            pool.start([this, file, source, output, key, requestGeneration, cancelled]() {
+                if (cancelled->load()) {
+                    return;
+                }
+                QImageReader reader(file);
+                reader.setClipRect(source);
+                reader.setScaledSize(output);
+                QImage image = reader.read();
+                if (cancelled->load()) {
+                    return;
+                }
+                std::vector<std::pair<quint64, QImage>> tiles;
+                tiles.emplace_back(key, std::move(image));
+                QMetaObject::invokeMethod(this, [this, key, requestGeneration, tiles = std::move(tiles)]() {
+                    deliver(key, requestGeneration, tiles);
+                }, Qt::QueuedConnection);
+            }, priority);
+            return;
+        }
+        
+        // Formats without clip support decode a whole level once and are cut into tiles
+        const QSize fullLevel = tileOutputSize(QRect(QPoint(0, 0), fullSize), level);
+        const int levelSpan = tiledImageTileSize << level;
+        const int columns = (fullSize.width() + levelSpan - 1) / levelSpan;
+        const int rows = (fullSize.height() + levelSpan - 1) / levelSpan;
+        pool.start([this, file, fullLevel, level, columns, rows, key, requestGeneration, cancelled]() {
+            if (cancelled->load()) {
+                return;
+            }
+            QImageReader reader(file);
+            reader.setScaledSize(fullLevel);
+            const QImage image = reader.read();
+            std::vector<std::pair<quint64, QImage>> tiles;
+            for (int row = 0; row < rows && !image.isNull(); ++row) {
+                for (int column = 0; column < columns; ++column) {
+                    // Edge tiles are cut to the image; copy() would pad them to a full tile
+                    const QRect cell(column * tiledImageTileSize, row * tiledImageTileSize, tiledImageTileSize, tiledImageTileSize);
+                    tiles.emplace_back(tileKey(level, column, row), image.copy(cell.intersected(image.rect())));
+                }
+            }
+            QMetaObject::invokeMethod(this, [this, key, requestGeneration, tiles = std::move(tiles)]() {
+                deliver(key, requestGeneration, tiles);
+            }, Qt::QueuedConnection);
+        });
+    }
+    
+    void deliver(quint64 key, quint64 requestGeneration, const std::vector<std::pair<quint64, QImage>>& tiles) {
+        if (requestGeneration != generation) {
+            return;
+        }
+        pending.remove(key);
+        bool decoded = false;
+        for (const auto& tile : tiles) {
+            if (tile.second.isNull()) {
+                failed.insert(tile.first);
+            } else {
+                decoded = true;
+            }
+        }
+        if (!decoded) {
+            failed.insert(key);
+        }
+        // Visible tiles go in last so a whole-level decode cannot evict them from the LRU
+        const QRectF visible(originX, originY, width() / zoomFactor, height() / zoomFactor);
+        for (int pass = 0; pass < 2; ++pass) {
+            for (const auto& tile : tiles) {
+                const QRect source = tileSource(int(tile.first >> 56), int(tile.first & 0xFFFFFFF), int((tile.first >> 28) & 0xFFFFFFF));
+                if (tile.second.isNull() || visible.intersects(source) != (pass == 1)) {
+                    continue;
+                }
+                QPixmap* pixmap = new QPixmap(QPixmap::fromImage(tile.second));
+                const qsizetype bytes = qsizetype(pixmap->width()) * pixmap->height() * 4;
+                cache.insert(tile.first, pixmap, bytes);
+            }
+        }
+        update();
+    }
+    
+    void cancelPending() {
+        for (const auto& flag : pending) {
+            flag->store(true);
+        }
+        pending.clear();
+    }
+};
 
-// SwiftQDial implementation
-SwiftQDial::SwiftQDial() : SwiftQWidget(), dial(nullptr) {
+SwiftQTiledImageView::SwiftQTiledImageView() : SwiftQWidget(), viewer(nullptr) {
     ensureWidget();
 }
 
-SwiftQDial::SwiftQDial(SwiftQWidget* parent) : SwiftQWidget(parent), dial(nullptr) {
+SwiftQTiledImageView::SwiftQTiledImageView(SwiftQWidget* parent) : SwiftQWidget(parent), viewer(nullptr) {
     ensureWidget();
 }
 
-SwiftQDial::~SwiftQDial() {
+SwiftQTiledImageView::~SwiftQTiledImageView() {
     // Widget cleanup handled by base class
 }
 
-void SwiftQDial::ensureWidget() {
+void SwiftQTiledImageView::ensureWidget() {
     if (!widget) {
-        dial = new QDial(parentWidget ? parentWidget->getQWidget() : nullptr);
-        widget = dial;
+        viewer = new SwiftTiledImageWidget(parentWidget ? parentWidget->getQWidget() : nullptr);
+        widget = viewer;
+        SwiftLiveObjects::trackWidget(widget);
         setupEventFilter();
     }
 }
 
-int SwiftQDial::value() const {
-    return dial ? dial->value() : 0;
-}
-
-void SwiftQDial::setValue(int value) {
-    if (dial) {
-        dial->setValue(value);
-    }
-}
-
-int SwiftQDial::minimum() const {
-    return dial ? dial->minimum() : 0;
-}
-
-void SwiftQDial::setMinimum(int min) {
-    if (dial) {
-        dial->setMinimum(min);
-    }
-}
-
-int SwiftQDial::maximum() const {
-    return dial ? dial->maximum() : 99;
-}
-
-void SwiftQDial::setMaximum(int max) {
-    if (dial) {
-        dial->setMaximum(max);
-    }
+bool SwiftQTiledImageView::load(const std::string& path) {
+    return viewer ? viewer->load(QString::fromStdString(path)) : false;
 }
 
-void SwiftQDial::setRange(int min, int max) {
-    if (dial) {
-        dial->setRange(min, max);
-    }
+int SwiftQTiledImageView::imageWidth() const {
+    return viewer ? viewer->fullSize.width() : 0;
 }
 
-int SwiftQDial::singleStep() const {
-    return dial ? dial->singleStep() : 1;
+int SwiftQTiledImageView::imageHeight() const {
+    return viewer ? viewer->fullSize.height() : 0;
 }
 
-void SwiftQDial::setSingleStep(int step) {
-    if (dial) {
-        dial->setSingleStep(step);
+void SwiftQTiledImageView::setZoom(double zoom, double anchorX, double anchorY) {
+    if (viewer) {
+        viewer->setZoom(zoom, anchorX, anchorY);
     }
 }
 
-int SwiftQDial::pageStep() const {
-    return dial ? dial->pageStep() : 10;
+double SwiftQTiledImageView::zoom() const {
+    return viewer ? viewer->zoomFactor : 1.0;
 }
 
-void SwiftQDial::setPageStep(int step) {
-    if (dial) {
-        dial->setPageStep(step);
+void SwiftQTiledImageView::panBy(double dx, double dy) {
+    if (viewer) {
+        viewer->panBy(dx, dy);
     }
 }
 
-bool SwiftQDial::notchesVisible() const {
-    return dial ? dial->notchesVisible() : false;
-}
-
-void SwiftQDial::setNotchesVisible(bool visible) {
-    if (dial) {
-        dial->setNotchesVisible(visible);
+void SwiftQTiledImageView::fitToView() {
+    if (viewer) {
+        viewer->fitToView();
     }
 }
 
-int SwiftQDial::notchSize() const {
-    return dial ? dial->notchSize() : 1;
-}
-
-void SwiftQDial::setNotchTarget(double target) {
-    if (dial) {
-        dial->setNotchTarget(target);
+void SwiftQTiledImageView::setInteractive(bool interactive) {
+    if (viewer) {
+        viewer->interactive = interactive;
     }
 }
 
-double SwiftQDial::notchTarget() const {
-    return dial ? dial->notchTarget() : 3.7;
-}
-
-bool SwiftQDial::wrapping() const {
-    return dial ? dial->wrapping() : false;
-}
-
-void SwiftQDial::setWrapping(bool wrap) {
-    if (dial) {
-        dial->setWrapping(wrap);
+void SwiftQTiledImageView::setCacheLimit(long long bytes) {
+    if (viewer) {
+        viewer->cache.setMaxCost(static_cast<qsizetype>(std::max(0LL, bytes)));
     }
 }
 
-// SwiftQLCDNumber implementation
-SwiftQLCDNumber::SwiftQLCDNumber() : SwiftQWidget(), lcdNumber(nullptr) {
-    ensureWidget();
-}
-
-SwiftQLCDNumber::SwiftQLCDNumber(SwiftQWidget* parent) : SwiftQWidget(parent), lcdNumber(nullptr) {
-    ensureWidget();
-}
-
-SwiftQLCDNumber::SwiftQLCDNumber(int numDigits, SwiftQWidget* parent) : SwiftQWidget(parent), lcdNumber(nullptr) {
-    ensureWidget();
-    if (lcdNumber) {
-        lcdNumber->setDigitCount(numDigits);
-    }
+long long SwiftQTiledImageView::cachedBytes() const {
+    return viewer ? static_cast<long long>(viewer->cache.totalCost()) : 0;
 }
 
-SwiftQLCDNumber::~SwiftQLCDNumber() {
-    // Widget cleanup handled by base class
+int SwiftQTiledImageView::pendingTileCount() const {
+    return viewer ? static_cast<int>(viewer->pending.size()) : 0;
 }
 
-void SwiftQLCDNumber::ensureWidget() {
-    if (!widget) {
-        lcdNumber = new QLCDNumber(parentWidget ? parentWidget->getQWidget() : nullptr);
-        widget = lcdNumber;
-        setupEventFilter();
-    }
-}
+// SwiftRenderBatch implementation
+struct SwiftRenderJob {
+    QPointer<QWidget> widget;
+    QString path;
+    int x, y, width, height;
+};
 
-void SwiftQLCDNumber::display(int value) {
-    if (lcdNumber) {
-        lcdNumber->display(value);
-    }
+struct SwiftRenderBatchData {
+    std::vector<SwiftRenderJob> jobs;
+    std::vector<char> results;
+    double devicePixelRatio = 1.0;
+    int threadCount = 0;
+    int quality = -1;
+};
+
+SwiftRenderBatch::SwiftRenderBatch() : data(std::make_shared<SwiftRenderBatchData>()) {
 }
 
-void SwiftQLCDNumber::display(double value) {
-    if (lcdNumber) {
-        lcdNumber->display(value);
-    }
+void SwiftRenderBatch::setDevicePixelRatio(double ratio) {
+    data->devicePixelRatio = ratio > 0 ? ratio : 1.0;
 }
 
-void SwiftQLCDNumber::display(const std::string& text) {
-    if (lcdNumber) {
-        lcdNumber->display(QString::fromStdString(text));
-    }
+void SwiftRenderBatch::setThreadCount(int count) {
+    data->threadCount = std::max(0, count);
 }
 
-int SwiftQLCDNumber::intValue() const {
-    return lcdNumber ? lcdNumber->intValue() : 0;
+void SwiftRenderBatch::setQuality(int quality) {
+    data->quality = quality;
 }
 
-double SwiftQLCDNumber::value() const {
-    return lcdNumber ? lcdNumber->value() : 0.0;
+void SwiftRenderBatch::add(SwiftQWidget* widget, const std::string& path, int x, int y, int width, int height) {
+    // Create the widget now so run() only renders
+    data->jobs.push_back({widget ? widget->getQWidget() : nullptr, QString::fromStdString(path), x, y, width, height});
 }
 
-int SwiftQLCDNumber::digitCount() const {
-    return lcdNumber ? lcdNumber->digitCount() : 5;
+int SwiftRenderBatch::count() const {
+    return static_cast<int>(data->jobs.size());
 }
 
-void SwiftQLCDNumber::setDigitCount(int count) {
-    if (lcdNumber) {
-        lcdNumber->setDigitCount(count);
-    }
+void SwiftRenderBatch::clear() {
+    data->jobs.clear();
+    data->results.clear();
 }
 
-void SwiftQLCDNumber::setMode(int mode) {
-    if (lcdNumber) {
-        lcdNumber->setMode(static_cast<QLCDNumber::Mode>(mode));
+int SwiftRenderBatch::run() {
+    SwiftRenderBatchData& batch = *data;
+    const int threads = batch.threadCount > 0 ? batch.threadCount : std::max(1, QThread::idealThreadCount());
+    batch.results.assign(batch.jobs.size(), 0);
+    
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+    // Bounds the rendered images waiting for a worker, so memory stays flat however long the batch
+    QSemaphore available(threads * 2);
+    for (size_t i = 0; i < batch.jobs.size(); ++i) {
+        const SwiftRenderJob& job = batch.jobs[i];
+        QWidget* widget = job.widget.data();
+        if (!widget) {
+            continue;
+        }
+        const QRect region = renderRegion(widget, job.x, job.y, job.width, job.height);
+        if (region.isEmpty()) {
+            continue;
+        }
+        available.acquire();
+        QImage image = renderWidget(widget, region, batch.devicePixelRatio);
+        // Each worker writes only its own result slot, and results is not resized until run returns
+        char* result = &batch.results[i];
+        pool.start([image = std::move(image), path = job.path, quality = batch.quality, result, &available]() {
+            QImageWriter writer(path);
+            writer.setQuality(quality);
+            *result = !image.isNull() && writer.write(image) ? 1 : 0;
+            available.release();
+        });
     }
+    pool.waitForDone();
+    return static_cast<int>(std::count(batch.results.begin(), batch.results.end(), 1));
 }
 
-int SwiftQLCDNumber::mode() const {
-    return lcdNumber ? static_cast<int>(lcdNumber->mode()) : 1;
+bool SwiftRenderBatch::succeeded(int index) const {
+    return index >= 0 && index < static_cast<int>(data->results.size()) && data->results[index] != 0;
 }
 
-void SwiftQLCDNumber::setSegmentStyle(int style) {
-    if (lcdNumber) {
-        lcdNumber->setSegmentStyle(static_cast<QLCDNumber::SegmentStyle>(style));
+// SwiftWidgetSnapshot implementation
+// Layout: "QWSN", u16 version, u16 reserved, u32 string count, u32 widget count, the string
+// table (u32 length, UTF-8 bytes, NUL) and the widget records in pre-order: u32 class,
+// u32 object name, i32 x, y, width, height, u32 flags, u64 event mask, u32 child count,
+// u32 property count, then per property u32 name, u32 kind and an 8-byte value (bool and
+// integer as i64, a double, or a string index for strings).
+static const char swiftSnapshotMagic[4] = {'Q', 'W', 'S', 'N'};
+static const quint16 swiftSnapshotVersion = 1;
+static const size_t swiftSnapshotRecordSize = 44;
+static const size_t swiftSnapshotPropertySize = 16;
+
+enum : quint32 {
+    SnapshotBool = 0,
+    SnapshotInteger = 1,
+    SnapshotReal = 2,
+    SnapshotString = 3
+};
+
+enum : quint32 {
+    SnapshotHidden = 1
+};
+
+struct SwiftSnapshotProperty {
+    quint32 name;
+    quint32 kind;
+    qint64 integer;   // Bool, integer or string index
+    double real;
+};
+
+struct SwiftSnapshotRecord {
+    quint32 className;
+    quint32 objectName;
+    qint32 x;
+    qint32 y;
+    qint32 width;
+    qint32 height;
+    quint32 flags;
+    quint64 eventMask;
+    quint32 childCount;
+    quint32 firstProperty;
+    quint32 propertyCount;
+};
+
+struct SwiftWidgetSnapshotData {
+    QByteArray owned;                  // Captured or copied bytes
+    std::shared_ptr<QFile> file;       // Keeps the mapping of a loaded file alive
+    const unsigned char* bytes = nullptr;
+    size_t size = 0;
+    std::vector<std::pair<const char*, quint32>> strings;  // Into bytes, NUL-terminated
+    std::vector<SwiftSnapshotRecord> records;
+    std::vector<SwiftSnapshotProperty> properties;
+    std::vector<QPointer<QWidget>> restored;
+};
+
+// A property value in one of the kinds the format carries
+struct SwiftSnapshotValue {
+    quint32 kind = SnapshotBool;
+    qint64 integer = 0;
+    double real = 0;
+    QString text;
+    
+    bool operator==(const SwiftSnapshotValue& other) const {
+        return kind == other.kind && integer == other.integer && real == other.real && text == other.text;
+    }
+};
+
+static bool readSnapshotValue(const QMetaProperty& property, const QObject* object, SwiftSnapshotValue& out) {
+    const QVariant value = property.read(object);
+    if (!value.isValid()) {
+        return false;
+    }
+    if (property.isEnumType()) {
+        bool ok = false;
+        out.kind = SnapshotInteger;
+        out.integer = value.toLongLong(&ok);
+        return ok;
+    }
+    switch (property.metaType().id()) {
+    case QMetaType::Bool:
+        out.kind = SnapshotBool;
+        out.integer = value.toBool() ? 1 : 0;
+        return true;
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+        out.kind = SnapshotInteger;
+        out.integer = value.toLongLong();
+        return true;
+    case QMetaType::Double:
+    case QMetaType::Float:
+        out.kind = SnapshotReal;
+        out.real = value.toDouble();
+        return true;
+    case QMetaType::QString:
+        out.kind = SnapshotString;
+        out.text = value.toString();
+        return true;
+    default:
+        return false;
     }
 }
 
-int SwiftQLCDNumber::segmentStyle() const {
-    return lcdNumber ? static_cast<int>(lcdNumber->segmentStyle()) : 1;
+// The stock widgets a snapshot can recreate, by Qt class name
+static QWidget* createSnapshotWidget(const QByteArray& className, QWidget* parent) {
+    using Factory = QWidget* (*)(QWidget*);
+    static const QHash<QByteArray, Factory> factories = {
+        {"QWidget", [](QWidget* p) -> QWidget* { return new QWidget(p); }},
+        {"QFrame", [](QWidget* p) -> QWidget* { return new QFrame(p); }},
+        {"QLabel", [](QWidget* p) -> QWidget* { return new QLabel(p); }},
+        {"QPushButton", [](QWidget* p) -> QWidget* { return new QPushButton(p); }},
+        {"QLineEdit", [](QWidget* p) -> QWidget* { return new QLineEdit(p); }},
+        {"QTextEdit", [](QWidget* p) -> QWidget* { return new QTextEdit(p); }},
+        {"QCheckBox", [](QWidget* p) -> QWidget* { return new QCheckBox(p); }},
+        {"QRadioButton", [](QWidget* p) -> QWidget* { return new QRadioButton(p); }},
+        {"QComboBox", [](QWidget* p) -> QWidget* { return new QComboBox(p); }},
+        {"QGroupBox", [](QWidget* p) -> QWidget* { return new QGroupBox(p); }},
+        {"QSlider", [](QWidget* p) -> QWidget* { return new QSlider(p); }},
+        {"QProgressBar", [](QWidget* p) -> QWidget* { return new QProgressBar(p); }},
+        {"QScrollArea", [](QWidget* p) -> QWidget* { return new QScrollArea(p); }},
+        {"QTabWidget", [](QWidget* p) -> QWidget* { return new QTabWidget(p); }},
+        {"QSplitter", [](QWidget* p) -> QWidget* { return new QSplitter(p); }},
+        {"QSpinBox", [](QWidget* p) -> QWidget* { return new QSpinBox(p); }},
+        {"QDoubleSpinBox", [](QWidget* p) -> QWidget* { return new QDoubleSpinBox(p); }},
+        {"QDateEdit", [](QWidget* p) -> QWidget* { return new QDateEdit(p); }},
+        {"QTimeEdit", [](QWidget* p) -> QWidget* { return new QTimeEdit(p); }},
+        {"QDateTimeEdit", [](QWidget* p) -> QWidget* { return new QDateTimeEdit(p); }},
+        {"QDial", [](QWidget* p) -> QWidget* { return new QDial(p); }},
+        {"QLCDNumber", [](QWidget* p) -> QWidget* { return new QLCDNumber(p); }},
+        {"QCalendarWidget", [](QWidget* p) -> QWidget* { return new QCalendarWidget(p); }},
+    };
+    Factory factory = factories.value(className, nullptr);
+    QWidget* widget = factory ? factory(parent) : nullptr;
+    SwiftLiveObjects::trackWidget(widget);
+    return widget;
 }
 
-bool SwiftQLCDNumber::smallDecimalPoint() const {
-    return lcdNumber ? lcdNumber->smallDecimalPoint() : false;
+static bool isSnapshotContainer(const QByteArray& className) {
+    return className == "QWidget" || className == "QFrame" || className == "QGroupBox" || className == "QSplitter";
 }
 
-void SwiftQLCDNumber::setSmallDecimalPoint(bool small) {
-    if (lcdNumber) {
-        lcdNumber->setSmallDecimalPoint(small);
+// Whether a property is written to snapshots at all
+static bool isSnapshotProperty(const QMetaProperty& property) {
+    return property.isWritable() && property.isStored() && qstrcmp(property.name(), "visible") != 0;
+}
+
+// Property values of a default-constructed widget, so snapshots only carry what differs.
+// Keyed by property index; empty for classes the snapshot cannot construct.
+static const QHash<int, SwiftSnapshotValue>& snapshotDefaults(const QMetaObject* meta) {
+    static QHash<const QMetaObject*, QHash<int, SwiftSnapshotValue>> cache;
+    auto it = cache.find(meta);
+    if (it != cache.end()) {
+        return it.value();
+    }
+    QHash<int, SwiftSnapshotValue> defaults;
+    if (QWidget* prototype = createSnapshotWidget(QByteArray(meta->className()), nullptr)) {
+        for (int i = QObject::staticMetaObject.propertyCount(); i < meta->propertyCount(); ++i) {
+            const QMetaProperty property = meta->property(i);
+            SwiftSnapshotValue value;
+            if (isSnapshotProperty(property) && readSnapshotValue(property, prototype, value)) {
+                defaults.insert(i, value);
+            }
+        }
+        delete prototype;
     }
+    return cache.insert(meta, defaults).value();
 }
 
-// SwiftQCalendarWidget implementation
-SwiftQCalendarWidget::SwiftQCalendarWidget() : SwiftQWidget(), calendarWidget(nullptr) {
-    ensureWidget();
+struct SwiftSnapshotWriter {
+    QHash<QByteArray, quint32> stringIndex;
+    std::vector<QByteArray> strings;
+    std::vector<SwiftSnapshotRecord> records;
+    std::vector<SwiftSnapshotProperty> properties;
+    
+    quint32 intern(const QByteArray& text) {
+        auto it = stringIndex.constFind(text);
+        if (it != stringIndex.constEnd()) {
+            return it.value();
+        }
+        const quint32 index = static_cast<quint32>(strings.size());
+        strings.push_back(text);
+        stringIndex.insert(text, index);
+        return index;
+    }
+    
+    void capture(QWidget* widget) {
+        const QMetaObject* meta = widget->metaObject();
+        const QByteArray className(meta->className());
+        const QRect geometry = widget->geometry();
+        
+        SwiftSnapshotRecord record{};
+        record.className = intern(className);
+        record.objectName = intern(widget->objectName().toUtf8());
+        record.x = geometry.x();
+        record.y = geometry.y();
+        record.width = geometry.width();
+        record.height = geometry.height();
+        record.flags = widget->isHidden() ? SnapshotHidden : 0;
+        if (SwiftQWidget* wrapper = SwiftWidgetRegistry::find(widget)) {
+            record.eventMask = wrapper->eventSubscriptionMask();
+        }
+        
+        record.firstProperty = static_cast<quint32>(properties.size());
+        const QHash<int, SwiftSnapshotValue>& defaults = snapshotDefaults(meta);
+        for (int i = QObject::staticMetaObject.propertyCount(); i < meta->propertyCount(); ++i) {
+            const QMetaProperty property = meta->property(i);
+            SwiftSnapshotValue value;
+            if (!isSnapshotProperty(property) || !readSnapshotValue(property, widget, value)) {
+                continue;
+            }
+            auto fallback = defaults.constFind(i);
+            if (fallback != defaults.constEnd() && fallback.value() == value) {
+                continue;
+            }
+            SwiftSnapshotProperty entry{intern(QByteArray(property.name())), value.kind, value.integer, value.real};
+            if (value.kind == SnapshotString) {
+                entry.integer = intern(value.text.toUtf8());
+            }
+            properties.push_back(entry);
+        }
+        record.propertyCount = static_cast<quint32>(properties.size()) - record.firstProperty;
+        
+        const size_t index = records.size();
+        records.push_back(record);
+        if (!isSnapshotContainer(className)) {
+            return;
+        }
+        for (QObject* child : widget->children()) {
+            if (!child->isWidgetType()) {
+                continue;
+            }
+            QWidget* childWidget = static_cast<QWidget*>(child);
+            if (childWidget->isWindow() || qstrcmp(childWidget->metaObject()->className(), "QSplitterHandle") == 0) {
+                continue;
+            }
+            capture(childWidget);
+            ++records[index].childCount;
+        }
+    }
+    
+    template <typename T>
+    static void append(QByteArray& out, T value) {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    
+    QByteArray serialize() const {
+        QByteArray out;
+        out.reserve(16 + static_cast<qsizetype>(records.size() * swiftSnapshotRecordSize
+                                                + properties.size() * swiftSnapshotPropertySize
+                                                + strings.size() * 24));
+        out.append(swiftSnapshotMagic, 4);
+        append<quint16>(out, swiftSnapshotVersion);
+        append<quint16>(out, 0);
+        append<quint32>(out, static_cast<quint32>(strings.size()));
+        append<quint32>(out, static_cast<quint32>(records.size()));
+        for (const QByteArray& text : strings) {
+            append<quint32>(out, static_cast<quint32>(text.size()));
+            out.append(text);
+            out.append('\0');
+        }
+        for (const SwiftSnapshotRecord& record : records) {
+            append(out, record.className);
+            append(out, record.objectName);
+            append(out, record.x);
+            append(out, record.y);
+            append(out, record.width);
+            append(out, record.height);
+            append(out, record.flags);
+            append(out, record.eventMask);
+            append(out, record.childCount);
+            append(out, record.propertyCount);
+            for (quint32 i = 0; i < record.propertyCount; ++i) {
+                const SwiftSnapshotProperty& property = properties[record.firstProperty + i];
+                append(out, property.name);
+                append(out, property.kind);
+                if (property.kind == SnapshotReal) {
+                    append(out, property.real);
+                } else {
+                    append(out, property.integer);
+                }
+            }
+        }
+        return out;
+    }
+};
+
+// Reads the records from data.bytes, checking every index and the shape of the tree
+static bool parseSnapshot(SwiftWidgetSnapshotData& data) {
+    SwiftCanvasCursor cursor{data.bytes, data.size, 0, true};
+    const unsigned char* magic = cursor.take(4);
+    if (!magic || std::memcmp(magic, swiftSnapshotMagic, 4) != 0) {
+        return false;
+    }
+    const quint16 version = cursor.read<quint16>();
+    cursor.read<quint16>();
+    const quint32 stringCount = cursor.read<quint32>();
+    const quint32 widgetCount = cursor.read<quint32>();
+    if (!cursor.valid || version != swiftSnapshotVersion || widgetCount == 0
+        || stringCount > data.size / 5 || widgetCount > data.size / swiftSnapshotRecordSize) {
+        return false;
+    }
+    
+    data.strings.clear();
+    data.strings.reserve(stringCount);
+    for (quint32 i = 0; i < stringCount; ++i) {
+        const quint32 length = cursor.read<quint32>();
+        const unsigned char* text = cursor.valid && length < data.size ? cursor.take(static_cast<size_t>(length) + 1) : nullptr;
+        if (!text || text[length] != '\0') {
+            return false;
+        }
+        data.strings.emplace_back(reinterpret_cast<const char*>(text), length);
+    }
+    
+    data.records.clear();
+    data.properties.clear();
+    data.records.reserve(widgetCount);
+    std::vector<quint32> open;   // Children still expected by each ancestor
+    for (quint32 i = 0; i < widgetCount; ++i) {
+        SwiftSnapshotRecord record{};
+        record.className = cursor.read<quint32>();
+        record.objectName = cursor.read<quint32>();
+        record.x = cursor.read<qint32>();
+        record.y = cursor.read<qint32>();
+        record.width = cursor.read<qint32>();
+        record.height = cursor.read<qint32>();
+        record.flags = cursor.read<quint32>();
+        record.eventMask = cursor.read<quint64>();
+        record.childCount = cursor.read<quint32>();
+        record.propertyCount = cursor.read<quint32>();
+        record.firstProperty = static_cast<quint32>(data.properties.size());
+        if (!cursor.valid || record.className >= stringCount || record.objectName >= stringCount
+            || record.propertyCount > (data.size - cursor.pos) / swiftSnapshotPropertySize
+            || record.childCount >= widgetCount) {
+            return false;
+        }
+        for (quint32 p = 0; p < record.propertyCount; ++p) {
+            SwiftSnapshotProperty property{};
+            property.name = cursor.read<quint32>();
+            property.kind = cursor.read<quint32>();
+            if (property.kind == SnapshotReal) {
+                property.real = cursor.read<double>();
+            } else {
+                property.integer = cursor.read<qint64>();
+            }
+            if (!cursor.valid || property.name >= stringCount || property.kind > SnapshotString
+                || (property.kind == SnapshotString && (property.integer < 0 || property.integer >= stringCount))) {
+                return false;
+            }
+            data.properties.push_back(property);
+        }
+        
+        if (i > 0) {
+            while (!open.empty() && open.back() == 0) {
+                open.pop_back();
+            }
+            if (open.empty()) {
+                return false;   // More records than the tree has room for
+            }
+            --open.back();
+        }
+        open.push_back(record.childCount);
+        data.records.push_back(record);
+    }
+    for (quint32 remaining : open) {
+        if (remaining != 0) {
+            return false;
+        }
+    }
+    return cursor.pos == data.size;
 }
 
-SwiftQCalendarWidget::SwiftQCalendarWidget(SwiftQWidget* parent) : SwiftQWidget(parent), calendarWidget(nullptr) {
-    ensureWidget();
+static void applySnapshotRecord(const SwiftWidgetSnapshotData& data, const SwiftSnapshotRecord& record,
+                                QWidget* widget, bool applyProperties) {
+    const auto& name = data.strings[record.objectName];
+    widget->setObjectName(QString::fromUtf8(name.first, name.second));
+    if (!applyProperties) {
+        return;
+    }
+    const QMetaObject* meta = widget->metaObject();
+    for (quint32 i = 0; i < record.propertyCount; ++i) {
+        const SwiftSnapshotProperty& entry = data.properties[record.firstProperty + i];
+        const int index = meta->indexOfProperty(data.strings[entry.name].first);
+        if (index < 0) {
+            continue;
+        }
+        const QMetaProperty property = meta->property(index);
+        QVariant value;
+        switch (entry.kind) {
+        case SnapshotBool:
+            value = QVariant(entry.integer != 0);
+            break;
+        case SnapshotInteger:
+            value = property.isEnumType() ? QVariant(static_cast<int>(entry.integer)) : QVariant(static_cast<qlonglong>(entry.integer));
+            break;
+        case SnapshotReal:
+            value = QVariant(entry.real);
+            break;
+        default: {
+            const auto& text = data.strings[static_cast<size_t>(entry.integer)];
+            value = QVariant(QString::fromUtf8(text.first, text.second));
+            break;
+        }
+        }
+        property.write(widget, value);
+    }
 }
 
-SwiftQCalendarWidget::~SwiftQCalendarWidget() {
-    // Widget cleanup handled by base class
+SwiftWidgetSnapshot::SwiftWidgetSnapshot() : data(std::make_shared<SwiftWidgetSnapshotData>()) {
 }
 
-void SwiftQCalendarWidget::ensureWidget() {
+bool SwiftWidgetSnapshot::capture(SwiftQWidget* root) {
+    QWidget* widget = root ? root->getQWidget() : nullptr;
     if (!widget) {
-        calendarWidget = new QCalendarWidget(parentWidget ? parentWidget->getQWidget() : nullptr);
-        widget = calendarWidget;
-        setupEventFilter();
+        return false;
     }
-}
-
-void SwiftQCalendarWidget::setSelectedDate(int year, int month, int day) {
-    if (calendarWidget) {
-        calendarWidget->setSelectedDate(QDate(year, month, day));
+    SwiftSnapshotWriter writer;
+    writer.capture(widget);
+    
+    auto next = std::make_shared<SwiftWidgetSnapshotData>();
+    next->owned = writer.serialize();
+    next->bytes = reinterpret_cast<const unsigned char*>(next->owned.constData());
+    next->size = static_cast<size_t>(next->owned.size());
+    if (!parseSnapshot(*next)) {
+        return false;
     }
+    data = next;
+    return true;
 }
 
-void SwiftQCalendarWidget::getSelectedDate(int* year, int* month, int* day) const {
-    if (calendarWidget) {
-        QDate date = calendarWidget->selectedDate();
-        if (year) *year = date.year();
-        if (month) *month = date.month();
-        if (day) *day = date.day();
+bool SwiftWidgetSnapshot::save(const std::string& path) const {
+    if (!data->bytes) {
+        return false;
     }
+    QFile file(QString::fromStdString(path));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    return file.write(reinterpret_cast<const char*>(data->bytes), static_cast<qint64>(data->size))
+        == static_cast<qint64>(data->size);
 }
 
-void SwiftQCalendarWidget::setMinimumDate(int year, int month, int day) {
-    if (calendarWidget) {
-        calendarWidget->setMinimumDate(QDate(year, month, day));
+bool SwiftWidgetSnapshot::load(const std::string& path) {
+    auto file = std::make_shared<QFile>(QString::fromStdString(path));
+    if (!file->open(QIODevice::ReadOnly) || file->size() <= 0) {
+        return false;
+    }
+    auto next = std::make_shared<SwiftWidgetSnapshotData>();
+    if (uchar* mapped = file->map(0, file->size())) {
+        next->file = file;
+        next->bytes = mapped;
+        next->size = static_cast<size_t>(file->size());
+    } else {
+        next->owned = file->readAll();
+        next->bytes = reinterpret_cast<const unsigned char*>(next->owned.constData());
+        next->size = static_cast<size_t>(next->owned.size());
     }
+    if (!parseSnapshot(*next)) {
+        return false;
+    }
+    data = next;
+    return true;
 }
 
-void SwiftQCalendarWidget::getMinimumDate(int* year, int* month, int* day) const {
-    if (calendarWidget) {
-        QDate date = calendarWidget->minimumDate();
-        if (year) *year = date.year();
-        if (month) *month = date.month();
-        if (day) *day = date.day();
+bool SwiftWidgetSnapshot::loadBytes(const unsigned char* bytes, size_t size) {
+    if (!bytes || size == 0) {
+        return false;
+    }
+    auto next = std::make_shared<SwiftWidgetSnapshotData>();
+    next->owned = QByteArray(reinterpret_cast<const char*>(bytes), static_cast<qsizetype>(size));
+    next->bytes = reinterpret_cast<const unsigned char*>(next->owned.constData());
+    next->size = size;
+    if (!parseSnapshot(*next)) {
+        return false;
     }
+    data = next;
+    return true;
 }
 
-void SwiftQCalendarWidget::setMaximumDate(int year, int month, int day) {
-    if (calendarWidget) {
-        calendarWidget->setMaximumDate(QDate(year, month, day));
-    }
+const unsigned char* SwiftWidgetSnapshot::bytes() const {
+    return data->bytes;
 }
 
-void SwiftQCalendarWidget::getMaximumDate(int* year, int* month, int* day) const {
-    if (calendarWidget) {
-        QDate date = calendarWidget->maximumDate();
-        if (year) *year = date.year();
-        if (month) *month = date.month();
-        if (day) *day = date.day();
-    }
+size_t SwiftWidgetSnapshot::byteCount() const {
+    return data->size;
 }
 
-void SwiftQCalendarWidget::setFirstDayOfWeek(int dayOfWeek) {
-    if (calendarWidget) {
-        calendarWidget->setFirstDayOfWeek(static_cast<Qt::DayOfWeek>(dayOfWeek));
-    }
+int SwiftWidgetSnapshot::widgetCount() const {
+    return static_cast<int>(data->records.size());
 }
 
-int SwiftQCalendarWidget::firstDayOfWeek() const {
-    return calendarWidget ? static_cast<int>(calendarWidget->firstDayOfWeek()) : 1;
+std::string SwiftWidgetSnapshot::className(int index) const {
+    if (index < 0 || index >= widgetCount()) {
+        return std::string();
+    }
+    const auto& text = data->strings[data->records[index].className];
+    return std::string(text.first, text.second);
 }
 
-void SwiftQCalendarWidget::setGridVisible(bool show) {
-    if (calendarWidget) {
-        calendarWidget->setGridVisible(show);
+std::string SwiftWidgetSnapshot::objectName(int index) const {
+    if (index < 0 || index >= widgetCount()) {
+        return std::string();
     }
+    const auto& text = data->strings[data->records[index].objectName];
+    return std::string(text.first, text.second);
 }
 
-bool SwiftQCalendarWidget::isGridVisible() const {
-    return calendarWidget ? calendarWidget->isGridVisible() : false;
+unsigned long long SwiftWidgetSnapshot::eventMask(int index) const {
+    return index >= 0 && index < widgetCount() ? data->records[index].eventMask : 0;
 }
 
-void SwiftQCalendarWidget::setNavigationBarVisible(bool visible) {
-    if (calendarWidget) {
-        calendarWidget->setNavigationBarVisible(visible);
+bool SwiftWidgetSnapshot::restore(SwiftQWidget* target) {
+    QWidget* root = target ? target->getQWidget() : nullptr;
+    if (!root || data->records.empty()) {
+        return false;
     }
+    SwiftWidgetSnapshotData& snapshot = *data;
+    snapshot.restored.assign(snapshot.records.size(), QPointer<QWidget>());
+    snapshot.restored[0] = root;
+    
+    const bool suspend = root->updatesEnabled();
+    if (suspend) {
+        root->setUpdatesEnabled(false);
+    }
+    
+    const SwiftSnapshotRecord& top = snapshot.records[0];
+    applySnapshotRecord(snapshot, top, root, qstrcmp(root->metaObject()->className(), snapshot.strings[top.className].first) == 0);
+    if (top.width > 0 && top.height > 0) {
+        root->resize(top.width, top.height);
+    }
+    
+    // Records are in pre-order, so each one belongs to the innermost ancestor still expecting children
+    struct Level {
+        QWidget* widget;
+        quint32 remaining;
+    };
+    std::vector<Level> stack{{root, top.childCount}};
+    for (size_t i = 1; i < snapshot.records.size(); ++i) {
+        while (stack.size() > 1 && stack.back().remaining == 0) {
+            stack.pop_back();
+        }
+        QWidget* parent = stack.back().widget;
+        --stack.back().remaining;
+        
+        const SwiftSnapshotRecord& record = snapshot.records[i];
+        const char* className = snapshot.strings[record.className].first;
+        QWidget* widget = createSnapshotWidget(QByteArray::fromRawData(className, snapshot.strings[record.className].second), parent);
+        if (!widget) {
+            widget = new QWidget(parent);
+            SwiftLiveObjects::trackWidget(widget);
+        }
+        applySnapshotRecord(snapshot, record, widget, qstrcmp(widget->metaObject()->className(), className) == 0);
+        widget->setGeometry(record.x, record.y, record.width, record.height);
+        if (record.flags & SnapshotHidden) {
+            widget->hide();
+        } else if (parent->isVisible()) {
+            widget->show();
+        }
+        snapshot.restored[i] = widget;
+        stack.push_back({widget, record.childCount});
+    }
+    
+    if (suspend) {
+        root->setUpdatesEnabled(true);
+    }
+    return true;
 }
 
-bool SwiftQCalendarWidget::isNavigationBarVisible() const {
-    return calendarWidget ? calendarWidget->isNavigationBarVisible() : true;
+SwiftQWidget* SwiftWidgetSnapshot::restoredWidget(int index) const {
+    if (index < 0 || index >= static_cast<int>(data->restored.size())) {
+        return nullptr;
+    }
+    return SwiftWidgetRegistry::wrapperFor(data->restored[index].data());
 }
 
-void SwiftQCalendarWidget::setSelectionMode(int mode) {
-    if (calendarWidget) {
-        calendarWidget->setSelectionMode(static_cast<QCalendarWidget::SelectionMode>(mode));
+// Quotes and escapes a string for toText
+static void appendSnapshotQuoted(std::string& out, const char* text, size_t length) {
+    out += '"';
+    for (size_t i = 0; i < length; ++i) {
+        const char c = text[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else {
+            out += c;
+        }
     }
+    out += '"';
 }
 
-int SwiftQCalendarWidget::selectionMode() const {
-    return calendarWidget ? static_cast<int>(calendarWidget->selectionMode()) : 1;
+std::string SwiftWidgetSnapshot::toText() const {
+    const SwiftWidgetSnapshotData& snapshot = *data;
+    std::string out;
+    std::vector<quint32> open;
+    for (const SwiftSnapshotRecord& record : snapshot.records) {
+        while (!open.empty() && open.back() == 0) {
+            open.pop_back();
+        }
+        if (!open.empty()) {
+            --open.back();
+        }
+        const std::string indent(open.size() * 2, ' ');
+        
+        const auto& className = snapshot.strings[record.className];
+        const auto& objectName = snapshot.strings[record.objectName];
+        out += indent;
+        out.append(className.first, className.second);
+        out += ' ';
+        appendSnapshotQuoted(out, objectName.first, objectName.second);
+        out += QStringLiteral(" %1,%2 %3x%4").arg(record.x).arg(record.y).arg(record.width).arg(record.height).toStdString();
+        if (record.flags & SnapshotHidden) {
+            out += " hidden";
+        }
+        if (record.eventMask) {
+            out += " events=0x" + QByteArray::number(record.eventMask, 16).toStdString();
+        }
+        out += '\n';
+        
+        for (quint32 i = 0; i < record.propertyCount; ++i) {
+            const SwiftSnapshotProperty& property = snapshot.properties[record.firstProperty + i];
+            const auto& name = snapshot.strings[property.name];
+            out += indent + "  ";
+            out.append(name.first, name.second);
+            out += " = ";
+            switch (property.kind) {
+            case SnapshotBool:
+                out += property.integer ? "true" : "false";
+                break;
+            case SnapshotInteger:
+                out += std::to_string(property.integer);
+                break;
+            case SnapshotReal:
+                out += QByteArray::number(property.real, 'g', 17).toStdString();
+                break;
+            default: {
+                const auto& text = snapshot.strings[static_cast<size_t>(property.integer)];
+                appendSnapshotQuoted(out, text.first, text.second);
+                break;
+            }
+            }
+            out += '\n';
+        }
+        open.push_back(record.childCount);
+    }
+    return out;
 }
 
 // SwiftQMessageBox implementation
@@ -3966,4 +8343,106 @@ bool SwiftQMessageBox::showQuestion(SwiftQWidget* parent, const std::string& tit
 void SwiftQMessageBox::showAbout(SwiftQWidget* parent, const std::string& title, const std::string& text) {
     QWidget* parentWidget = parent ? parent->getQWidget() : nullptr;
     QMessageBox::about(parentWidget, QString::fromStdString(title), QString::fromStdString(text));
+}
+
+// Async message boxes that are currently open, keyed by parent, icon, title and text
+struct SwiftAsyncMessageBox {
+    QPointer<QMessageBox> box;
+    quint64 serial;    // Tells a reopened box under the same key from the one that closed
+    int count;
+    std::vector<SwiftEventCallback> callbacks;
+};
+
+static QHash<QString, SwiftAsyncMessageBox>& asyncMessageBoxes() {
+    static QHash<QString, SwiftAsyncMessageBox> boxes;
+    return boxes;
+}
+
+// Unregisters the box and runs its callbacks with `button`; does nothing if it already finished
+static void finishAsyncMessageBox(const QString& key, quint64 serial, int button) {
+    auto& openBoxes = asyncMessageBoxes();
+    auto it = openBoxes.find(key);
+    if (it == openBoxes.end() || it->serial != serial) {
+        return;
+    }
+    // Unregister first: a callback may raise the same alert again, which must open a new box
+    SwiftAsyncMessageBox finished = it.value();
+    openBoxes.erase(it);
+    
+    QtEventInfo info = {QtEventType::Clicked, button, finished.count, nullptr, false, nullptr};
+    for (const SwiftEventCallback& cb : finished.callbacks) {
+        cb.handler(cb.context, &info);
+    }
+}
+
+int SwiftQMessageBox::openAsync(SwiftQWidget* parent, int icon, const std::string& title,
+                                const std::string& text, int buttons, SwiftEventCallback callback) {
+    if (!QApplication::instance()) {
+        return 0;
+    }
+    QWidget* parentWidget = parent ? parent->getQWidget() : nullptr;
+    const QString qtTitle = QString::fromStdString(title);
+    const QString qtText = QString::fromStdString(text);
+    const QString key = QString::number(reinterpret_cast<quintptr>(parentWidget)) + QChar(0x1f) +
+                        QString::number(icon) + QChar(0x1f) + qtTitle + QChar(0x1f) + qtText;
+    
+    auto& boxes = asyncMessageBoxes();
+    auto existing = boxes.find(key);
+    if (existing != boxes.end() && existing->box) {
+        // Fold the duplicate into the open box instead of stacking another dialog
+        SwiftAsyncMessageBox& entry = existing.value();
+        entry.count++;
+        if (callback.handler) {
+            entry.callbacks.push_back(callback);
+        }
+        entry.box->setInformativeText(
+            QCoreApplication::translate("SwiftQMessageBox", "This message was reported %1 times.").arg(entry.count));
+        return entry.count;
+    }
+    
+    QMessageBox::StandardButtons standardButtons = buttons 
+        ? QMessageBox::StandardButtons(buttons) : QMessageBox::StandardButtons(QMessageBox::Ok);
+    QMessageBox* box = new QMessageBox(static_cast<QMessageBox::Icon>(icon), qtTitle, qtText, 
+                                       standardButtons, parentWidget);
+    box->setAttribute(Qt::WA_DeleteOnClose);
+    SwiftLiveObjects::trackWidget(box);
+    
+    static quint64 nextSerial = 0;
+    const quint64 serial = ++nextSerial;
+    SwiftAsyncMessageBox entry = {box, serial, 1, {}};
+    if (callback.handler) {
+        entry.callbacks.push_back(callback);
+    }
+    boxes.insert(key, entry);
+    
+    QObject::connect(box, &QDialog::finished, box, [box, key, serial](int result) {
+        // done() called programmatically leaves clickedButton unset; the result is the button
+        int button = box->clickedButton() ? static_cast<int>(box->standardButton(box->clickedButton())) : result;
+        finishAsyncMessageBox(key, serial, button);
+    });
+    // Deleting the parent deletes the box without finishing it; callers still get an answer
+    QObject::connect(box, &QObject::destroyed, [key, serial]() {
+        finishAsyncMessageBox(key, serial, QMessageBox::Cancel);
+    });
+    
+    // Window-modal with a parent, application-modal without; neither runs a nested event loop
+    box->open();
+    return 1;
+}
+
+int SwiftQMessageBox::openAsyncCount() {
+    return asyncMessageBoxes().size();
+}
+
+void SwiftQMessageBox::finishAllAsync(int button) {
+    // Collect first: finishing a box removes it from the table
+    std::vector<QPointer<QMessageBox>> open;
+    for (const SwiftAsyncMessageBox& entry : asyncMessageBoxes()) {
+        open.push_back(entry.box);
+    }
+    for (const QPointer<QMessageBox>& box : open) {
+        if (box) {
+            box->done(button);
+        }
+    }
 }
\ No newline at end of file
@@ -17,8 +17,26 @@
 #include <QRadioButton>
 #include <QComboBox>
 #include <QKeySequence>
+#include <QInputMethodEvent>
+#include <QMouseEvent>
+#include <QWheelEvent>
+#include <QKeyEvent>
+#include <QWindow>
+#include <qpa/qwindowsysteminterface.h>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QPointer>
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 // Static instance
 SwiftQTest* SwiftQTest::instance_ = nullptr;
@@ -86,12 +104,12 @@ SwiftQWidget* SwiftQTestFinder::findByObjectName(const std::string& name) {
         // Search all top-level widgets
         for (QWidget* widget : QApplication::topLevelWidgets()) {
             if (widget->objectName() == QString::fromStdString(name)) {
-                return new SwiftQWidget(widget);
+                return SwiftWidgetRegistry::wrapperFor(widget);
             }
             // Search children
             QWidget* found = widget->findChild<QWidget*>(QString::fromStdString(name));
             if (found) {
-                return new SwiftQWidget(found);
+                return SwiftWidgetRegistry::wrapperFor(found);
             }
         }
     } else {
@@ -101,7 +119,7 @@ SwiftQWidget* SwiftQTestFinder::findByObjectName(const std::string& name) {
         }
         QWidget* found = searchRoot->findChild<QWidget*>(QString::fromStdString(name));
         if (found) {
-            return new SwiftQWidget(found);
+            return SwiftWidgetRegistry::wrapperFor(found);
         }
     }
     return nullptr;
@@ -148,7 +166,7 @@ SwiftQWidget* SwiftQTestFinder::getByObjectNameAt(const std::string& name, int i
     auto widgets = findAllByObjectNameInternal(searchRoot, name);
     
     if (index >= 0 && index < static_cast<int>(widgets.size())) {
-        return new SwiftQWidget(widgets[index]);
+        return SwiftWidgetRegistry::wrapperFor(widgets[index]);
     }
     return nullptr;
 }
@@ -199,7 +217,7 @@ SwiftQWidget* SwiftQTestFinder::getByClassNameAt(const std::string& className, i
     auto widgets = findByClassNameInternal(searchRoot, className);
     
     if (index >= 0 && index < static_cast<int>(widgets.size())) {
-        return new SwiftQWidget(widgets[index]);
+        return SwiftWidgetRegistry::wrapperFor(widgets[index]);
     }
     return nullptr;
 }
@@ -223,7 +241,7 @@ SwiftQWidget* SwiftQTestFinder::getChildAt(SwiftQWidget* parent, int index) {
     QList<QWidget*> children = parentWidget->findChildren<QWidget*>();
     
     if (index >= 0 && index < children.size()) {
-        return new SwiftQWidget(children[index]);
+        return SwiftWidgetRegistry::wrapperFor(children[index]);
     }
     return nullptr;
 }
@@ -392,6 +410,22 @@ void SwiftQTestSimulator::mouseReleaseCenter(SwiftQWidget* widget, int button) {
     mouseRelease(widget, button, center.x(), center.y());
 }
 
+int SwiftQTestSimulator::sendMouseMoves(SwiftQWidget* widget, int count) {
+    if (!widget || !widget->getQWidget()) return 0;
+    
+    QWidget* qw = widget->getQWidget();
+    const int width = std::max(qw->width(), 1);
+    const int height = std::max(qw->height(), 1);
+    for (int i = 0; i < count; ++i) {
+        const QPointF local(i % width, i % height);
+        QMouseEvent event(QEvent::MouseMove, local, qw->mapToGlobal(local),
+                          Qt::NoButton, Qt::NoButton, Qt::NoModifier);
+        event.setTimestamp(static_cast<quint64>(i));
+        QApplication::sendEvent(qw, &event);
+    }
+    return std::max(count, 0);
+}
+
 void SwiftQTestSimulator::keyClick(SwiftQWidget* widget, int key, int modifiers, int delay) {
     if (!widget || !widget->getQWidget()) return;
     
@@ -495,6 +529,77 @@ void SwiftQTestSimulator::keySequence(SwiftQWidget* widget, const std::string& s
     QTest::keySequence(window, QKeySequence(QString::fromStdString(sequence)));
 }
 
+// Text as testAssertGetText reports it
+static QString widgetText(QWidget* widget) {
+    if (QLabel* label = qobject_cast<QLabel*>(widget)) {
+        return label->text();
+    } else if (QPushButton* button = qobject_cast<QPushButton*>(widget)) {
+        return button->text();
+    } else if (QLineEdit* lineEdit = qobject_cast<QLineEdit*>(widget)) {
+        return lineEdit->text();
+    } else if (QTextEdit* textEdit = qobject_cast<QTextEdit*>(widget)) {
+        return textEdit->toPlainText();
+    } else if (QCheckBox* checkBox = qobject_cast<QCheckBox*>(widget)) {
+        return checkBox->text();
+    } else if (QRadioButton* radioButton = qobject_cast<QRadioButton*>(widget)) {
+        return radioButton->text();
+    } else if (QComboBox* comboBox = qobject_cast<QComboBox*>(widget)) {
+        return comboBox->currentText();
+    }
+    
+    // Try window title as fallback
+    return widget->windowTitle();
+}
+
+int SwiftQTestSimulator::typeTextBulk(SwiftQWidget* widget, const char* utf8, size_t length, int mode, bool verify) {
+    if (!widget || !widget->getQWidget()) return 0;
+    
+    QWidget* qw = widget->getQWidget();
+    qw->setFocus();
+    // Composite widgets such as spin boxes take input through a focus proxy
+    QWidget* target = qw->focusWidget() ? qw->focusWidget() : qw;
+    const QString text = QString::fromUtf8(utf8, static_cast<qsizetype>(length));
+    
+    int delivered = 0;
+    if (mode == 0) {
+        QInputMethodEvent event;
+        event.setCommitString(text);
+        QApplication::sendEvent(target, &event);
+        for (QChar c : text) {
+            delivered += c.isLowSurrogate() ? 0 : 1;
+        }
+    } else {
+        for (qsizetype i = 0; i < text.size(); ++i) {
+            const bool pair = text[i].isHighSurrogate() && i + 1 < text.size() && text[i + 1].isLowSurrogate();
+            const QString character = text.mid(i, pair ? 2 : 1);
+            const QChar c = text[i];
+            int key = Qt::Key_unknown;
+            Qt::KeyboardModifiers modifiers = Qt::NoModifier;
+            if (c == QLatin1Char('\n')) {
+                key = Qt::Key_Return;
+            } else if (c == QLatin1Char('\t')) {
+                key = Qt::Key_Tab;
+            } else if (!pair) {
+                key = c.toUpper().unicode();
+                modifiers = c.isUpper() ? Qt::ShiftModifier : Qt::NoModifier;
+            }
+            QCoreApplication::postEvent(target, new QKeyEvent(QEvent::KeyPress, key, modifiers, character));
+            QCoreApplication::postEvent(target, new QKeyEvent(QEvent::KeyRelease, key, modifiers, character));
+            i += pair ? 1 : 0;
+            ++delivered;
+        }
+        // Deliver the whole sequence now rather than waiting for the event loop
+        QCoreApplication::sendPostedEvents(target);
+    }
+    QApplication::processEvents();
+    
+    // Read back from the widget that took the input, not the composite around it
+    if (verify && widgetText(target) != text) {
+        return -1;
+    }
+    return delivered;
+}
+
 void SwiftQTestSimulator::setFocus(SwiftQWidget* widget) {
     if (!widget || !widget->getQWidget()) return;
     
@@ -524,6 +629,669 @@ void SwiftQTestSimulator::processEventsDefault() {
     QApplication::processEvents();
 }
 
+// SwiftQTestInputLog implementation
+static const char inputLogMagic[4] = {'Q', 'W', 'I', 'N'};
+static const quint16 inputLogVersion = 1;
+static const size_t inputLogHeaderSize = 12;
+static_assert(sizeof(QtInputRecord) == 40, "QtInputRecord is stored as 40 bytes");
+
+class SwiftInputLogFilter;
+
+struct SwiftQTestInputLogData {
+    std::vector<QtInputRecord> records;
+    mutable QByteArray encoded;       // Serialized records, rebuilt when dirty
+    mutable bool encodedDirty = true;
+    QElapsedTimer clock;
+    QPointer<QWidget> topLevel;       // Window being recorded or replayed into
+    bool recording = false;
+    
+    // Replay state
+    std::vector<long long> latencies;
+    int step = -1;                    // Most recently injected step, -1 outside replay
+    long long injectedAt = 0;
+    
+    std::unique_ptr<SwiftInputLogFilter> filter;  // Last, so it goes before what it points to
+    
+    long long now() const {
+        return clock.nsecsElapsed() / 1000;
+    }
+    
+    void record(QEvent* event);
+    void installFilter();
+};
+
+// Watches the whole application: while recording it captures input reaching the top-level
+// window, while replaying it notes the first paint of that window after each step
+class SwiftInputLogFilter : public QObject {
+public:
+    explicit SwiftInputLogFilter(SwiftQTestInputLogData* log) : log(log) {}
+    
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override {
+        if (log->recording) {
+            if (watched->isWindowType() && log->topLevel && watched == log->topLevel->windowHandle()) {
+                log->record(event);
+            }
+        } else if (log->step >= 0 && event->type() == QEvent::Paint && watched->isWidgetType()
+                   && static_cast<QWidget*>(watched)->window() == log->topLevel) {
+            long long& latency = log->latencies[log->step];
+            if (latency < 0) {
+                latency = log->now() - log->injectedAt;
+            }
+        }
+        return false;
+    }
+    
+private:
+    SwiftQTestInputLogData* log;
+};
+
+void SwiftQTestInputLogData::installFilter() {
+    if (!filter) {
+        filter = std::make_unique<SwiftInputLogFilter>(this);
+        qApp->installEventFilter(filter.get());
+    }
+}
+
+void SwiftQTestInputLogData::record(QEvent* event) {
+    QtInputRecord entry = {};
+    switch (event->type()) {
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::MouseMove: {
+        const QMouseEvent* mouse = static_cast<QMouseEvent*>(event);
+        entry.code = static_cast<int>(mouse->button());
+        entry.x = static_cast<float>(mouse->position().x());
+        entry.y = static_cast<float>(mouse->position().y());
+        entry.modifiers = static_cast<int>(mouse->modifiers());
+        entry.buttons = static_cast<int>(mouse->buttons());
+        break;
+    }
+    case QEvent::Wheel: {
+        const QWheelEvent* wheel = static_cast<QWheelEvent*>(event);
+        entry.code = wheel->angleDelta().y();
+        entry.text = wheel->angleDelta().x();
+        entry.x = static_cast<float>(wheel->position().x());
+        entry.y = static_cast<float>(wheel->position().y());
+        entry.modifiers = static_cast<int>(wheel->modifiers());
+        entry.buttons = static_cast<int>(wheel->buttons());
+        break;
+    }
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease: {
+        const QKeyEvent* key = static_cast<QKeyEvent*>(event);
+        const QList<uint> text = key->text().toUcs4();
+        entry.code = key->key();
+        entry.modifiers = static_cast<int>(key->modifiers());
+        entry.text = text.isEmpty() ? 0 : static_cast<int>(text.first());
+        entry.flags = key->isAutoRepeat() ? 1 : 0;
+        break;
+    }
+    default:
+        return;
+    }
+    entry.time = now();
+    entry.type = static_cast<int>(event->type());
+    records.push_back(entry);
+    encodedDirty = true;
+}
+
+static bool isInputLogType(int type) {
+    switch (type) {
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::MouseMove:
+    case QEvent::Wheel:
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Sends one record into window the way the window system would have. Mouse events go
+// through QWindowSystemInterface rather than QTest: QTest's window mouse functions stop
+// Qt from pairing presses into double clicks and drop the buttons and modifiers of moves.
+// timestamp is in milliseconds and lets Qt measure the double click interval.
+static void injectInput(QWindow* window, const QtInputRecord& record, ulong timestamp) {
+    const QPointF position(record.x, record.y);
+    const auto modifiers = static_cast<Qt::KeyboardModifiers>(record.modifiers);
+    switch (record.type) {
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::MouseMove: {
+        const auto type = static_cast<QEvent::Type>(record.type);
+        const auto button = type == QEvent::MouseMove ? Qt::NoButton : static_cast<Qt::MouseButton>(record.code);
+        QWindowSystemInterface::handleMouseEvent<QWindowSystemInterface::SynchronousDelivery>(
+            window, timestamp, position, window->mapToGlobal(position),
+            static_cast<Qt::MouseButtons>(record.buttons), button, type, modifiers);
+        break;
+    }
+    case QEvent::Wheel: {
+        // QTest has no wheel helper for windows
+        QWheelEvent event(position, window->mapToGlobal(position), QPoint(), QPoint(record.text, record.code),
+                          static_cast<Qt::MouseButtons>(record.buttons), modifiers, Qt::NoScrollPhase, false);
+        QApplication::sendEvent(window, &event);
+        break;
+    }
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease: {
+        const char32_t codePoint = static_cast<char32_t>(record.text);
+        const QString text = record.text > 0 ? QString::fromUcs4(&codePoint, 1) : QString();
+        QTest::sendKeyEvent(record.type == QEvent::KeyPress ? QTest::Press : QTest::Release,
+                            window, static_cast<Qt::Key>(record.code), text, modifiers);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+SwiftQTestInputLog::SwiftQTestInputLog() : data(std::make_shared<SwiftQTestInputLogData>()) {
+}
+
+bool SwiftQTestInputLog::startRecording(SwiftQWidget* root) {
+    if (!root || !root->getQWidget()) return false;
+    
+    data->topLevel = root->getQWidget()->window();
+    data->records.clear();
+    data->encodedDirty = true;
+    data->step = -1;
+    data->installFilter();
+    data->clock.start();
+    data->recording = true;
+    return true;
+}
+
+void SwiftQTestInputLog::stopRecording() {
+    data->recording = false;
+}
+
+bool SwiftQTestInputLog::isRecording() const {
+    return data->recording;
+}
+
+void SwiftQTestInputLog::append(const QtInputRecord& record) {
+    if (!isInputLogType(record.type)) return;
+    
+    data->records.push_back(record);
+    data->encodedDirty = true;
+}
+
+void SwiftQTestInputLog::clear() {
+    data->records.clear();
+    data->latencies.clear();
+    data->encodedDirty = true;
+}
+
+int SwiftQTestInputLog::eventCount() const {
+    return static_cast<int>(data->records.size());
+}
+
+QtInputRecord SwiftQTestInputLog::eventAt(int index) const {
+    if (index < 0 || index >= eventCount()) return QtInputRecord{};
+    return data->records[index];
+}
+
+const unsigned char* SwiftQTestInputLog::bytes() const {
+    if (data->encodedDirty) {
+        const quint32 count = static_cast<quint32>(data->records.size());
+        const quint16 reserved = 0;
+        data->encoded.resize(static_cast<qsizetype>(inputLogHeaderSize + count * sizeof(QtInputRecord)));
+        char* out = data->encoded.data();
+        std::memcpy(out, inputLogMagic, 4);
+        std::memcpy(out + 4, &inputLogVersion, 2);
+        std::memcpy(out + 6, &reserved, 2);
+        std::memcpy(out + 8, &count, 4);
+        if (count > 0) {
+            std::memcpy(out + inputLogHeaderSize, data->records.data(), count * sizeof(QtInputRecord));
+        }
+        data->encodedDirty = false;
+    }
+    return reinterpret_cast<const unsigned char*>(data->encoded.constData());
+}
+
+size_t SwiftQTestInputLog::byteCount() const {
+    bytes();
+    return static_cast<size_t>(data->encoded.size());
+}
+
+bool SwiftQTestInputLog::loadBytes(const unsigned char* bytes, size_t size) {
+    if (!bytes || size < inputLogHeaderSize || std::memcmp(bytes, inputLogMagic, 4) != 0) return false;
+    
+    quint16 version = 0;
+    quint32 count = 0;
+    std::memcpy(&version, bytes + 4, 2);
+    std::memcpy(&count, bytes + 8, 4);
+    if (version != inputLogVersion || (size - inputLogHeaderSize) / sizeof(QtInputRecord) != count
+        || (size - inputLogHeaderSize) % sizeof(QtInputRecord) != 0) {
+        return false;
+    }
+    std::vector<QtInputRecord> records(count);
+    if (count > 0) {
+        std::memcpy(records.data(), bytes + inputLogHeaderSize, count * sizeof(QtInputRecord));
+    }
+    for (const QtInputRecord& record : records) {
+        if (!isInputLogType(record.type)) return false;
+    }
+    data->recording = false;
+    data->records = std::move(records);
+    data->latencies.clear();
+    data->encodedDirty = true;
+    return true;
+}
+
+bool SwiftQTestInputLog::save(const std::string& path) const {
+    QFile file(QString::fromStdString(path));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+    
+    const qint64 size = static_cast<qint64>(byteCount());
+    return file.write(reinterpret_cast<const char*>(bytes()), size) == size;
+}
+
+bool SwiftQTestInputLog::load(const std::string& path) {
+    QFile file(QString::fromStdString(path));
+    if (!file.open(QIODevice::ReadOnly)) return false;
+    
+    const QByteArray contents = file.readAll();
+    return loadBytes(reinterpret_cast<const unsigned char*>(contents.constData()), static_cast<size_t>(contents.size()));
+}
+
+int SwiftQTestInputLog::replay(SwiftQWidget* root, double speed) {
+    if (!root || !root->getQWidget()) return 0;
+    
+    QWindow* window = getWindowForWidget(root->getQWidget());
+    if (!window) return 0;
+    
+    SwiftQTestInputLogData& log = *data;
+    log.recording = false;
+    log.topLevel = root->getQWidget()->window();
+    log.latencies.assign(log.records.size(), -1);
+    log.installFilter();
+    log.clock.start();
+    
+    const long long origin = log.records.empty() ? 0 : log.records.front().time;
+    // Event timestamps keep the recorded gaps whatever the speed, so two clicks that were
+    // a double click stay one and two separate clicks are not merged by compression
+    const ulong timestampBase = static_cast<ulong>(QElapsedTimer::msecsSinceReference());
+    int injected = 0;
+    for (size_t i = 0; i < log.records.size(); ++i) {
+        const QtInputRecord& record = log.records[i];
+        if (speed > 0) {
+            // Keep the event loop running until the compressed timestamp comes due
+            const long long due = static_cast<long long>((record.time - origin) / speed);
+            for (long long remaining = due - log.now(); remaining > 0; remaining = due - log.now()) {
+                if (remaining >= 1000) {
+                    QTest::qWait(static_cast<int>(remaining / 1000));
+                } else {
+                    QApplication::processEvents();
+                }
+            }
+        }
+        log.step = static_cast<int>(i);
+        log.injectedAt = log.now();
+        injectInput(window, record, timestampBase + static_cast<ulong>((record.time - origin) / 1000));
+        ++injected;
+        if (speed <= 0) {
+            QApplication::processEvents();
+        }
+    }
+    // Give the last step its paint
+    QApplication::processEvents();
+    log.step = -1;
+    return injected;
+}
+
+int SwiftQTestInputLog::latencyCount() const {
+    return static_cast<int>(data->latencies.size());
+}
+
+long long SwiftQTestInputLog::latencyAt(int index) const {
+    if (index < 0 || index >= latencyCount()) return -1;
+    return data->latencies[index];
+}
+
+// SwiftQTestPerfScope implementation
+class SwiftPerfScopeFilter;
+
+struct SwiftPerfInput {
+    int type;
+    long long time;
+    long long latency;
+};
+
+struct SwiftQTestPerfScopeData {
+    QElapsedTimer clock;
+    QPointer<QWidget> topLevel;
+    bool active = false;
+    bool inFrame = false;
+    long long frameStart = 0;
+    long long stoppedAt = 0;
+    std::vector<long long> frames;
+    std::vector<SwiftPerfInput> inputs;
+    size_t firstPending = 0;          // Inputs from here on wait for a frame
+    
+    std::unique_ptr<SwiftPerfScopeFilter> filter;  // Last, so it goes before what it points to
+    
+    long long now() const {
+        return clock.nsecsElapsed() / 1000;
+    }
+};
+
+// Times each repaint pass of the window and notes input reaching the window. A pass starts
+// when the window's UpdateRequest passes the filter and ends when a high priority event
+// posted at the start arrives, which Qt delivers once the request has been handled; the
+// request itself is left to Qt.
+class SwiftPerfScopeFilter : public QObject {
+public:
+    explicit SwiftPerfScopeFilter(SwiftQTestPerfScopeData* scope) : scope(scope) {}
+    
+    bool event(QEvent* event) override {
+        if (event->type() != frameEndType()) {
+            return QObject::event(event);
+        }
+        if (!scope->inFrame) {
+            return true;
+        }
+        scope->inFrame = false;
+        // A scope stopped mid-pass drops the pass
+        if (!scope->active) {
+            return true;
+        }
+        const long long end = scope->now();
+        scope->frames.push_back(end - scope->frameStart);
+        for (size_t i = scope->firstPending; i < scope->inputs.size(); ++i) {
+            scope->inputs[i].latency = end - scope->inputs[i].time;
+        }
+        scope->firstPending = scope->inputs.size();
+        return true;
+    }
+    
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override {
+        if (!scope->active || !scope->topLevel) {
+            return false;
+        }
+        switch (event->type()) {
+        case QEvent::UpdateRequest:
+            // The request may reach the window and then its widget; either starts one pass
+            if (scope->inFrame || (watched != scope->topLevel.data() && watched != scope->topLevel->windowHandle())) {
+                return false;
+            }
+            scope->inFrame = true;
+            scope->frameStart = scope->now();
+            QCoreApplication::postEvent(this, new QEvent(frameEndType()), Qt::HighEventPriority);
+            return false;
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseButtonRelease:
+        case QEvent::MouseButtonDblClick:
+        case QEvent::MouseMove:
+        case QEvent::Wheel:
+        case QEvent::KeyPress:
+        case QEvent::KeyRelease:
+            if (watched->isWindowType() && watched == scope->topLevel->windowHandle()) {
+                scope->inputs.push_back({static_cast<int>(event->type()), scope->now(), -1});
+            }
+            return false;
+        default:
+            return false;
+        }
+    }
+    
+private:
+    static QEvent::Type frameEndType() {
+        static const auto type = static_cast<QEvent::Type>(QEvent::registerEventType());
+        return type;
+    }
+    
+    SwiftQTestPerfScopeData* scope;
+};
+
+SwiftQTestPerfScope::SwiftQTestPerfScope() : data(std::make_shared<SwiftQTestPerfScopeData>()) {
+}
+
+bool SwiftQTestPerfScope::start(SwiftQWidget* root) {
+    if (!root || !root->getQWidget()) return false;
+    
+    SwiftQTestPerfScopeData& scope = *data;
+    scope.topLevel = root->getQWidget()->window();
+    scope.frames.clear();
+    scope.inputs.clear();
+    scope.firstPending = 0;
+    scope.inFrame = false;
+    if (!scope.filter) {
+        scope.filter = std::make_unique<SwiftPerfScopeFilter>(data.get());
+        qApp->installEventFilter(scope.filter.get());
+    }
+    scope.clock.start();
+    scope.active = true;
+    return true;
+}
+
+void SwiftQTestPerfScope::stop() {
+    if (!data->active) return;
+    
+    data->stoppedAt = data->now();
+    data->active = false;
+}
+
+bool SwiftQTestPerfScope::isActive() const {
+    return data->active;
+}
+
+long long SwiftQTestPerfScope::elapsed() const {
+    if (data->active) return data->now();
+    return data->stoppedAt;
+}
+
+int SwiftQTestPerfScope::frameCount() const {
+    return static_cast<int>(data->frames.size());
+}
+
+long long SwiftQTestPerfScope::frameTimeAt(int index) const {
+    if (index < 0 || index >= frameCount()) return 0;
+    return data->frames[index];
+}
+
+int SwiftQTestPerfScope::inputCount() const {
+    return static_cast<int>(data->inputs.size());
+}
+
+int SwiftQTestPerfScope::inputTypeAt(int index) const {
+    if (index < 0 || index >= inputCount()) return 0;
+    return data->inputs[index].type;
+}
+
+long long SwiftQTestPerfScope::inputLatencyAt(int index) const {
+    if (index < 0 || index >= inputCount()) return -1;
+    return data->inputs[index].latency;
+}
+
+// SwiftQTestImageDiff implementation
+struct SwiftDiffImage {
+    const unsigned int* pixels;
+    int stride;
+    int width;
+    int height;
+    
+    unsigned int at(int x, int y) const {
+        return pixels[static_cast<size_t>(y) * stride + x];
+    }
+};
+
+// Largest channel difference between two pixels
+static int pixelDelta(unsigned int a, unsigned int b) {
+    int delta = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        delta = std::max(delta, std::abs(static_cast<int>((a >> shift) & 0xFF) - static_cast<int>((b >> shift) & 0xFF)));
+    }
+    return delta;
+}
+
+static int pixelLuma(unsigned int pixel) {
+    return (77 * ((pixel >> 16) & 0xFF) + 150 * ((pixel >> 8) & 0xFF) + 29 * (pixel & 0xFF)) >> 8;
+}
+
+// Appends the columns whose pixels differ by more than tolerance in any channel and returns
+// the largest channel difference in the row
+static int diffRow(const unsigned int* a, const unsigned int* b, int width, int tolerance, std::vector<int>& columns) {
+    int x = 0;
+    int maxDelta = 0;
+#if defined(__SSE2__)
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(tolerance));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i peak = zero;
+    for (; x + 4 <= width; x += 4) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x));
+        const __m128i delta = _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+        peak = _mm_max_epu8(peak, delta);
+        // A lane is within tolerance when no channel survives subtracting it
+        const __m128i within = _mm_cmpeq_epi32(_mm_subs_epu8(delta, limit), zero);
+        const int over = ~_mm_movemask_ps(_mm_castsi128_ps(within)) & 0xF;
+        for (int i = 0; over && i < 4; ++i) {
+            if (over & (1 << i)) {
+                columns.push_back(x + i);
+            }
+        }
+    }
+    alignas(16) unsigned char peaks[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(peaks), peak);
+    maxDelta = *std::max_element(peaks, peaks + 16);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t limit = vdupq_n_u8(static_cast<uint8_t>(tolerance));
+    uint8x16_t peak = vdupq_n_u8(0);
+    for (; x + 4 <= width; x += 4) {
+        const uint8x16_t delta = vabdq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(a + x)),
+                                          vld1q_u8(reinterpret_cast<const uint8_t*>(b + x)));
+        peak = vmaxq_u8(peak, delta);
+        const uint32x4_t over = vtstq_u32(vreinterpretq_u32_u8(vcgtq_u8(delta, limit)), vdupq_n_u32(0xFFFFFFFF));
+        if (vmaxvq_u32(over)) {
+            uint32_t lanes[4];
+            vst1q_u32(lanes, over);
+            for (int i = 0; i < 4; ++i) {
+                if (lanes[i]) {
+                    columns.push_back(x + i);
+                }
+            }
+        }
+    }
+    maxDelta = vmaxvq_u8(peak);
+#endif
+    for (; x < width; ++x) {
+        const int delta = pixelDelta(a[x], b[x]);
+        maxDelta = std::max(maxDelta, delta);
+        if (delta > tolerance) {
+            columns.push_back(x);
+        }
+    }
+    return maxDelta;
+}
+
+// Whether more than two neighbours share the pixel's exact value; the image border counts as one
+static bool hasManySiblings(const SwiftDiffImage& image, int x, int y) {
+    const unsigned int center = image.at(x, y);
+    int equal = (x == 0 || y == 0 || x == image.width - 1 || y == image.height - 1) ? 1 : 0;
+    for (int ny = std::max(0, y - 1); ny <= std::min(image.height - 1, y + 1); ++ny) {
+        for (int nx = std::max(0, x - 1); nx <= std::min(image.width - 1, x + 1); ++nx) {
+            if ((nx != x || ny != y) && image.at(nx, ny) == center && ++equal > 2) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Whether the pixel looks like an anti-aliased edge in image: few identical neighbours, and a
+// darker and a brighter neighbour of which at least one is in a flat area of both images
+static bool isAntiAliased(const SwiftDiffImage& image, const SwiftDiffImage& other, int x, int y) {
+    const unsigned int center = image.at(x, y);
+    const int luma = pixelLuma(center);
+    int equal = (x == 0 || y == 0 || x == image.width - 1 || y == image.height - 1) ? 1 : 0;
+    int darkest = 0, brightest = 0;
+    int darkX = -1, darkY = -1, brightX = -1, brightY = -1;
+    for (int ny = std::max(0, y - 1); ny <= std::min(image.height - 1, y + 1); ++ny) {
+        for (int nx = std::max(0, x - 1); nx <= std::min(image.width - 1, x + 1); ++nx) {
+            if (nx == x && ny == y) {
+                continue;
+            }
+            const unsigned int neighbour = image.at(nx, ny);
+            if (neighbour == center) {
+                if (++equal > 2) {
+                    return false;
+                }
+                continue;
+            }
+            const int delta = pixelLuma(neighbour) - luma;
+            if (delta < darkest) {
+                darkest = delta;
+                darkX = nx;
+                darkY = ny;
+            } else if (delta > brightest) {
+                brightest = delta;
+                brightX = nx;
+                brightY = ny;
+            }
+        }
+    }
+    if (darkX < 0 || brightX < 0) {
+        return false;
+    }
+    return (hasManySiblings(image, darkX, darkY) && hasManySiblings(other, darkX, darkY))
+        || (hasManySiblings(image, brightX, brightY) && hasManySiblings(other, brightX, brightY));
+}
+
+bool SwiftQTestImageDiff::compare(const unsigned int* expected, int expectedStride,
+                                  const unsigned int* actual, int actualStride,
+                                  int width, int height, int tolerance, bool detectAntiAliasing,
+                                  unsigned int* heatmap, int heatmapStride, QtImageDiffResult* result) {
+    QtImageDiffResult diff = {0, 0, 0, 0, 0, 0, 0};
+    if (!expected || !actual || width <= 0 || height <= 0) {
+        if (result) *result = diff;
+        return false;
+    }
+    tolerance = std::max(0, std::min(255, tolerance));
+    const SwiftDiffImage before = {expected, expectedStride, width, height};
+    const SwiftDiffImage after = {actual, actualStride, width, height};
+    
+    int left = width, top = height, right = -1, bottom = -1;
+    std::vector<int> columns;
+    columns.reserve(static_cast<size_t>(width));
+    for (int y = 0; y < height; ++y) {
+        const unsigned int* rowA = expected + static_cast<size_t>(y) * expectedStride;
+        const unsigned int* rowB = actual + static_cast<size_t>(y) * actualStride;
+        unsigned int* heatRow = heatmap ? heatmap + static_cast<size_t>(y) * heatmapStride : nullptr;
+        if (heatRow) {
+            std::memset(heatRow, 0, static_cast<size_t>(width) * sizeof(unsigned int));
+        }
+        columns.clear();
+        diff.maxDelta = std::max(diff.maxDelta, diffRow(rowA, rowB, width, tolerance, columns));
+        
+        for (int x : columns) {
+            if (detectAntiAliasing && (isAntiAliased(before, after, x, y) || isAntiAliased(after, before, x, y))) {
+                ++diff.antiAliasedPixels;
+                if (heatRow) heatRow[x] = 0xFFFFFF00;
+                continue;
+            }
+            ++diff.differentPixels;
+            if (heatRow) heatRow[x] = 0xFFFF0000;
+            left = std::min(left, x);
+            right = std::max(right, x);
+            top = std::min(top, y);
+            bottom = y;
+        }
+    }
+    if (diff.differentPixels > 0) {
+        diff.left = left;
+        diff.top = top;
+        diff.right = right + 1;
+        diff.bottom = bottom + 1;
+    }
+    if (result) *result = diff;
+    return diff.differentPixels == 0;
+}
+
 // Test assertion function implementations
 bool testAssertIsVisible(SwiftQWidget* widget) {
     if (!widget || !widget->getQWidget()) return false;
@@ -555,27 +1323,7 @@ bool testAssertHasPosition(SwiftQWidget* widget, int x, int y) {
 std::string testAssertGetText(SwiftQWidget* widget) {
     if (!widget || !widget->getQWidget()) return "";
     
-    QWidget* qw = widget->getQWidget();
-    
-    // Try different widget types
-    if (QLabel* label = qobject_cast<QLabel*>(qw)) {
-        return label->text().toStdString();
-    } else if (QPushButton* button = qobject_cast<QPushButton*>(qw)) {
-        return button->text().toStdString();
-    } else if (QLineEdit* lineEdit = qobject_cast<QLineEdit*>(qw)) {
-        return lineEdit->text().toStdString();
-    } else if (QTextEdit* textEdit = qobject_cast<QTextEdit*>(qw)) {
-        return textEdit->toPlainText().toStdString();
-    } else if (QCheckBox* checkBox = qobject_cast<QCheckBox*>(qw)) {
-        return checkBox->text().toStdString();
-    } else if (QRadioButton* radioButton = qobject_cast<QRadioButton*>(qw)) {
-        return radioButton->text().toStdString();
-    } else if (QComboBox* comboBox = qobject_cast<QComboBox*>(qw)) {
-        return comboBox->currentText().toStdString();
-    }
-    
-    // Try window title as fallback
-    return qw->windowTitle().toStdString();
+    return widgetText(widget->getQWidget()).toStdString();
 }
 
 bool testAssertHasText(SwiftQWidget* widget, const std::string& expected) {
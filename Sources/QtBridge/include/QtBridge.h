@@ -8,6 +8,8 @@
 
 // Forward declarations
 class QApplication;
+class QString;
+class QByteArray;
 class QWidget;
 class QLabel;
 class QMessageBox;
@@ -22,6 +24,9 @@ class QDateTimeEdit;
 class QDial;
 class QLCDNumber;
 class QCalendarWidget;
+class SwiftCanvasWidget;  // QWidget that replays a display list, see QtBridge.cpp
+class SwiftPlotWidget;    // QWidget that draws decimated time series, see QtBridge.cpp
+class SwiftTiledImageWidget;  // QWidget that decodes image tiles on demand, see QtBridge.cpp
 
 // Event types enum for comprehensive event handling
 enum class QtEventType {
@@ -32,6 +37,7 @@ enum class QtEventType {
     MouseDoubleClick,
     MouseEnter,
     MouseLeave,
+    MouseMoveBatch,
     
     // Keyboard events
     KeyPress,
@@ -59,6 +65,8 @@ enum class QtEventType {
     TextChanged,
     TextEdited,
     ReturnPressed,
+    EditingFinished,
+    ContentsChanged,
     
     // Selection events
     SelectionChanged,
@@ -66,6 +74,13 @@ enum class QtEventType {
     CurrentTextChanged,
     Activated,
     
+    // Lazy page events
+    PageRequested,
+    PageEvicted,
+    
+    // Scroll events
+    ViewportChanged,
+    
     // Check/Radio events
     StateChanged,
     
@@ -83,6 +98,47 @@ struct QtEventInfo {
     void* customData;
 };
 
+// Incremental document change delivered with QtEventType::ContentsChanged
+// Positions and counts are in document characters (UTF-16 code units)
+struct QtTextDelta {
+    int position;
+    int charsRemoved;
+    int charsAdded;
+    long long revision;      // Document revision after this change was applied
+    const char* addedText;   // UTF-8, only valid for the duration of the callback
+    int addedTextLength;     // Length of addedText in bytes
+};
+
+// Visible part of a scroll area's content, delivered with QtEventType::ViewportChanged
+// In content coordinates; the rect may extend past the content when it is smaller
+struct QtViewportRect {
+    int x;
+    int y;
+    int width;
+    int height;
+    int overscan;            // Margin around the rect worth preparing content for
+};
+
+// One mouse position, delivered with QtEventType::MouseMove and, as an array
+// (customData, intValue = count), with QtEventType::MouseMoveBatch
+struct QtMouseSample {
+    int x;                   // Widget coordinates
+    int y;
+    int buttons;             // Qt::MouseButtons held during the move
+    int modifiers;           // Qt::KeyboardModifiers
+    long long timestamp;     // Event time in milliseconds
+};
+
+// Fixed-size event record written to SwiftEventRing instead of calling back
+struct QtEventRecord {
+    long long widgetTag;     // Tag passed to SwiftQWidget::queueEvents
+    long long timestamp;     // Event time in milliseconds for input events, otherwise 0
+    int type;                // QtEventType
+    int intValue;            // Same meaning as in QtEventInfo
+    int intValue2;
+    int boolValue;
+};
+
 // Universal event callback for Swift
 struct SwiftEventCallback {
     void* context;
@@ -138,12 +194,40 @@ public:
     void scheduleCallback(int delayMs, void (*callback)(void*), void* context);
 };
 
-// Forward declaration
+// Process-wide single-producer/single-consumer ring of QtEventRecord. Event filters of
+// widgets with queued event types (SwiftQWidget::queueEvents) append records instead of
+// calling into Swift, and the consumer copies them out in bulk with read(), so a burst of
+// input costs one crossing rather than one per event. When the ring is full new records
+// are dropped and counted. The drain handler runs once per event loop iteration, just
+// before the loop waits, whenever records are pending.
+class SwiftEventRing {
+public:
+    static void setCapacity(int records);  // Rounded up to a power of two; discards pending records
+    static int capacity();
+    static int pendingCount();
+    static int read(QtEventRecord* buffer, int maxRecords);  // Oldest first; returns the number copied
+    static bool push(const QtEventRecord& record);           // Producer side; false when dropped
+    
+    static long long writtenCount();
+    static long long droppedCount();
+    static void resetCounters();
+    
+    static void setDrainHandler(SwiftCallback callback);
+    static void clearDrainHandler();
+};
+
+// Forward declarations
 class SwiftEventFilter;
+class SwiftSignalCoalescer;  // Rate-limits change notifications, see QtBridge.cpp
+class SwiftStringListModel;  // Item model backing SwiftQComboBox, see QtBridge.cpp
+struct SwiftKeyedChildren;   // Child list of the last setChildren call, see QtBridge.cpp
+struct SwiftMouseBatch;      // Mouse moves awaiting the next batch delivery, see QtBridge.cpp
+class QCompleter;
 
 // Base widget wrapper with comprehensive event support
 class SwiftQWidget {
     friend class SwiftEventFilter;
+    friend class SwiftWidgetRegistry;
     
 protected:
     QWidget* widget;
@@ -154,9 +238,34 @@ protected:
     // Event handling map - stores callbacks by event type
     std::map<QtEventType, SwiftEventCallback> eventCallbacks;
     
+    // Resize coalescing (see setResizeCoalescing)
+    std::shared_ptr<SwiftSignalCoalescer> resizeCoalescer;
+    std::shared_ptr<SwiftSignalCoalescer> resizeSettle;
+    int pendingWidth;
+    int pendingHeight;
+    
+    std::shared_ptr<SwiftKeyedChildren> keyedChildren;
+    
+    // Reused buffer behind the *Utf8 getters
+    mutable std::shared_ptr<QByteArray> utf8Export;
+    std::shared_ptr<SwiftMouseBatch> mouseBatch;
+    
+    // Event types routed to SwiftEventRing (bit per QtEventType) and the tag their records carry
+    unsigned long long queuedEventTypes;
+    long long queueTag;
+    
     virtual void ensureWidget();
     virtual void setupEventFilter();
+    void registerWrapper();
     virtual bool handleEvent(QEvent* event);
+    void deliverResize(bool final);
+    void deliverMouseBatch();
+    
+    // Backs the subclasses' *Utf8 getters: encodes into utf8Export and returns a pointer to it
+    // (not null-terminated) with its byte length, valid until the next *Utf8 call on this
+    // wrapper. The matching setters take (const char* utf8, size_t length), decode once with
+    // QString::fromUtf8 and keep no std::string copy.
+    const char* exportUtf8(const QString& text, size_t* length) const;
     
 public:
     SwiftQWidget();
@@ -192,7 +301,13 @@ public:
     // Parent-child relationship
     void setParent(SwiftQWidget* parent);
     QWidget* getQWidget();
-    std::vector<SwiftQWidget*> getChildren() const;
+    std::vector<SwiftQWidget*> getChildren() const;  // Direct child widgets, as registry wrappers
+    int childCount() const;
+    SwiftQWidget* childAt(int index) const;            // Allocation-free alternative to getChildren
+    // Hides the widget, takes it out of its parent and deletes it on the next event loop
+    // pass. The wrapper forgets the widget right away; setParent(nullptr) only clears the
+    // wrapper's parent and leaves the QWidget where it is.
+    void deleteWidgetLater();
     
     // Window attributes
     void setAttribute(int attribute, bool on = true);
@@ -214,10 +329,127 @@ public:
     int y() const;
     void centerOnScreen();
     
+    // Colors through QPalette rather than style sheets, so changing them does not re-parse
+    // CSS or repolish the subtree. Colors are 0xAARRGGBB. The background also applies to
+    // the Base and Button roles and turns on autoFillBackground; the foreground applies to
+    // WindowText, Text and ButtonText. Identical palettes are interned and shared.
+    void setBackgroundColor(unsigned int argb);
+    void setForegroundColor(unsigned int argb);
+    void clearColors();
+    static int sharedPaletteCount();
+    
+    // Offscreen rendering through QWidget::render, which also works for hidden widgets and on
+    // the offscreen platform. The region is in widget coordinates; width or height <= 0 means
+    // the whole widget. Output is the region scaled by devicePixelRatio and rounded up (see
+    // renderPixelSize), as premultiplied 0xAARRGGBB pixels in rows of stride bytes; buffer
+    // must hold stride * pixelHeight bytes. renderToFile picks the format from the suffix.
+    bool renderPixelSize(double devicePixelRatio, int width, int height, int* pixelWidth, int* pixelHeight);
+    bool renderToImage(unsigned char* buffer, int stride, double devicePixelRatio = 1.0,
+                       int x = 0, int y = 0, int width = 0, int height = 0);
+    bool renderToFile(const std::string& path, double devicePixelRatio = 1.0,
+                      int x = 0, int y = 0, int width = 0, int height = 0);
+    
+    // Native stack layout (flex-style, see SwiftStackLayout in QtBridge.cpp) as an
+    // alternative to positioning children one by one. Children added with addStackChild
+    // are laid out by Qt's layout pass; removing a child from the widget removes it from
+    // the stack. axis: 0 = horizontal, 1 = vertical. alignment (cross axis): 0 = start,
+    // 1 = center, 2 = end, 3 = stretch. justify (main axis, when nothing grows):
+    // 0 = start, 1 = center, 2 = end, 3 = space between.
+    void setStackLayout(int axis, int spacing, int alignment, int justify);
+    void setStackMargins(int left, int top, int right, int bottom);
+    bool hasStackLayout() const;
+    void addStackChild(SwiftQWidget* child, int grow, int shrink);
+    void setStackChildFlex(SwiftQWidget* child, int grow, int shrink);
+    
+    // Keyed reconciliation of the child list. Compares keys with those of the previous call
+    // and applies only the difference: children with vanished keys are removed, new ones
+    // are parented, and of the surviving children only those outside the longest run that
+    // kept its relative order are restacked. Updates are suspended meanwhile. Order is the
+    // z-order, and the layout order when a stack layout is set. Returns the number of Qt
+    // operations (removals, insertions, moves) performed.
+    int setChildren(const long long* keys, SwiftQWidget* const* children, int count);
+    
+    // How Resize events reach the Resize handler. 0 = immediately, 1 = at most once per
+    // display frame with the latest size, 2 = live resize: at most once per liveIntervalMs
+    // while sizes keep coming, then once more when they stop. boolValue in the event info
+    // is false for those intermediate deliveries and true for complete ones.
+    void setResizeCoalescing(int mode, int liveIntervalMs);
+    
+    // Collects mouse moves and delivers them once per display frame as MouseMoveBatch,
+    // with customData pointing at intValue QtMouseSample entries in arrival order. The
+    // array is reused and only valid for the duration of the callback. Pending moves are
+    // delivered before a button press or release so strokes keep their order. tracking
+    // also reports moves while no button is held.
+    void setMouseMoveBatchHandler(SwiftEventCallback callback, bool tracking);
+    
+    // Routes events of the given type to SwiftEventRing as records carrying tag, in place of
+    // the registered handler. The tag is shared by all types of this widget (the latest
+    // wins). Queued events are not consumed, so the widget still processes them.
+    void queueEvents(QtEventType type, long long tag);
+    void unqueueEvents(QtEventType type);
+    
     // Generic event handling
     void setEventHandler(QtEventType type, SwiftEventCallback callback);
     void removeEventHandler(QtEventType type);
     void clearEventHandlers();
+    unsigned long long eventSubscriptionMask() const;  // Bit per QtEventType with a handler or queued
+};
+
+// Maps each QWidget to its canonical SwiftQWidget: the wrapper that created or first adopted
+// it, which carries the typed state and callbacks. For widgets without one, wrapperFor creates
+// a non-owning wrapper on first lookup and keeps it, so repeated lookups and tree walks return
+// the same object and allocate nothing. An entry is dropped when its widget is destroyed (a
+// wrapper the registry created is deleted with it) or when its wrapper is destroyed first.
+// Handles pack a slot index with a generation, so a handle outliving its widget resolves to
+// nullptr instead of to whatever reuses the slot.
+class SwiftWidgetRegistry {
+public:
+    static SwiftQWidget* wrapperFor(QWidget* widget);  // Registered wrapper, created if missing
+    static SwiftQWidget* find(QWidget* widget);        // Registered wrapper or nullptr
+    static unsigned long long handleFor(SwiftQWidget* wrapper);  // 0 if not registered
+    static SwiftQWidget* resolve(unsigned long long handle);
+    static SwiftQWidget* detached();  // Shared wrapper without a widget; every operation on it is a no-op
+    static int size();
+    
+    // Used by SwiftQWidget
+    static void attach(QWidget* widget, SwiftQWidget* wrapper);
+    static void detach(SwiftQWidget* wrapper);
+};
+
+// Live-object accounting for leak checks. Every SwiftQWidget (of any subclass) is counted from
+// construction to destruction, and every QWidget the bridge creates from creation until Qt
+// destroys it. Each object gets a serial number, so a test can take mark() before it runs and
+// collect what was created since and is still alive afterwards. With backtrace capture on,
+// objects also keep the stack they were created from, symbolized only when collected; capture
+// walks the stack on every construction, so it is off by default.
+class SwiftLiveObjects {
+public:
+    enum Kind {
+        Wrapper = 0,   // SwiftQWidget or subclass
+        Widget = 1     // QWidget created by the bridge
+    };
+
+    static void setCaptureBacktraces(bool capture);
+    static bool capturesBacktraces();
+    static unsigned long long mark();        // The serial the next tracked object gets
+    static int liveCount(int kind);
+    static int liveCountOfType(const std::string& typeName);  // e.g. "SwiftQLabel" or "QLabel"
+    static void releaseDeferred();           // Runs pending deleteLater() deletions
+    static long long residentBytes();        // Resident set size of the process, -1 if unknown
+
+    // Snapshot of the objects created at or after `mark` that are still alive, oldest first.
+    // The accessors read the last snapshot.
+    static int collect(unsigned long long mark);
+    static int collectedKind(int index);
+    static unsigned long long collectedSerial(int index);
+    static std::string collectedType(int index);
+    static std::string collectedObjectName(int index);
+    static std::string collectedBacktrace(int index);  // One frame per line, empty without capture
+
+    // Used by SwiftQWidget and the other places that create widgets
+    static void trackWrapper(const SwiftQWidget* wrapper);
+    static void untrackWrapper(const SwiftQWidget* wrapper);
+    static void trackWidget(QWidget* widget);
 };
 
 // Label widget wrapper
@@ -235,7 +467,9 @@ public:
     SwiftQLabel(const std::string& text, SwiftQWidget* parent);
     
     void setText(const std::string& text);
+    void setText(const char* utf8, size_t length);
     std::string text() const;
+    const char* textUtf8(size_t* length) const;
     void setAlignment(int alignment);
     
     // Image support
@@ -266,7 +500,9 @@ public:
     virtual ~SwiftQPushButton();
     
     void setText(const std::string& text);
+    void setText(const char* utf8, size_t length);
     std::string text() const;
+    const char* textUtf8(size_t* length) const;
     void setDefault(bool isDefault);
     void setFlat(bool flat);
     void setCheckable(bool checkable);
@@ -289,46 +525,88 @@ private:
     std::string lineText;
     std::string placeholderText;
     
+    // Store callbacks safely using std::function
+    std::shared_ptr<SwiftSignalCoalescer> textChangedCoalescer;
+    std::function<void()> returnPressedFunc;
+    std::function<void()> editingFinishedFunc;
+    
 protected:
     void ensureWidget() override;
+    void setupConnections();
     
 public:
     SwiftQLineEdit();
     explicit SwiftQLineEdit(const std::string& text);
     SwiftQLineEdit(const std::string& text, SwiftQWidget* parent);
+    virtual ~SwiftQLineEdit();
     
     void setText(const std::string& text);
+    void setText(const char* utf8, size_t length);
     std::string text() const;
+    const char* textUtf8(size_t* length) const;
     void setPlaceholderText(const std::string& text);
     std::string getPlaceholderText() const;
     void setMaxLength(int length);
     void setReadOnly(bool readOnly);
     void clear();
     void selectAll();
+    
+    // Event handlers
+    // coalesceMs > 0 delivers at most one textChanged per window with the latest text;
+    // with debounce the window restarts on every change and delivery waits for a pause.
+    // Pending text is flushed before returnPressed/editingFinished are delivered.
+    void setTextChangedHandler(SwiftEventCallback callback, int coalesceMs, bool debounce);
+    void setReturnPressedHandler(SwiftEventCallback callback);
+    void setEditingFinishedHandler(SwiftEventCallback callback);
 };
 
 // Text edit widget wrapper  
 class SwiftQTextEdit : public SwiftQWidget {
 private:
     std::string textContent;
+    long long documentRevision;
+    mutable long long exportedRevision;  // Revision whose plain text utf8Export holds, -1 if none
+    
+    // Store callbacks safely using std::function
+    std::function<void(int, int, int)> contentsChangeFunc;
+    std::shared_ptr<SwiftSignalCoalescer> textChangedCoalescer;
     
 protected:
     void ensureWidget() override;
+    void setupConnections();
     
 public:
     SwiftQTextEdit();
     explicit SwiftQTextEdit(const std::string& text);
     SwiftQTextEdit(SwiftQWidget* parent);
+    virtual ~SwiftQTextEdit();
     
     void setText(const std::string& text);
     std::string toPlainText() const;
     void setPlainText(const std::string& text);
     void setHtml(const std::string& html);
     std::string toHtml() const;
+    void setPlainText(const char* utf8, size_t length);
+    void setHtml(const char* utf8, size_t length);
+    const char* toPlainTextUtf8(size_t* length) const;  // Not re-encoded while the revision is unchanged
+    const char* toHtmlUtf8(size_t* length) const;
     void clear();
     void setReadOnly(bool readOnly);
     void setPlaceholderText(const std::string& text);
     std::string placeholderText() const;
+    
+    // Incremental document access
+    // The revision is bumped on every QTextDocument::contentsChange, so callers
+    // can detect edits without serializing the whole document
+    long long revision() const;
+    int characterCount() const;
+    std::string textRange(int from, int length) const;  // length < 0 reads to the end
+    
+    // Delivers a QtTextDelta (via QtEventInfo::customData) for every document edit
+    void setContentsChangedHandler(SwiftEventCallback callback);
+    
+    // Delivers the full plain text; see SwiftQLineEdit for coalesceMs/debounce
+    void setTextChangedHandler(SwiftEventCallback callback, int coalesceMs, bool debounce);
 };
 
 // Check box widget wrapper
@@ -337,13 +615,18 @@ private:
     std::string checkText;
     int checkState;
     
+    // Store callbacks safely using std::function
+    std::shared_ptr<SwiftSignalCoalescer> stateChangedCoalescer;
+    
 protected:
     void ensureWidget() override;
+    void setupConnections();
     
 public:
     SwiftQCheckBox();
     explicit SwiftQCheckBox(const std::string& text);
     SwiftQCheckBox(const std::string& text, SwiftQWidget* parent);
+    virtual ~SwiftQCheckBox();
     
     void setText(const std::string& text);
     std::string text() const;
@@ -352,6 +635,9 @@ public:
     void setTristate(bool tristate);
     void setCheckState(int state); // 0=unchecked, 1=partially, 2=checked
     int getCheckState() const;
+    
+    // Event handlers - intValue carries the check state; see SwiftQLineEdit for coalesceMs/debounce
+    void setStateChangedHandler(SwiftEventCallback callback, int coalesceMs, bool debounce);
 };
 
 // Radio button widget wrapper
@@ -377,9 +663,16 @@ public:
 // Combo box widget wrapper with safe event handling
 class SwiftQComboBox : public SwiftQWidget {
 private:
-    std::vector<std::string> items;
+    // The model is the only copy of the item strings; it is created on first use
+    std::shared_ptr<SwiftStringListModel> itemModel;
     int currentIdx;
     
+    // Editable-mode filtering (see setFilterMode)
+    int filterMode;
+    int maxFilterResults;
+    QCompleter* filterCompleter;
+    std::vector<int> filterRows;
+    
     // Store callbacks safely using std::function
     std::function<void(int)> indexChangedFunc;
     std::function<void(const std::string&)> textChangedFunc;
@@ -389,6 +682,9 @@ private:
 protected:
     void ensureWidget() override;
     void setupConnections();
+    SwiftStringListModel* model();
+    void applyFilterMode();
+    void refreshFilter();
     
 public:
     SwiftQComboBox();
@@ -407,6 +703,19 @@ public:
     void setEditable(bool editable);
     bool isEditable() const;
     
+    // Bulk population from UTF-8 strings: one model reset (or one row insertion)
+    // instead of a signal round-trip per item
+    void setItems(const char* const* items, int count);
+    void addItems(const char* const* items, int count);
+    
+    // Filtering for editable combo boxes: 0 = Qt's default completer, 1 = prefix,
+    // 2 = substring. Matches come from an index built on the model, not a row scan.
+    void setFilterMode(int mode);
+    int getFilterMode() const;
+    void setMaxFilterResults(int maxResults);
+    // Writes up to maxRows matching row indices into outRows, returns the number written
+    int findItems(const std::string& query, int* outRows, int maxRows) const;
+    
     // Legacy event handling (for compatibility)
     void setIndexChangedHandler(SwiftCallbackInt callback);
     void setTextChangedHandler(SwiftCallbackString callback);
@@ -489,6 +798,25 @@ public:
     void setSliderMovedHandler(SwiftEventCallback callback);
 };
 
+// Counter shared between worker threads and display widgets. Copies share one atomic
+// value; add, set and value may be called from any thread without locking. Widgets attached
+// to a channel sample it on a timer, so workers never touch Qt.
+struct SwiftProgressCounter;
+class SwiftProgressChannel {
+private:
+    std::shared_ptr<SwiftProgressCounter> counter;
+    
+public:
+    SwiftProgressChannel();
+    
+    void add(long long delta) const;
+    void set(long long value) const;
+    long long value() const;
+    
+    // For attaching widgets
+    std::shared_ptr<SwiftProgressCounter> shared() const { return counter; }
+};
+
 // Progress bar widget wrapper
 class SwiftQProgressBar : public SwiftQWidget {
 private:
@@ -521,15 +849,25 @@ public:
     int orientation() const;
     
     void reset();
+    
+    // Shows the channel's value, sampled every intervalMs (0 = once per display frame).
+    // The bar is only updated when the sample changes what it shows: the filled length,
+    // the percentage or, if the format uses %v, the value text.
+    void attachProgressChannel(const SwiftProgressChannel& channel, int intervalMs);
+    void detachProgressChannel();
 };
 
 // Scroll area widget wrapper
 class SwiftQScrollArea : public SwiftQWidget {
 private:
     SwiftQWidget* contentWidget;
+    std::shared_ptr<SwiftSignalCoalescer> viewportCoalescer;
+    int viewportOverscan;
     
 protected:
     void ensureWidget() override;
+    bool handleEvent(QEvent* event) override;
+    void deliverViewport();
     
 public:
     SwiftQScrollArea();
@@ -557,6 +895,14 @@ public:
     void setVerticalScrollValue(int value);
     int horizontalScrollMaximum() const;
     int verticalScrollMaximum() const;
+    
+    // Reports the visible content rect (ViewportChanged, customData -> QtViewportRect)
+    // whenever the scroll position, the content size or the area size changes, at most
+    // once per display frame, and once right away. overscan is passed along unchanged.
+    void setViewportChangedHandler(SwiftEventCallback callback, int overscan);
+    // Delivers a viewport change still waiting for the next frame right away
+    void flushViewportChanged();
+    void visibleContentRect(int* x, int* y, int* width, int* height) const;
 };
 
 // Tab widget wrapper
@@ -565,6 +911,26 @@ private:
     QTabWidget* tabWidget;
     void ensureWidget();
     
+    // A lazy tab shows an empty placeholder until it first becomes current
+    struct LazyTab {
+        int id;
+        QWidget* placeholder;
+        QWidget* page;
+        SwiftEventCallback factory;
+        long long lastActivation;
+    };
+    std::vector<LazyTab> lazyTabs;
+    int nextLazyTabId;
+    long long activationCount;
+    int evictAfterActivations;
+    bool connected;
+    std::function<void(int)> currentChangedFunc;
+    
+    void setupConnections();
+    void handleCurrentChanged(int index);
+    void evictIdleTabs();
+    void releaseLazyTab(QWidget* page);
+    
 public:
     SwiftQTabWidget();
     explicit SwiftQTabWidget(SwiftQWidget* parent);
@@ -579,6 +945,17 @@ public:
     void setTabEnabled(int index, bool enabled);
     bool isTabEnabled(int index) const;
     
+    // Lazy tabs. The factory receives PageRequested (intValue = tab id, intValue2 = tab index)
+    // when the tab first becomes current and must hand the page over with setLazyTabPage.
+    // When eviction is enabled it later receives PageEvicted with the same fields, after
+    // which the page is deleted; it is requested again on the next visit.
+    int addLazyTab(const std::string& label, SwiftEventCallback factory);  // Returns the tab id
+    void setLazyTabPage(int tabId, SwiftQWidget* page);
+    int lazyTabIndex(int tabId) const;
+    bool isLazyTabMaterialized(int tabId) const;
+    // Evict pages not visited in the last maxIdleActivations tab changes (0 disables)
+    void setLazyTabEviction(int maxIdleActivations);
+    
     // Current tab
     int currentIndex() const;
     void setCurrentIndex(int index);
@@ -600,6 +977,9 @@ public:
     // Tab bar visibility
     void setTabBarAutoHide(bool hide);
     bool tabBarAutoHide() const;
+    
+    // Event handling
+    void setCurrentChangedHandler(SwiftEventCallback callback);
 };
 
 // Splitter widget wrapper
@@ -927,6 +1307,11 @@ public:
     // Small decimal point
     bool smallDecimalPoint() const;
     void setSmallDecimalPoint(bool small);
+    
+    // Displays the channel's value, sampled every intervalMs (0 = once per display frame)
+    // and redrawn only when it changed
+    void attachProgressChannel(const SwiftProgressChannel& channel, int intervalMs);
+    void detachProgressChannel();
 };
 
 // Calendar widget wrapper
@@ -967,6 +1352,161 @@ public:
     int selectionMode() const;
 };
 
+// Retained-mode canvas. Content is a display list of keyed items (rects, lines, paths,
+// text runs, images) encoded by the caller into a binary buffer; see SwiftCanvasWidget in
+// QtBridge.cpp for the record format. paintEvent replays only the items whose bounds
+// intersect the dirty region, and updates compare records byte for byte so unchanged
+// items cost neither a repaint nor a re-record.
+class SwiftQCanvas : public SwiftQWidget {
+private:
+    SwiftCanvasWidget* canvas;
+    void ensureWidget();
+    
+public:
+    SwiftQCanvas();
+    explicit SwiftQCanvas(SwiftQWidget* parent);
+    virtual ~SwiftQCanvas();
+    
+    // Replaces the display list: items whose id is absent from the buffer are removed.
+    // Returns the number of items added, changed or removed.
+    int setDisplayList(const unsigned char* data, size_t size);
+    // Adds or replaces only the items in the buffer; new ids paint on top.
+    int updateDisplayList(const unsigned char* data, size_t size);
+    int removeItems(const int* ids, int count);
+    void clearDisplayList();
+    int itemCount() const;
+    // Items replayed by the most recent paint, for checking partial repaints
+    int lastPaintedItemCount() const;
+};
+
+// Time-series plot for large sample counts. Each series holds columnar x/y samples (x
+// ascending) plus a multi-resolution min/max pyramid over y, so painting costs one min/max
+// pair per pixel column regardless of how many samples fall into it. Appends extend the
+// pyramid incrementally. Samples are copied once on the way in.
+class SwiftQPlot : public SwiftQWidget {
+private:
+    SwiftPlotWidget* plot;
+    void ensureWidget();
+    
+public:
+    SwiftQPlot();
+    explicit SwiftQPlot(SwiftQWidget* parent);
+    virtual ~SwiftQPlot();
+    
+    // Returns the series id
+    int addSeries(unsigned int argb, double lineWidth);
+    // x may be null, in which case sample i sits at x = i (and appends must omit x too)
+    void setSeriesData(int series, const double* x, const double* y, size_t count);
+    void appendSeriesData(int series, const double* x, const double* y, size_t count);
+    size_t seriesSampleCount(int series) const;
+    void clearSeries(int series);
+    // Min and max of y over samples [begin, end), read through the pyramid the way a paint
+    // reads one pixel column; false if the range is empty or out of bounds
+    bool seriesRangeMinMax(int series, size_t begin, size_t end, double* min, double* max) const;
+    
+    // Visible x range; xMin >= xMax fits all data
+    void setXRange(double xMin, double xMax);
+    // Shows the last `width` x units and follows appended samples; 0 turns it off
+    void setFollowWindow(double width);
+    // Visible y range; yMin >= yMax fits the visible samples
+    void setYRange(double yMin, double yMax);
+    
+    // Points passed to drawPolyline by the most recent paint, over all series
+    int lastPointCount() const;
+};
+
+// Viewer for images too large to decode at once. Only the tiles visible at the current
+// zoom are decoded, with QImageReader clip rects and scaled sizes, on a background thread
+// pool. Tiles of each mip level (level n is the image at 1/2^n) are kept in a byte-bounded
+// LRU cache; while a tile is decoding, a cached coarser level is drawn in its place.
+class SwiftQTiledImageView : public SwiftQWidget {
+private:
+    SwiftTiledImageWidget* viewer;
+    void ensureWidget();
+    
+public:
+    SwiftQTiledImageView();
+    explicit SwiftQTiledImageView(SwiftQWidget* parent);
+    virtual ~SwiftQTiledImageView();
+    
+    // Reads only the header; returns false if the file is not a readable image
+    bool load(const std::string& path);
+    int imageWidth() const;
+    int imageHeight() const;
+    
+    // Zoom is widget pixels per image pixel. The image point under the anchor (in widget
+    // coordinates) stays in place.
+    void setZoom(double zoom, double anchorX, double anchorY);
+    double zoom() const;
+    // Moves the image by the given widget pixels
+    void panBy(double dx, double dy);
+    void fitToView();
+    // Drag to pan and wheel to zoom (on by default)
+    void setInteractive(bool interactive);
+    
+    void setCacheLimit(long long bytes);
+    long long cachedBytes() const;
+    // Tiles queued or decoding
+    int pendingTileCount() const;
+};
+
+// Renders many widgets to image files in one call. Widgets are rendered one at a time on the
+// calling (GUI) thread while a thread pool encodes the finished images, so encoding overlaps
+// rendering; at most two images per thread wait for encoding at any time. Regions follow
+// SwiftQWidget::renderToImage and the format comes from each path's suffix.
+struct SwiftRenderBatchData;
+class SwiftRenderBatch {
+private:
+    std::shared_ptr<SwiftRenderBatchData> data;
+    
+public:
+    SwiftRenderBatch();
+    void setDevicePixelRatio(double ratio);
+    void setThreadCount(int count);   // 0 (the default) uses QThread::idealThreadCount
+    void setQuality(int quality);     // QImageWriter quality, -1 for the default; lower PNG quality encodes faster
+    void add(SwiftQWidget* widget, const std::string& path, int x = 0, int y = 0, int width = 0, int height = 0);
+    int count() const;
+    void clear();
+    int run();                        // Blocks until every file is written; returns how many were
+    bool succeeded(int index) const;  // Outcome of the last run
+};
+
+// Compact binary capture of a widget subtree: class names, object names, geometry, hidden
+// state, the Qt properties (bool, integer, enum, floating point and string) that differ from
+// a default-constructed widget of the same class, and each widget's event-subscription mask.
+// Strings are interned once. Only plain containers (QWidget, QFrame, QGroupBox, QSplitter)
+// are descended into; composite widgets rebuild their internals themselves, and custom
+// painted widgets come back as plain QWidgets. Byte order is native.
+// load() memory-maps the file and reads the records in place. restore() adds the snapshot's
+// children to an existing widget (applying the root record to it) in one pass with updates
+// disabled. toText() renders a stable line-per-widget listing for diffing in tests.
+struct SwiftWidgetSnapshotData;
+class SwiftWidgetSnapshot {
+private:
+    std::shared_ptr<SwiftWidgetSnapshotData> data;
+    
+public:
+    SwiftWidgetSnapshot();
+    
+    bool capture(SwiftQWidget* root);
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+    bool loadBytes(const unsigned char* bytes, size_t size);  // Copies the bytes
+    const unsigned char* bytes() const;
+    size_t byteCount() const;
+    
+    // Records are in pre-order; index 0 is the root
+    int widgetCount() const;
+    std::string className(int index) const;
+    std::string objectName(int index) const;
+    unsigned long long eventMask(int index) const;
+    
+    bool restore(SwiftQWidget* target);
+    SwiftQWidget* restoredWidget(int index) const;  // Registry wrapper of what restore() built for a record
+    
+    std::string toText() const;
+};
+
 // Message box wrapper
 class SwiftQMessageBox {
 public:
@@ -991,6 +1531,18 @@ public:
     static void showCritical(SwiftQWidget* parent, const std::string& title, const std::string& text);
     static bool showQuestion(SwiftQWidget* parent, const std::string& title, const std::string& text);
     static void showAbout(SwiftQWidget* parent, const std::string& title, const std::string& text);
+    
+    // Non-blocking variant: shows the box with QMessageBox::open() and returns at once.
+    // The callback receives a Clicked event with intValue = the StandardButton chosen and
+    // intValue2 = how many identical alerts were folded into the box. While a box with the
+    // same parent, icon, title and text is open, another call only bumps its count and
+    // queues the callback. A box deleted before it finishes (with its parent) reports
+    // QMessageBox::Cancel. Returns the number of alerts the box now represents.
+    static int openAsync(SwiftQWidget* parent, int icon, const std::string& title, 
+                         const std::string& text, int buttons, SwiftEventCallback callback);
+    static int openAsyncCount();
+    // Finishes every open async box as if `button` had been clicked
+    static void finishAllAsync(int button);
 };
 
 // Factory functions for Swift
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string>
 
 // Forward declarations
@@ -61,6 +63,8 @@ public:
 };
 
 // Widget finder for testing - simplified interface
+// Returned widgets are the canonical wrappers from SwiftWidgetRegistry (QtBridge.h); they are
+// owned elsewhere and must not be deleted by the caller.
 class SwiftQTestFinder {
 private:
     SwiftQWidget* rootWidget;
@@ -109,6 +113,9 @@ public:
     void mousePressCenter(SwiftQWidget* widget, int button);
     void mouseRelease(SwiftQWidget* widget, int button, int x, int y);
     void mouseReleaseCenter(SwiftQWidget* widget, int button);
+    // Sends count mouse moves straight to the widget, bypassing the window system, to
+    // measure event delivery. Positions sweep the widget diagonally. Returns the number sent.
+    int sendMouseMoves(SwiftQWidget* widget, int count);
     
     // Keyboard events - key and modifiers are int constants
     void keyClick(SwiftQWidget* widget, int key, int modifiers, int delay);
@@ -120,6 +127,14 @@ public:
     void keyClicks(SwiftQWidget* widget, const std::string& text, int modifiers, int delay);
     void keyClicksNoMod(SwiftQWidget* widget, const std::string& text);  // No modifiers, no delay
     void keySequence(SwiftQWidget* widget, const std::string& sequence);
+    // Bulk text entry for large payloads. Focuses widget, then delivers utf8 (any characters)
+    // to its focus widget and processes events once at the end instead of per character.
+    // mode 0 commits the whole text as one QInputMethodEvent, the fastest way to fill a field;
+    // mode 1 posts a key press and release per character ('\n' as Return), so key handlers and
+    // validators see every keystroke. With verify, returns -1 unless the text of the focus
+    // widget that took the input (as testAssertGetText reads it) equals utf8 afterwards;
+    // otherwise returns the number of characters delivered.
+    int typeTextBulk(SwiftQWidget* widget, const char* utf8, size_t length, int mode, bool verify);
     
     // Focus events
     void setFocus(SwiftQWidget* widget);
@@ -131,6 +146,109 @@ public:
     void processEventsDefault();  // Process without wait
 };
 
+// One input event of a SwiftQTestInputLog. Positions are in the coordinates of the top-level
+// window, so a log replays into any window laid out the same way.
+struct QtInputRecord {
+    long long time;   // Microseconds since recording started
+    int type;         // QEvent::Type: mouse press, release or move, wheel, key press or release
+    int code;         // Mouse button, key, or vertical wheel angle delta
+    float x, y;       // Pointer position for mouse and wheel events
+    int modifiers;
+    int buttons;      // Buttons held for mouse and wheel events
+    int text;         // Key text as one Unicode code point, or horizontal wheel angle delta
+    int flags;        // 1 = key autorepeat
+};
+
+// Records real input reaching a widget's window and replays it. Recording uses an app-wide
+// event filter and captures events as delivered to the top-level QWindow, before Qt
+// propagates them through the widgets; double clicks are not stored because Qt synthesizes
+// them from the presses. The log serializes as "QWIN", u16 version, u16 reserved, u32 count
+// and count 40-byte QtInputRecords in native byte order.
+//
+// replay feeds the events back into the window of root, speed times faster than recorded,
+// or with speed 0 as fast as the event loop drains them. Mouse events go through
+// QWindowSystemInterface with their recorded buttons, modifiers and timestamp gaps, so Qt
+// pairs replayed presses into double clicks as it did live; keys go through QTest. Each injected event
+// is a step whose latency is the time until the window next paints, or -1 if it did not
+// paint before the next step.
+struct SwiftQTestInputLogData;
+class SwiftQTestInputLog {
+private:
+    std::shared_ptr<SwiftQTestInputLogData> data;
+    
+public:
+    SwiftQTestInputLog();
+    
+    // Recording
+    bool startRecording(SwiftQWidget* root);  // Replaces the current log
+    void stopRecording();
+    bool isRecording() const;
+    void append(const QtInputRecord& record);  // For scripted logs
+    void clear();
+    int eventCount() const;
+    QtInputRecord eventAt(int index) const;
+    
+    // Serialization
+    const unsigned char* bytes() const;  // Valid until the log changes
+    size_t byteCount() const;
+    bool loadBytes(const unsigned char* bytes, size_t size);
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+    
+    // Replay
+    int replay(SwiftQWidget* root, double speed);  // Returns the number of events injected
+    int latencyCount() const;
+    long long latencyAt(int index) const;  // Microseconds, -1 without a paint
+};
+
+// Measures how a window renders while active. A frame is one repaint pass of the window:
+// the UpdateRequest on its top-level widget that syncs and paints every dirty widget, timed
+// from the request reaching the window until Qt has finished handling it; the request is
+// observed, never re-sent or consumed. Input latency runs from a mouse, wheel or key event reaching the window
+// (from the window system or QTest, as SwiftQTestSimulator and SwiftQTestInputLog inject
+// them) to the end of the next frame. Times are in microseconds.
+struct SwiftQTestPerfScopeData;
+class SwiftQTestPerfScope {
+private:
+    std::shared_ptr<SwiftQTestPerfScopeData> data;
+    
+public:
+    SwiftQTestPerfScope();
+    bool start(SwiftQWidget* root);  // Discards earlier measurements
+    void stop();
+    bool isActive() const;
+    long long elapsed() const;       // Since start, up to stop
+    int frameCount() const;
+    long long frameTimeAt(int index) const;
+    int inputCount() const;
+    int inputTypeAt(int index) const;          // QEvent::Type
+    long long inputLatencyAt(int index) const; // -1 if no frame followed before stop
+};
+
+// Result of SwiftQTestImageDiff::compare
+struct QtImageDiffResult {
+    int differentPixels;    // Over the tolerance and not anti-aliasing
+    int antiAliasedPixels;  // Over the tolerance but excused as anti-aliased edges
+    int maxDelta;           // Largest channel difference anywhere, 0-255
+    int left, top, right, bottom;  // Box around the differing pixels, right/bottom exclusive; all 0 if none
+};
+
+// Image comparison for visual regression tests. Images are 0xAARRGGBB pixels as produced by
+// SwiftQWidget::renderToImage, with strides in pixels. A pixel differs when any channel
+// differs by more than tolerance; rows are scanned four pixels at a time with SSE2 or NEON,
+// and only the pixels found to differ get further work. With detectAntiAliasing, a differing
+// pixel that lies on an edge in either image (between a darker and a brighter neighbour, at
+// least one of which sits in a flat area of both images) counts as anti-aliasing instead.
+// The optional heatmap gets red for differing pixels, yellow for anti-aliased ones and
+// transparent elsewhere. Returns true when no pixel differs.
+class SwiftQTestImageDiff {
+public:
+    static bool compare(const unsigned int* expected, int expectedStride,
+                        const unsigned int* actual, int actualStride,
+                        int width, int height, int tolerance, bool detectAntiAliasing,
+                        unsigned int* heatmap, int heatmapStride, QtImageDiffResult* result);
+};
+
 // Test assertions helper - C-style functions for Swift compatibility
 // Widget state assertions
 bool testAssertIsVisible(SwiftQWidget* widget);
@@ -19,8 +19,8 @@ public class Button: SafeEventWidget, QtWidget, QtClickable {
     
     /// The text displayed on the button
     public var text: String {
-        get { String(qtButton.pointee.text()) }
-        set { qtButton.pointee.setText(std.string(newValue)) }
+        get { stringFromUTF8Export { qtButton.pointee.textUtf8($0) } }
+        set { withUTF8Argument(newValue) { qtButton.pointee.setText($0, $1) } }
     }
     
     /// Whether this is the default button (responds to Enter key)
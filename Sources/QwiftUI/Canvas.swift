@@ -0,0 +1,347 @@
+// ABOUTME: Canvas provides a retained-mode drawing surface backed by a display list
+// ABOUTME: DisplayList records keyed drawing items into the binary format SwiftQCanvas replays
+
+import Foundation
+import QtBridge
+
+/// A list of keyed drawing items, encoded for a ``Canvas``.
+///
+/// Each item has an id chosen by the caller. Recording an item with an id the canvas
+/// already shows replaces that item in place (keeping its stacking position), and an
+/// item whose encoding is unchanged is skipped entirely, so a display list can be
+/// re-recorded cheaply or sent as a small update containing only what moved.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// var ticks = DisplayList()
+/// for i in 0..<360 {
+///     let angle = Double(i) * .pi / 180
+///     ticks.line(id: i, from: (100 + 80 * cos(angle), 100 + 80 * sin(angle)),
+///                to: (100 + 90 * cos(angle), 100 + 90 * sin(angle)),
+///                color: Qt.Color(argb: 0xFF404040))
+/// }
+/// canvas.setDisplayList(ticks)
+///
+/// var needle = DisplayList()
+/// needle.line(id: 1000, from: (100, 100), to: (160, 40), color: Qt.Color(argb: 0xFFFF0000), width: 3)
+/// canvas.update(with: needle)
+/// ```
+public struct DisplayList: Sendable {
+    /// Builds the outline of a path item.
+    public struct PathBuilder: Sendable {
+        fileprivate var bytes: [UInt8] = []
+        fileprivate var count: UInt32 = 0
+        
+        public mutating func move(to x: Double, _ y: Double) {
+            command(0, [x, y])
+        }
+        
+        public mutating func line(to x: Double, _ y: Double) {
+            command(1, [x, y])
+        }
+        
+        public mutating func quad(control cx: Double, _ cy: Double, to x: Double, _ y: Double) {
+            command(2, [cx, cy, x, y])
+        }
+        
+        public mutating func curve(
+            control1 c1x: Double, _ c1y: Double,
+            control2 c2x: Double, _ c2y: Double,
+            to x: Double, _ y: Double
+        ) {
+            command(3, [c1x, c1y, c2x, c2y, x, y])
+        }
+        
+        public mutating func close() {
+            command(4, [])
+        }
+        
+        private mutating func command(_ op: UInt8, _ coordinates: [Double]) {
+            bytes.append(op)
+            for value in coordinates {
+                DisplayList.append(Float(value), to: &bytes)
+            }
+            count += 1
+        }
+    }
+    
+    /// The encoded records
+    public private(set) var bytes: [UInt8] = []
+    
+    /// The number of items recorded
+    public private(set) var count = 0
+    
+    public init() {}
+    
+    /// Records a rectangle.
+    public mutating func rect(
+        id: Int,
+        x: Double, y: Double, width: Double, height: Double,
+        fill: Qt.Color? = nil,
+        stroke: Qt.Color? = nil,
+        lineWidth: Double = 1,
+        cornerRadius: Double = 0
+    ) {
+        record(id: id, kind: 1) { bytes in
+            for value in [x, y, width, height] {
+                Self.append(Float(value), to: &bytes)
+            }
+            Self.append(fill?.argb ?? 0, to: &bytes)
+            Self.append(stroke?.argb ?? 0, to: &bytes)
+            Self.append(Float(lineWidth), to: &bytes)
+            Self.append(Float(cornerRadius), to: &bytes)
+        }
+    }
+    
+    /// Records a straight line.
+    public mutating func line(
+        id: Int,
+        from start: (x: Double, y: Double),
+        to end: (x: Double, y: Double),
+        color: Qt.Color,
+        width: Double = 1
+    ) {
+        record(id: id, kind: 2) { bytes in
+            for value in [start.x, start.y, end.x, end.y] {
+                Self.append(Float(value), to: &bytes)
+            }
+            Self.append(color.argb, to: &bytes)
+            Self.append(Float(width), to: &bytes)
+        }
+    }
+    
+    /// Records a path built by `build`.
+    public mutating func path(
+        id: Int,
+        fill: Qt.Color? = nil,
+        stroke: Qt.Color? = nil,
+        lineWidth: Double = 1,
+        _ build: (inout PathBuilder) -> Void
+    ) {
+        var builder = PathBuilder()
+        build(&builder)
+        record(id: id, kind: 3) { bytes in
+            Self.append(fill?.argb ?? 0, to: &bytes)
+            Self.append(stroke?.argb ?? 0, to: &bytes)
+            Self.append(Float(lineWidth), to: &bytes)
+            Self.append(builder.count, to: &bytes)
+            bytes.append(contentsOf: builder.bytes)
+        }
+    }
+    
+    /// Records a run of text with its baseline starting at (x, y).
+    ///
+    /// - Parameter pointSize: The font size; 0 uses the canvas font
+    public mutating func text(
+        id: Int,
+        _ string: String,
+        x: Double, y: Double,
+        color: Qt.Color,
+        pointSize: Double = 0
+    ) {
+        let utf8 = Array(string.utf8)
+        record(id: id, kind: 4) { bytes in
+            Self.append(Float(x), to: &bytes)
+            Self.append(Float(y), to: &bytes)
+            Self.append(Float(pointSize), to: &bytes)
+            Self.append(color.argb, to: &bytes)
+            Self.append(UInt32(utf8.count), to: &bytes)
+            bytes.append(contentsOf: utf8)
+        }
+    }
+    
+    /// Records an image scaled into the given rectangle.
+    ///
+    /// - Parameter pixels: Row-major 0xAARRGGBB pixels, `pixelWidth * pixelHeight` of them
+    public mutating func image(
+        id: Int,
+        x: Double, y: Double, width: Double, height: Double,
+        pixels: [UInt32], pixelWidth: Int, pixelHeight: Int
+    ) {
+        precondition(pixels.count == pixelWidth * pixelHeight, "image needs pixelWidth * pixelHeight pixels")
+        record(id: id, kind: 5) { bytes in
+            for value in [x, y, width, height] {
+                Self.append(Float(value), to: &bytes)
+            }
+            Self.append(UInt32(pixelWidth), to: &bytes)
+            Self.append(UInt32(pixelHeight), to: &bytes)
+            pixels.withUnsafeBytes { bytes.append(contentsOf: $0) }
+        }
+    }
+    
+    /// Removes every recorded item.
+    public mutating func removeAll() {
+        bytes.removeAll(keepingCapacity: true)
+        count = 0
+    }
+    
+    // Header: u32 id, u8 kind, 3 reserved bytes, u32 payload size (patched after the payload)
+    private mutating func record(id: Int, kind: UInt8, _ payload: (inout [UInt8]) -> Void) {
+        Self.append(UInt32(truncatingIfNeeded: id), to: &bytes)
+        bytes.append(contentsOf: [kind, 0, 0, 0])
+        let sizeOffset = bytes.count
+        Self.append(UInt32(0), to: &bytes)
+        payload(&bytes)
+        let size = UInt32(bytes.count - sizeOffset - 4)
+        withUnsafeBytes(of: size) { sizeBytes in
+            bytes.replaceSubrange(sizeOffset..<sizeOffset + 4, with: sizeBytes)
+        }
+        count += 1
+    }
+    
+    fileprivate static func append<T>(_ value: T, to bytes: inout [UInt8]) {
+        withUnsafeBytes(of: value) { bytes.append(contentsOf: $0) }
+    }
+}
+
+/// A drawing surface that paints a retained display list.
+///
+/// The canvas keeps the items of the last ``setDisplayList(_:)`` and repaints by
+/// replaying them with QPainter. Only items whose bounds intersect the dirty region
+/// are replayed, and updates repaint only the area of the items that actually changed.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let canvas = Canvas()
+/// var list = DisplayList()
+/// list.rect(id: 1, x: 10, y: 10, width: 80, height: 40, fill: Qt.Color(argb: 0xFF3070C0), cornerRadius: 6)
+/// list.text(id: 2, "Ready", x: 20, y: 35, color: Qt.Color(argb: 0xFFFFFFFF))
+/// canvas.setDisplayList(list)
+/// ```
+@MainActor
+public class Canvas: SafeEventWidget, QtWidget {
+    /// The underlying Qt canvas stored as a pointer
+    nonisolated(unsafe) internal var qtCanvas: UnsafeMutablePointer<SwiftQCanvas>
+    
+    /// Protocol conformance - provide mutable pointer
+    public func getBridgeWidget() -> UnsafeMutablePointer<SwiftQWidget> {
+        // Cast from SwiftQCanvas* to SwiftQWidget* (base class pointer)
+        return UnsafeMutableRawPointer(qtCanvas).assumingMemoryBound(to: SwiftQWidget.self)
+    }
+    
+    /// The number of items on the canvas
+    public var itemCount: Int {
+        Int(qtCanvas.pointee.itemCount())
+    }
+    
+    /// The number of items replayed by the most recent paint
+    public var lastPaintedItemCount: Int {
+        Int(qtCanvas.pointee.lastPaintedItemCount())
+    }
+    
+    /// Creates a new canvas
+    ///
+    /// - Parameter parent: The parent widget. If nil, creates a top-level canvas.
+    public init(parent: (any QtWidget)? = nil) {
+        qtCanvas = UnsafeMutablePointer<SwiftQCanvas>.allocate(capacity: 1)
+        
+        if let parent = parent {
+            qtCanvas.initialize(to: SwiftQCanvas(parent.getBridgeWidget()))
+        } else {
+            qtCanvas.initialize(to: SwiftQCanvas())
+        }
+        
+        super.init()
+    }
+    
+    deinit {
+        let ptr = qtCanvas
+        ptr.deinitialize(count: 1)
+        ptr.deallocate()
+    }
+    
+    /// Replaces the canvas content with `list`.
+    ///
+    /// Items with ids missing from `list` are removed; items whose encoding did not
+    /// change are neither re-recorded nor repainted.
+    ///
+    /// - Returns: The number of items added, changed or removed
+    @discardableResult
+    public func setDisplayList(_ list: DisplayList) -> Int {
+        list.bytes.withUnsafeBufferPointer { buffer in
+            Int(qtCanvas.pointee.setDisplayList(buffer.baseAddress, buffer.count))
+        }
+    }
+    
+    /// Adds or replaces the items in `list`, leaving all other items as they are.
+    ///
+    /// - Returns: The number of items added or changed
+    @discardableResult
+    public func update(with list: DisplayList) -> Int {
+        list.bytes.withUnsafeBufferPointer { buffer in
+            Int(qtCanvas.pointee.updateDisplayList(buffer.baseAddress, buffer.count))
+        }
+    }
+    
+    /// Removes the items with the given ids.
+    ///
+    /// - Returns: The number of items removed
+    @discardableResult
+    public func removeItems(_ ids: [Int]) -> Int {
+        let values = ids.map { Int32(truncatingIfNeeded: $0) }
+        return values.withUnsafeBufferPointer { buffer in
+            Int(qtCanvas.pointee.removeItems(buffer.baseAddress, Int32(buffer.count)))
+        }
+    }
+    
+    /// Removes every item.
+    public func clear() {
+        qtCanvas.pointee.clearDisplayList()
+    }
+    
+    // MARK: - QtWidget Protocol Implementation
+    
+    public func show() {
+        qtCanvas.pointee.show()
+    }
+    
+    public func hide() {
+        qtCanvas.pointee.hide()
+    }
+    
+    public func setEnabled(_ enabled: Bool) {
+        qtCanvas.pointee.setEnabled(enabled)
+    }
+    
+    public var isVisible: Bool {
+        qtCanvas.pointee.isVisible()
+    }
+    
+    public func resize(width: Int, height: Int) {
+        qtCanvas.pointee.resize(Int32(width), Int32(height))
+    }
+    
+    public func move(x: Int, y: Int) {
+        qtCanvas.pointee.move(Int32(x), Int32(y))
+    }
+    
+    public func setGeometry(x: Int, y: Int, width: Int, height: Int) {
+        qtCanvas.pointee.setGeometry(Int32(x), Int32(y), Int32(width), Int32(height))
+    }
+    
+    public func setWindowTitle(_ title: String) {
+        qtCanvas.pointee.setWindowTitle(std.string(title))
+    }
+    
+    public var windowTitle: String {
+        String(qtCanvas.pointee.windowTitle())
+    }
+    
+    public func setObjectName(_ name: String) {
+        qtCanvas.pointee.setObjectName(std.string(name))
+    }
+    
+    public var objectName: String {
+        String(qtCanvas.pointee.objectName())
+    }
+    
+    public func setParent(_ parent: QtWidget?) {
+        if let parent = parent {
+            qtCanvas.pointee.setParent(parent.getBridgeWidget())
+        } else {
+            qtCanvas.pointee.setParent(nil)
+        }
+    }
+}
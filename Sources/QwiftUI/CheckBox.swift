@@ -6,7 +6,7 @@ import QtBridge
 
 /// A checkbox widget that can be checked, unchecked, or partially checked
 @MainActor
-public class CheckBox: QtWidget, QtTristateCheckable {
+public class CheckBox: SafeEventWidget, QtWidget, QtTristateCheckable {
     /// The underlying Qt checkbox stored as a pointer
     /// Marked as nonisolated(unsafe) since pointer operations are inherently unsafe
     nonisolated(unsafe) internal var qtCheckBox: UnsafeMutablePointer<SwiftQCheckBox>
@@ -52,6 +52,9 @@ public class CheckBox: QtWidget, QtTristateCheckable {
         } else {
             qtCheckBox.initialize(to: SwiftQCheckBox(std.string(text)))
         }
+        
+        // Call super.init() after all stored properties are initialized
+        super.init()
     }
     
     deinit {
@@ -65,10 +68,26 @@ public class CheckBox: QtWidget, QtTristateCheckable {
     // MARK: - Event Handling
     
     /// Sets a handler for state change events
-    /// - Parameter handler: Closure called when the checkbox state changes
-    public func onStateChanged(_ handler: @escaping (Int) -> Void) {
-        // TODO: Connect to QCheckBox stateChanged signal in QtBridge
-        // State: 0=unchecked, 1=partially, 2=checked
+    /// - Parameters:
+    ///   - delivery: How often the handler runs while the state keeps changing
+    ///   - handler: Closure called with the new state (0=unchecked, 1=partially, 2=checked)
+    @discardableResult
+    public func onStateChanged(
+        delivery: ChangeDelivery = .immediate,
+        _ handler: @escaping (Int) -> Void
+    ) -> Self {
+        // Create a heap-allocated event callback (automatically managed)
+        let callback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.StateChanged) { info in
+            if info.type == QtEventType.StateChanged {
+                handler(Int(info.intValue))
+            }
+        }
+        
+        // Pass the callback to C++
+        let parameters = delivery.bridgeParameters
+        qtCheckBox.pointee.setStateChangedHandler(callback.pointee, parameters.coalesceMs, parameters.debounce)
+        
+        return self
     }
     
     // MARK: - QtWidget Protocol Implementation
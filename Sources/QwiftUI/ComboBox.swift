@@ -4,6 +4,16 @@
 import Foundation
 import QtBridge
 
+/// How an editable combo box narrows its completion popup while the user types
+public enum ComboBoxFilterMode: Int32, Sendable {
+    /// Qt's default inline completion
+    case none = 0
+    /// Items starting with the typed text, case-insensitive, in sorted order
+    case prefix = 1
+    /// Items containing the typed text, case-insensitive, in list order
+    case substring = 2
+}
+
 /// A combo box widget for selecting from a dropdown list
 @MainActor
 public class ComboBox: SafeEventWidget, QtWidget, QtSelectable {
@@ -70,11 +80,51 @@ public class ComboBox: SafeEventWidget, QtWidget, QtSelectable {
     /// Creates a combo box with initial items
     public convenience init(items: [String], parent: (any QtWidget)? = nil) {
         self.init(parent: parent)
-        for item in items {
-            addItem(item)
+        setItems(items)
+    }
+    
+    /// Replace all items at once (a single model reset instead of one insertion per item)
+    public func setItems(_ items: [String]) {
+        withCStringArray(items) { pointers, count in
+            qtComboBox.pointee.setItems(pointers, count)
+        }
+    }
+    
+    /// Append several items at once
+    public func addItems(_ items: [String]) {
+        withCStringArray(items) { pointers, count in
+            qtComboBox.pointee.addItems(pointers, count)
         }
     }
     
+    /// Whether the user can type into the combo box
+    public var isEditable: Bool {
+        get { qtComboBox.pointee.isEditable() }
+        set { qtComboBox.pointee.setEditable(newValue) }
+    }
+    
+    /// How the completion popup is filtered while typing (editable combo boxes only)
+    public var filterMode: ComboBoxFilterMode {
+        get { ComboBoxFilterMode(rawValue: qtComboBox.pointee.getFilterMode()) ?? .none }
+        set { qtComboBox.pointee.setFilterMode(newValue.rawValue) }
+    }
+    
+    /// Maximum number of entries shown in the filtered completion popup
+    public func setMaxFilterResults(_ maxResults: Int) {
+        qtComboBox.pointee.setMaxFilterResults(Int32(maxResults))
+    }
+    
+    /// Indices of the items matching a query under the current filter mode
+    /// (prefix matching when filtering is off)
+    public func findItems(matching query: String, limit: Int = 100) -> [Int] {
+        guard limit > 0 else { return [] }
+        var rows = [Int32](repeating: 0, count: limit)
+        let found = rows.withUnsafeMutableBufferPointer { buffer in
+            qtComboBox.pointee.findItems(std.string(query), buffer.baseAddress, Int32(limit))
+        }
+        return rows.prefix(Int(found)).map { Int($0) }
+    }
+    
     /// Add an item to the list
     public func addItem(_ text: String) {
         qtComboBox.pointee.addItem(std.string(text))
@@ -240,4 +290,25 @@ public class ComboBox: SafeEventWidget, QtWidget, QtSelectable {
         
         return self
     }
-}
\ No newline at end of file
+}
+
+/// Calls body with NUL-terminated UTF-8 copies of strings, packed into a single buffer
+private func withCStringArray<R>(
+    _ strings: [String],
+    _ body: (UnsafePointer<UnsafePointer<CChar>?>?, Int32) -> R
+) -> R {
+    var storage: [CChar] = []
+    var offsets: [Int] = []
+    offsets.reserveCapacity(strings.count)
+    for string in strings {
+        offsets.append(storage.count)
+        storage.append(contentsOf: string.utf8CString)
+    }
+    return storage.withUnsafeBufferPointer { bytes in
+        let base = bytes.baseAddress
+        let pointers: [UnsafePointer<CChar>?] = offsets.map { offset in base.map { $0 + offset } }
+        return pointers.withUnsafeBufferPointer { buffer in
+            body(buffer.baseAddress, Int32(strings.count))
+        }
+    }
+}
@@ -18,11 +18,49 @@ import QtBridge
 /// container.addChild(label)
 /// container.setChildPosition(label, x: 10, y: 20)
 /// ```
+///
+/// Alternatively a container can hand layout to a native stack layout, which runs
+/// inside Qt's layout pass instead of positioning children one by one from Swift:
+///
+/// ```swift
+/// let column = Container()
+/// column.useStackLayout(.vertical, spacing: 8)
+/// column.addChild(header)
+/// column.addChild(body)
+/// column.setFlex(body, grow: 1)
+/// ```
 @MainActor
 public class Container: Widget {
+    /// Main axis of a stack layout
+    public enum StackAxis: Int32 {
+        case horizontal = 0
+        case vertical = 1
+    }
+    
+    /// Placement of children across the main axis of a stack layout
+    public enum StackAlignment: Int32 {
+        case start = 0
+        case center = 1
+        case end = 2
+        case stretch = 3
+    }
+    
+    /// Placement of children along the main axis when none of them grows
+    public enum StackJustification: Int32 {
+        case start = 0
+        case center = 1
+        case end = 2
+        case spaceBetween = 3
+    }
+    
     /// Storage for child widgets with their positions
     private var childWidgets: [any QtWidget] = []
     private var childPositions: [ObjectIdentifier: (x: Int, y: Int)] = [:]
+    /// Children placed by the last ``setChildren(keys:widgets:)`` call
+    private var keyedChildren: Set<ObjectIdentifier> = []
+    
+    /// Whether children are placed by a native stack layout instead of manual positions
+    public private(set) var usesStackLayout = false
     
     /// Creates a new container with an optional parent.
     ///
@@ -49,11 +87,95 @@ public class Container: Widget {
     ///
     /// - Parameter child: The widget to add as a child
     public func addChild(_ child: any QtWidget) {
-        child.setParent(self)
+        precondition(keyedChildren.isEmpty, "addChild cannot be mixed with setChildren(keys:widgets:)")
+        if usesStackLayout {
+            qtWidget.pointee.addStackChild(child.getBridgeWidget(), 0, 1)
+        } else {
+            child.setParent(self)
+        }
         childWidgets.append(child)
         child.show()
     }
     
+    /// Lays children out with a native stack layout.
+    ///
+    /// Frames are computed in C++ from the children's size hints and applied in
+    /// one batch whenever Qt invalidates the layout (resize, child added or removed,
+    /// a child's content changing its size hint). Existing children join the stack in
+    /// their current order; manual positions are ignored from now on.
+    ///
+    /// - Parameters:
+    ///   - axis: The direction children are stacked in
+    ///   - spacing: Gap between adjacent children
+    ///   - alignment: Placement across the main axis
+    ///   - justification: Placement along the main axis when no child grows
+    public func useStackLayout(
+        _ axis: StackAxis,
+        spacing: Int = 0,
+        alignment: StackAlignment = .stretch,
+        justification: StackJustification = .start
+    ) {
+        qtWidget.pointee.setStackLayout(axis.rawValue, Int32(spacing), alignment.rawValue, justification.rawValue)
+        guard !usesStackLayout, qtWidget.pointee.hasStackLayout() else { return }
+        usesStackLayout = true
+        childPositions.removeAll()
+        for child in childWidgets {
+            qtWidget.pointee.addStackChild(child.getBridgeWidget(), 0, 1)
+        }
+    }
+    
+    /// Sets the padding between the container edges and a stack layout's children.
+    public func setStackMargins(left: Int, top: Int, right: Int, bottom: Int) {
+        qtWidget.pointee.setStackMargins(Int32(left), Int32(top), Int32(right), Int32(bottom))
+    }
+    
+    /// Sets how a child of a stack layout shares free space.
+    ///
+    /// - Parameters:
+    ///   - child: A child of this container
+    ///   - grow: Share of surplus space along the main axis (0 keeps the size hint)
+    ///   - shrink: Share of a deficit, weighted by the child's size hint (0 never shrinks)
+    public func setFlex(_ child: any QtWidget, grow: Int = 0, shrink: Int = 1) {
+        qtWidget.pointee.setStackChildFlex(child.getBridgeWidget(), Int32(grow), Int32(shrink))
+    }
+    
+    /// Replaces the children with a keyed list, applying only the difference.
+    ///
+    /// Keys identify children across calls: a child whose key and widget match the
+    /// previous call is kept, children with vanished keys are removed, and new ones are
+    /// added. Of the kept children only those that moved relative to the others are
+    /// restacked, so changing one item of a long list costs a constant number of Qt
+    /// operations. The list order is the z-order, and the layout order when a stack
+    /// layout is used.
+    ///
+    /// A container is filled either with this method or with ``addChild(_:)``, not both;
+    /// mixing the two is a precondition failure.
+    ///
+    /// - Parameters:
+    ///   - keys: A stable, unique key per child
+    ///   - widgets: The children, in order; must have as many elements as `keys`
+    /// - Returns: The number of Qt operations performed
+    @discardableResult
+    public func setChildren(keys: [Int], widgets: [any QtWidget]) -> Int {
+        precondition(keys.count == widgets.count, "setChildren needs one key per widget")
+        precondition(childWidgets.allSatisfy { keyedChildren.contains(ObjectIdentifier($0)) },
+                     "setChildren(keys:widgets:) cannot be mixed with addChild")
+        let keep = Set(widgets.map { ObjectIdentifier($0) })
+        for child in childWidgets where !keep.contains(ObjectIdentifier(child)) {
+            childPositions.removeValue(forKey: ObjectIdentifier(child))
+        }
+        childWidgets = widgets
+        keyedChildren = keep
+        
+        let keyValues = keys.map { Int64($0) }
+        let bridges: [UnsafeMutablePointer<SwiftQWidget>?] = widgets.map { $0.getBridgeWidget() }
+        return keyValues.withUnsafeBufferPointer { keyBuffer in
+            bridges.withUnsafeBufferPointer { widgetBuffer in
+                Int(qtWidget.pointee.setChildren(keyBuffer.baseAddress, widgetBuffer.baseAddress, Int32(keys.count)))
+            }
+        }
+    }
+    
     /// Removes a child widget from the container.
     ///
     /// - Parameter child: The widget to remove
@@ -61,10 +183,23 @@ public class Container: Widget {
         if let index = childWidgets.firstIndex(where: { ObjectIdentifier($0) == ObjectIdentifier(child) }) {
             childWidgets.remove(at: index)
             childPositions.removeValue(forKey: ObjectIdentifier(child))
+            keyedChildren.remove(ObjectIdentifier(child))
             child.setParent(nil)
         }
     }
     
+    /// Removes a child widget and deletes its Qt widget.
+    ///
+    /// Unlike ``removeChild(_:)``, which only forgets the child, this hides the Qt widget,
+    /// detaches it and deletes it on the next event loop pass, so its memory is returned
+    /// even while Swift still holds the child.
+    ///
+    /// - Parameter child: The widget to delete
+    public func deleteChild(_ child: any QtWidget) {
+        removeChild(child)
+        child.getBridgeWidget().pointee.deleteWidgetLater()
+    }
+    
     /// Removes all children from the container.
     public func removeAllChildren() {
         for child in childWidgets {
@@ -72,6 +207,7 @@ public class Container: Widget {
         }
         childWidgets.removeAll()
         childPositions.removeAll()
+        keyedChildren.removeAll()
     }
     
     /// Sets the position of a child widget.
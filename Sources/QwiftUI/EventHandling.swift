@@ -14,6 +14,9 @@ public final class CallbackManager: Sendable {
     /// Storage for active callbacks indexed by object pointer
     nonisolated(unsafe) private let callbacks = NSMutableDictionary()
     
+    /// Storage for event callbacks indexed by object pointer, then by event type
+    nonisolated(unsafe) private let eventCallbacks = NSMutableDictionary()
+    
     /// Storage for allocated callback pointers indexed by object pointer
     nonisolated(unsafe) private let allocatedPointers = NSMutableDictionary()
     
@@ -30,6 +33,20 @@ public final class CallbackManager: Sendable {
         callbacks[pointer] = callback
     }
     
+    /// Store a callback for one event type of an object.
+    ///
+    /// Unlike `store(_:for:)`, several handlers can coexist on the same object
+    /// as long as they are registered for different event types.
+    public nonisolated func store<T>(_ callback: T, for object: AnyObject, eventType: QtEventType) {
+        let pointer = Unmanaged.passUnretained(object).toOpaque()
+        lock.lock()
+        defer { lock.unlock() }
+        if eventCallbacks[pointer] == nil {
+            eventCallbacks[pointer] = NSMutableDictionary()
+        }
+        (eventCallbacks[pointer] as? NSMutableDictionary)?[NSNumber(value: eventType.rawValue)] = callback
+    }
+    
     /// Store an allocated pointer for automatic cleanup
     public nonisolated func storeAllocatedPointer(_ ptr: UnsafeMutableRawPointer, for object: AnyObject) {
         let objPointer = Unmanaged.passUnretained(object).toOpaque()
@@ -49,6 +66,14 @@ public final class CallbackManager: Sendable {
         return callbacks[pointer] as? T
     }
     
+    /// Retrieve a callback registered for one event type of an object
+    public nonisolated func retrieve<T>(_ type: T.Type, for object: AnyObject, eventType: QtEventType) -> T? {
+        let pointer = Unmanaged.passUnretained(object).toOpaque()
+        lock.lock()
+        defer { lock.unlock() }
+        return (eventCallbacks[pointer] as? NSDictionary)?[NSNumber(value: eventType.rawValue)] as? T
+    }
+    
     /// Remove callbacks and deallocate pointers for an object
     public nonisolated func remove(for object: AnyObject) {
         let pointer = Unmanaged.passUnretained(object).toOpaque()
@@ -56,6 +81,7 @@ public final class CallbackManager: Sendable {
         defer { lock.unlock() }
         
         callbacks.removeObject(forKey: pointer)
+        eventCallbacks.removeObject(forKey: pointer)
         
         // Deallocate any stored pointers
         if let pointers = allocatedPointers[pointer] as? NSMutableArray {
@@ -69,6 +95,52 @@ public final class CallbackManager: Sendable {
     }
 }
 
+/// Optional timing of the Swift handlers called from C++.
+///
+/// While any observer is registered, every handler invoked through ``CallbackHelper`` is
+/// timed and each observer receives its duration in milliseconds. Durations are inclusive,
+/// so a handler that triggers another callback synchronously also counts the inner one.
+/// Performance tests add observers, possibly several nested ones; otherwise the cost is
+/// one check per callback.
+public enum CallbackTiming {
+    /// Identifies an observer for ``removeObserver(_:)``
+    public struct Token: Hashable, Sendable {
+        fileprivate let id: Int
+    }
+    
+    nonisolated(unsafe) private static var observers: [(token: Token, observe: (Double) -> Void)] = []
+    nonisolated(unsafe) private static var nextID = 0
+    
+    /// Adds a closure that receives callback durations until it is removed
+    @discardableResult
+    public nonisolated static func addObserver(_ observer: @escaping (Double) -> Void) -> Token {
+        nextID += 1
+        let token = Token(id: nextID)
+        observers.append((token, observer))
+        return token
+    }
+    
+    /// Removes the observer added with `token`; the others keep receiving durations
+    public nonisolated static func removeObserver(_ token: Token) {
+        observers.removeAll { $0.token == token }
+    }
+    
+    @inline(__always)
+    internal nonisolated static func measure(_ body: () -> Void) {
+        guard !observers.isEmpty else {
+            body()
+            return
+        }
+        let start = DispatchTime.now().uptimeNanoseconds
+        body()
+        let duration = Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000
+        // Observers added or removed by the handler take effect from the next callback
+        for (_, observe) in observers {
+            observe(duration)
+        }
+    }
+}
+
 /// Helper to create heap-allocated callbacks
 public struct CallbackHelper {
     /// Create a heap-allocated SwiftCallback
@@ -85,7 +157,7 @@ public struct CallbackHelper {
             
             // Retrieve the stored handler
             if let storedHandler = CallbackManager.shared.retrieve((() -> Void).self, for: object) {
-                storedHandler()
+                CallbackTiming.measure { storedHandler() }
             }
         }
         
@@ -112,7 +184,7 @@ public struct CallbackHelper {
             
             // Retrieve the stored handler
             if let storedHandler = CallbackManager.shared.retrieve(((Int) -> Void).self, for: object) {
-                storedHandler(Int(value))
+                CallbackTiming.measure { storedHandler(Int(value)) }
             }
         }
         
@@ -141,7 +213,7 @@ public struct CallbackHelper {
             
             // Retrieve the stored handler
             if let storedHandler = CallbackManager.shared.retrieve(((String) -> Void).self, for: object) {
-                storedHandler(text)
+                CallbackTiming.measure { storedHandler(text) }
             }
         }
         
@@ -155,8 +227,15 @@ public struct CallbackHelper {
     }
     
     /// Create a heap-allocated SwiftEventCallback
+    ///
+    /// - Parameters:
+    ///   - context: The object owning the callback
+    ///   - eventType: When given, the handler is stored per event type so it does not
+    ///     replace handlers registered on the same object for other event types
+    ///   - handler: The closure to invoke
     public static func createEventCallback(
         context: AnyObject,
+        eventType: QtEventType? = nil,
         handler: @escaping (QtEventInfo) -> Void
     ) -> UnsafeMutablePointer<SwiftEventCallback> {
         let callback = UnsafeMutablePointer<SwiftEventCallback>.allocate(capacity: 1)
@@ -168,14 +247,19 @@ public struct CallbackHelper {
             let object = Unmanaged<AnyObject>.fromOpaque(contextPtr).takeUnretainedValue()
             let info = infoPtr.pointee
             
-            // Retrieve the stored handler
-            if let storedHandler = CallbackManager.shared.retrieve(((QtEventInfo) -> Void).self, for: object) {
-                storedHandler(info)
+            // Retrieve the stored handler, preferring one registered for this event type
+            if let storedHandler = CallbackManager.shared.retrieve(((QtEventInfo) -> Void).self, for: object, eventType: info.type)
+                ?? CallbackManager.shared.retrieve(((QtEventInfo) -> Void).self, for: object) {
+                CallbackTiming.measure { storedHandler(info) }
             }
         }
         
         // Store the handler to keep it alive
-        CallbackManager.shared.store(handler, for: context)
+        if let eventType = eventType {
+            CallbackManager.shared.store(handler, for: context, eventType: eventType)
+        } else {
+            CallbackManager.shared.store(handler, for: context)
+        }
         
         // Automatically store the allocated pointer for cleanup
         CallbackManager.shared.storeAllocatedPointer(UnsafeMutableRawPointer(callback), for: context)
@@ -189,6 +273,91 @@ public struct CallbackHelper {
     }
 }
 
+/// Controls how often a change handler is called while the value keeps changing
+public enum ChangeDelivery: Sendable {
+    /// Deliver every change as it happens
+    case immediate
+    /// Deliver at most once per window, with the latest value
+    case throttle(milliseconds: Int)
+    /// Deliver once the value has stopped changing for the window
+    case debounce(milliseconds: Int)
+    
+    /// The window and debounce flag expected by the C++ bridge
+    internal var bridgeParameters: (coalesceMs: Int32, debounce: Bool) {
+        switch self {
+        case .immediate:
+            return (0, false)
+        case .throttle(let milliseconds):
+            return (Int32(milliseconds), false)
+        case .debounce(let milliseconds):
+            return (Int32(milliseconds), true)
+        }
+    }
+}
+
+/// Controls how often resize handlers run while a widget is being resized
+public enum ResizeDelivery: Sendable {
+    /// Run the handler for every resize event, synchronously
+    case immediate
+    /// Run the handler at most once per display frame, with the latest size
+    case perFrame
+    /// Run the handler at most once per interval while resizing continues, then once
+    /// more with the final size when resizing pauses
+    case live(intervalMilliseconds: Int)
+    
+    /// The mode and interval expected by the C++ bridge
+    internal var bridgeParameters: (mode: Int32, intervalMs: Int32) {
+        switch self {
+        case .immediate:
+            return (0, 0)
+        case .perFrame:
+            return (1, 0)
+        case .live(let milliseconds):
+            return (2, Int32(milliseconds))
+        }
+    }
+}
+
+/// A mouse position reported by ``Widget/onMouseMoves(tracking:_:)``
+public struct MouseSample: Sendable, Equatable {
+    /// Position in widget coordinates
+    public var x: Int
+    public var y: Int
+    /// Qt::MouseButtons held during the move
+    public var buttons: Int
+    /// Qt::KeyboardModifiers active during the move
+    public var modifiers: Int
+    /// Event time in milliseconds
+    public var timestamp: Int
+}
+
+/// The mouse moves of one batch, oldest first
+///
+/// The samples are read from a buffer owned by the bridge, which is reused for the
+/// next batch, so the collection must not be kept beyond the handler call. Copy the
+/// samples you need (e.g. `Array(samples)`) instead.
+public struct MouseSamples: RandomAccessCollection {
+    private let buffer: UnsafeBufferPointer<QtMouseSample>
+    
+    internal init(buffer: UnsafeBufferPointer<QtMouseSample>) {
+        self.buffer = buffer
+    }
+    
+    public var startIndex: Int { 0 }
+    public var endIndex: Int { buffer.count }
+    
+    public subscript(position: Int) -> MouseSample {
+        let sample = buffer[position]
+        return MouseSample(
+            x: Int(sample.x),
+            y: Int(sample.y),
+            buttons: Int(sample.buttons),
+            modifiers: Int(sample.modifiers),
+            timestamp: Int(sample.timestamp)
+        )
+    }
+}
+
 /// Base class for widgets with safe event handling
 @MainActor
 open class SafeEventWidget {
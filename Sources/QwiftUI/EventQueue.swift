@@ -0,0 +1,164 @@
+// ABOUTME: EventQueue delivers widget events in bulk from a ring buffer filled by the C++ event filters
+// ABOUTME: One drain per event loop iteration replaces one Swift callback per event for input-heavy widgets
+
+import Foundation
+import QtBridge
+
+/// An event read from the ``EventQueue``
+public struct QueuedEvent {
+    /// The tag the widget was routed with
+    public var tag: Int
+    /// The event type
+    public var type: QtEventType
+    /// Same meaning as `QtEventInfo.intValue` (e.g. x for mouse moves, the key for key presses)
+    public var intValue: Int
+    /// Same meaning as `QtEventInfo.intValue2` (e.g. y for mouse moves, modifiers for key presses)
+    public var intValue2: Int
+    /// Same meaning as `QtEventInfo.boolValue`
+    public var boolValue: Bool
+    /// Event time in milliseconds for input events, otherwise 0
+    public var timestamp: Int
+}
+
+/// The events of one drain, oldest first
+///
+/// The events are read from a buffer owned by the queue and reused by the next drain,
+/// so the collection must not be kept beyond the handler call.
+public struct QueuedEvents: RandomAccessCollection {
+    private let buffer: UnsafeBufferPointer<QtEventRecord>
+    
+    internal init(buffer: UnsafeBufferPointer<QtEventRecord>) {
+        self.buffer = buffer
+    }
+    
+    public var startIndex: Int { 0 }
+    public var endIndex: Int { buffer.count }
+    
+    public subscript(position: Int) -> QueuedEvent {
+        let record = buffer[position]
+        return QueuedEvent(
+            tag: Int(record.widgetTag),
+            type: QtEventType(rawValue: record.type) ?? .Custom,
+            intValue: Int(record.intValue),
+            intValue2: Int(record.intValue2),
+            boolValue: record.boolValue != 0,
+            timestamp: Int(record.timestamp)
+        )
+    }
+}
+
+/// Bulk delivery of widget events through a shared ring buffer.
+///
+/// Event types routed with ``route(_:of:tag:)`` no longer call their widget handlers.
+/// The widget's event filter instead appends a fixed-size record to a process-wide
+/// ring, and the ``onDrain(_:)`` handler receives everything accumulated once per event
+/// loop iteration. Thousands of mouse moves or key presses then cost one call into
+/// Swift instead of one each. If the ring fills up before it is drained, further
+/// events are dropped and counted in ``droppedCount``.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// EventQueue.shared.route([.MouseMove, .MousePress, .MouseRelease], of: canvas, tag: 1)
+/// EventQueue.shared.onDrain { events in
+///     for event in events where event.type == .MouseMove {
+///         stroke.append((event.intValue, event.intValue2))
+///     }
+/// }
+/// ```
+@MainActor
+public final class EventQueue {
+    /// The queue shared by all widgets
+    public static let shared = EventQueue()
+    
+    private var records: [QtEventRecord] = []
+    private var drainHandler: ((QueuedEvents) -> Void)?
+    private var isDraining = false
+    
+    private init() {}
+    
+    /// The number of records the ring holds before events are dropped. Setting it
+    /// rounds up to a power of two and discards events not yet drained.
+    public var capacity: Int {
+        get { Int(SwiftEventRing.capacity()) }
+        set { SwiftEventRing.setCapacity(Int32(clamping: newValue)) }
+    }
+    
+    /// The number of events waiting to be drained
+    public var pendingCount: Int {
+        Int(SwiftEventRing.pendingCount())
+    }
+    
+    /// The number of events written to the ring since the last ``resetCounters()``
+    public var writtenCount: Int {
+        Int(SwiftEventRing.writtenCount())
+    }
+    
+    /// The number of events dropped because the ring was full since the last ``resetCounters()``
+    public var droppedCount: Int {
+        Int(SwiftEventRing.droppedCount())
+    }
+    
+    /// Zeroes ``writtenCount`` and ``droppedCount``
+    public func resetCounters() {
+        SwiftEventRing.resetCounters()
+    }
+    
+    /// Routes events of the given types from `widget` into the queue.
+    ///
+    /// - Parameters:
+    ///   - types: The event types to queue instead of calling the widget's handlers
+    ///   - widget: The widget whose events are queued
+    ///   - tag: Identifies the widget in ``QueuedEvent/tag``
+    public func route(_ types: [QtEventType], of widget: any QtWidget, tag: Int) {
+        for type in types {
+            widget.getBridgeWidget().pointee.queueEvents(type, Int64(tag))
+        }
+    }
+    
+    /// Returns events of the given types from `widget` to its handlers.
+    public func unroute(_ types: [QtEventType], of widget: any QtWidget) {
+        for type in types {
+            widget.getBridgeWidget().pointee.unqueueEvents(type)
+        }
+    }
+    
+    /// Sets the handler that receives queued events once per event loop iteration.
+    public func onDrain(_ handler: @escaping (QueuedEvents) -> Void) {
+        drainHandler = handler
+        let callback = CallbackHelper.createCallback(context: self) { [unowned self] in
+            self.drain()
+        }
+        SwiftEventRing.setDrainHandler(callback.pointee)
+    }
+    
+    /// Stops automatic draining. Events keep queueing until ``drain()`` is called.
+    public func removeDrainHandler() {
+        SwiftEventRing.clearDrainHandler()
+        drainHandler = nil
+    }
+    
+    /// Passes every pending event to the drain handler right away.
+    ///
+    /// - Returns: The number of events drained
+    @discardableResult
+    public func drain() -> Int {
+        guard !isDraining else { return 0 }
+        isDraining = true
+        defer { isDraining = false }
+        
+        // The buffer matches the ring, so one read takes everything pending
+        if records.count < capacity {
+            records = Array(repeating: QtEventRecord(), count: capacity)
+        }
+        let count = records.withUnsafeMutableBufferPointer { buffer in
+            Int(SwiftEventRing.read(buffer.baseAddress, Int32(buffer.count)))
+        }
+        if count > 0, let handler = drainHandler {
+            records.withUnsafeBufferPointer { buffer in
+                handler(QueuedEvents(buffer: UnsafeBufferPointer(rebasing: buffer[0..<count])))
+            }
+        }
+        return count
+    }
+}
@@ -146,6 +146,21 @@ public class LCDNumber: SafeEventWidget, QtWidget {
         qtLCDNumber.pointee.display(std.string(text))
     }
     
+    /// Displays the value of a channel that worker threads advance, such as a
+    /// high-rate event counter.
+    ///
+    /// - Parameters:
+    ///   - channel: The channel to display
+    ///   - interval: Sampling interval in milliseconds, 0 for the display refresh rate
+    public func attach(_ channel: ProgressChannel, interval: Int = 0) {
+        qtLCDNumber.pointee.attachProgressChannel(channel.channel, Int32(interval))
+    }
+    
+    /// Stops sampling the attached channel.
+    public func detachChannel() {
+        qtLCDNumber.pointee.detachProgressChannel()
+    }
+    
     // MARK: - QtWidget Protocol Implementation
     
     public func show() {
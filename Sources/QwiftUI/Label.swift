@@ -43,10 +43,10 @@ public class Label: QtWidget {
     /// The text displayed by the label
     public var text: String {
         get {
-            return String(qtLabel.pointee.text())
+            return stringFromUTF8Export { qtLabel.pointee.textUtf8($0) }
         }
         set {
-            qtLabel.pointee.setText(std.string(newValue))
+            withUTF8Argument(newValue) { qtLabel.pointee.setText($0, $1) }
         }
     }
     
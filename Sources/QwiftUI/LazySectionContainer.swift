@@ -0,0 +1,191 @@
+// ABOUTME: LazySectionContainer builds scroll view content sections only while they are near the viewport
+// ABOUTME: Sections far from the viewport are released, keeping memory bounded for long or endless lists
+
+import Foundation
+import QtBridge
+
+/// Vertical scroll content whose sections are built on demand.
+///
+/// Each section declares its height up front and supplies a closure that builds its
+/// widget. The container installs itself as the content of a ``ScrollView`` and, from
+/// the scroll view's viewport notifications, builds the sections that intersect the
+/// visible rect plus the overscan margin and releases those further away than the
+/// release distance. Only a screenful or so of widgets exists at any time, however
+/// many sections there are.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let scrollView = ScrollView()
+/// let feed = LazySectionContainer(in: scrollView, overscan: 400)
+/// feed.onReachEnd {
+///     for post in loadMorePosts() {
+///         feed.appendSection(height: 120) { PostView(post) }
+///     }
+/// }
+/// ```
+@MainActor
+public final class LazySectionContainer: Container {
+    private struct Section {
+        var height: Int
+        let build: () -> any QtWidget
+        var widget: (any QtWidget)?
+    }
+    
+    private var sections: [Section] = []
+    /// Top of each section; the last element is the total height
+    private var offsets: [Int] = [0]
+    /// Span of indices that may have built widgets; every section outside it has none, so
+    /// viewport changes only visit this span instead of every section
+    private var materializedRange = 0..<0
+    private var lastViewport: ScrollViewport?
+    private var reachEndHandler: (() -> Void)?
+    private var reportedEndAt: Int?
+    private var isReportingEnd = false
+    
+    /// Sections further than this from the visible rect are released
+    /// (default: twice the overscan margin)
+    public var releaseDistance: Int
+    
+    /// The number of sections whose widgets currently exist
+    public private(set) var materializedCount = 0
+    
+    /// The number of sections
+    public var sectionCount: Int {
+        sections.count
+    }
+    
+    /// Creates the container and makes it the content of `scrollView`.
+    ///
+    /// - Parameters:
+    ///   - scrollView: The scroll view to fill
+    ///   - overscan: Margin above and below the visible rect that is built ahead of scrolling
+    public init(in scrollView: ScrollView, overscan: Int = 400) {
+        releaseDistance = overscan * 2
+        super.init(parent: nil)
+        scrollView.widgetResizable = false
+        scrollView.setContent(self)
+        scrollView.onViewportChanged(overscan: overscan) { [weak self] viewport in
+            self?.viewportChanged(viewport)
+        }
+    }
+    
+    /// Adds a section at the end.
+    ///
+    /// - Parameters:
+    ///   - height: The section's height; the widget is given this height when built
+    ///   - build: Creates the section's widget when it comes near the viewport
+    public func appendSection(height: Int, build: @escaping () -> any QtWidget) {
+        sections.append(Section(height: height, build: build, widget: nil))
+        offsets.append(offsets[offsets.count - 1] + height)
+        contentSizeChanged()
+    }
+    
+    /// Removes every section, releasing built widgets.
+    public func removeAllSections() {
+        for index in materializedRange {
+            release(index)
+        }
+        materializedRange = 0..<0
+        sections.removeAll()
+        offsets = [0]
+        reportedEndAt = nil
+        contentSizeChanged()
+    }
+    
+    /// Whether the section's widget currently exists
+    public func isMaterialized(_ index: Int) -> Bool {
+        sections.indices.contains(index) && sections[index].widget != nil
+    }
+    
+    /// The section's widget if it currently exists
+    public func section(at index: Int) -> (any QtWidget)? {
+        sections.indices.contains(index) ? sections[index].widget : nil
+    }
+    
+    /// Sets a handler called when the overscanned viewport reaches the last section,
+    /// which can append more sections for endless scrolling. It is called once per
+    /// content length, so appending re-arms it.
+    public func onReachEnd(_ handler: @escaping () -> Void) {
+        reachEndHandler = handler
+    }
+    
+    private func viewportChanged(_ viewport: ScrollViewport) {
+        lastViewport = viewport
+        if viewport.width > 0 && viewport.width != width {
+            resize(width: viewport.width, height: max(offsets[offsets.count - 1], 1))
+            for index in materializedRange {
+                sections[index].widget?.setGeometry(x: 0, y: offsets[index], width: viewport.width, height: sections[index].height)
+            }
+        }
+        
+        // Build what the overscanned rect touches
+        let wanted = sectionRange(from: viewport.expandedMinY, to: viewport.expandedMaxY)
+        for index in wanted where sections[index].widget == nil {
+            let widget = sections[index].build()
+            addChild(widget)
+            widget.setGeometry(x: 0, y: offsets[index], width: viewport.width, height: sections[index].height)
+            sections[index].widget = widget
+            materializedCount += 1
+        }
+        
+        // Release what drifted beyond the release distance
+        let kept = sectionRange(from: viewport.y - releaseDistance, to: viewport.y + viewport.height + releaseDistance)
+        for index in materializedRange where !kept.contains(index) && !wanted.contains(index) {
+            release(index)
+        }
+        materializedRange = span(wanted, materializedRange.clamped(to: kept))
+        
+        let total = offsets[offsets.count - 1]
+        if viewport.expandedMaxY >= total && reportedEndAt != total && !isReportingEnd, let handler = reachEndHandler {
+            // Sections appended by the handler are picked up by the next viewport notification
+            reportedEndAt = total
+            isReportingEnd = true
+            handler()
+            isReportingEnd = false
+        }
+    }
+    
+    /// Indices of the sections overlapping [top, bottom)
+    private func sectionRange(from top: Int, to bottom: Int) -> Range<Int> {
+        guard !sections.isEmpty, bottom > top else { return 0..<0 }
+        return sectionIndex(at: top)..<min(sections.count, sectionIndex(at: bottom - 1) + 1)
+    }
+    
+    /// The smallest range containing both ranges
+    private func span(_ first: Range<Int>, _ second: Range<Int>) -> Range<Int> {
+        if first.isEmpty { return second }
+        if second.isEmpty { return first }
+        return min(first.lowerBound, second.lowerBound)..<max(first.upperBound, second.upperBound)
+    }
+    
+    /// Index of the section containing y, clamped to the valid range
+    private func sectionIndex(at y: Int) -> Int {
+        // Binary search for the last offset <= y
+        var low = 0
+        var high = sections.count - 1
+        while low < high {
+            let middle = (low + high + 1) / 2
+            if offsets[middle] <= y {
+                low = middle
+            } else {
+                high = middle - 1
+            }
+        }
+        return low
+    }
+    
+    private func release(_ index: Int) {
+        guard let widget = sections[index].widget else { return }
+        deleteChild(widget)
+        sections[index].widget = nil
+        materializedCount -= 1
+    }
+    
+    private func contentSizeChanged() {
+        resize(width: max(width, lastViewport?.width ?? 1), height: max(offsets[offsets.count - 1], 1))
+        if let viewport = lastViewport {
+            viewportChanged(viewport)
+        }
+    }
+}
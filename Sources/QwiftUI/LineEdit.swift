@@ -6,7 +6,7 @@ import QtBridge
 
 /// A single-line text input widget
 @MainActor
-public class LineEdit: QtWidget, QtTextInput {
+public class LineEdit: SafeEventWidget, QtWidget, QtTextInput {
     /// The underlying Qt line edit stored as a pointer
     /// Marked as nonisolated(unsafe) since pointer operations are inherently unsafe
     nonisolated(unsafe) internal var qtLineEdit: UnsafeMutablePointer<SwiftQLineEdit>
@@ -19,8 +19,8 @@ public class LineEdit: QtWidget, QtTextInput {
     
     /// The text content
     public var text: String {
-        get { String(qtLineEdit.pointee.text()) }
-        set { qtLineEdit.pointee.setText(std.string(newValue)) }
+        get { stringFromUTF8Export { qtLineEdit.pointee.textUtf8($0) } }
+        set { withUTF8Argument(newValue) { qtLineEdit.pointee.setText($0, $1) } }
     }
     
     /// Placeholder text shown when empty
@@ -52,6 +52,9 @@ public class LineEdit: QtWidget, QtTextInput {
         } else {
             qtLineEdit.initialize(to: SwiftQLineEdit(std.string(text)))
         }
+        
+        // Call super.init() after all stored properties are initialized
+        super.init()
     }
     
     deinit {
@@ -75,22 +78,57 @@ public class LineEdit: QtWidget, QtTextInput {
     // MARK: - Event Handling
     
     /// Sets a handler for text change events
-    /// - Parameter handler: Closure called when the text changes
-    public func onTextChanged(_ handler: @escaping (String) -> Void) {
-        // TODO: Connect to QLineEdit textChanged signal in QtBridge
-        // For now, this is a placeholder
+    /// - Parameters:
+    ///   - delivery: How often the handler runs while the user is typing. Use
+    ///     `.debounce` for search fields backed by expensive queries.
+    ///   - handler: Closure called with the latest text
+    @discardableResult
+    public func onTextChanged(
+        delivery: ChangeDelivery = .immediate,
+        _ handler: @escaping (String) -> Void
+    ) -> Self {
+        // Create a heap-allocated event callback (automatically managed)
+        let callback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.TextChanged) { info in
+            if info.type == QtEventType.TextChanged, let text = info.stringValue {
+                handler(String(cString: text))
+            }
+        }
+        
+        // Pass the callback to C++
+        let parameters = delivery.bridgeParameters
+        qtLineEdit.pointee.setTextChangedHandler(callback.pointee, parameters.coalesceMs, parameters.debounce)
+        
+        return self
     }
     
     /// Sets a handler for when return/enter is pressed
     /// - Parameter handler: Closure called when return is pressed
-    public func onReturnPressed(_ handler: @escaping () -> Void) {
-        // TODO: Connect to QLineEdit returnPressed signal in QtBridge
+    @discardableResult
+    public func onReturnPressed(_ handler: @escaping () -> Void) -> Self {
+        let callback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.ReturnPressed) { info in
+            if info.type == QtEventType.ReturnPressed {
+                handler()
+            }
+        }
+        
+        qtLineEdit.pointee.setReturnPressedHandler(callback.pointee)
+        
+        return self
     }
     
     /// Sets a handler for when editing is finished (focus lost or return pressed)
     /// - Parameter handler: Closure called when editing is finished
-    public func onEditingFinished(_ handler: @escaping () -> Void) {
-        // TODO: Connect to QLineEdit editingFinished signal in QtBridge
+    @discardableResult
+    public func onEditingFinished(_ handler: @escaping () -> Void) -> Self {
+        let callback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.EditingFinished) { info in
+            if info.type == QtEventType.EditingFinished {
+                handler()
+            }
+        }
+        
+        qtLineEdit.pointee.setEditingFinishedHandler(callback.pointee)
+        
+        return self
     }
     
     // MARK: - QtWidget Protocol Implementation
@@ -92,4 +92,95 @@ public struct MessageBox {
             std.string(text)
         )
     }
-}
\ No newline at end of file
+    
+    // MARK: - Non-blocking message boxes
+    
+    /// Icon displayed by ``open(title:text:icon:buttons:parent:completion:)``
+    public enum Icon: Int32 {
+        case none = 0
+        case information = 1
+        case warning = 2
+        case critical = 3
+        case question = 4
+    }
+    
+    /// Standard buttons; raw values match `QMessageBox::StandardButton`
+    public struct Buttons: OptionSet, Sendable {
+        public let rawValue: Int32
+        
+        public init(rawValue: Int32) {
+            self.rawValue = rawValue
+        }
+        
+        public static let ok = Buttons(rawValue: 0x0000_0400)
+        public static let cancel = Buttons(rawValue: 0x0040_0000)
+        public static let yes = Buttons(rawValue: 0x0000_4000)
+        public static let no = Buttons(rawValue: 0x0001_0000)
+        public static let close = Buttons(rawValue: 0x0020_0000)
+    }
+    
+    /// Completions waiting for their box to close
+    private static var pendingCompletions: [ObjectIdentifier: AlertCompletion] = [:]
+    
+    /// Shows a message box without blocking and returns immediately
+    ///
+    /// Unlike the `show*` functions this does not run a nested event loop. If a box with
+    /// the same parent, icon, title and text is already open, the alert is folded into it:
+    /// the box shows how often the message was reported and every caller's completion runs
+    /// when it closes.
+    ///
+    /// - Parameters:
+    ///   - title: The title of the message box
+    ///   - text: The text content to display
+    ///   - icon: The icon to display
+    ///   - buttons: The buttons to offer
+    ///   - parent: Optional parent widget; the box is window-modal to it
+    ///   - completion: Called with the button chosen and the number of alerts folded into the box;
+    ///     the button is `.cancel` if the box is destroyed with its parent before an answer
+    /// - Returns: The number of alerts the open box now represents
+    @discardableResult
+    public static func open(
+        title: String,
+        text: String,
+        icon: Icon = .information,
+        buttons: Buttons = .ok,
+        parent: (any QtWidget)? = nil,
+        completion: ((Buttons, Int) -> Void)? = nil
+    ) -> Int {
+        var callback = SwiftEventCallback(context: nil, handler: nil)
+        if let completion = completion {
+            let context = AlertCompletion()
+            let key = ObjectIdentifier(context)
+            pendingCompletions[key] = context
+            callback = CallbackHelper.createEventCallback(context: context) { info in
+                pendingCompletions.removeValue(forKey: key)
+                completion(Buttons(rawValue: info.intValue), Int(info.intValue2))
+            }.pointee
+        }
+        return Int(SwiftQMessageBox.openAsync(
+            parent?.getBridgeWidget(),
+            icon.rawValue,
+            std.string(title),
+            std.string(text),
+            buttons.rawValue,
+            callback
+        ))
+    }
+    
+    /// Number of non-blocking message boxes currently open
+    public static var openCount: Int {
+        Int(SwiftQMessageBox.openAsyncCount())
+    }
+    
+    /// Closes every non-blocking message box as if `button` had been clicked
+    public static func finishAll(with button: Buttons) {
+        SwiftQMessageBox.finishAllAsync(button.rawValue)
+    }
+}
+
+/// Owner of the callback storage for one pending non-blocking message box
+private final class AlertCompletion {
+    deinit {
+        CallbackManager.shared.remove(for: self)
+    }
+}
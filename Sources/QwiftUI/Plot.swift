@@ -0,0 +1,197 @@
+// ABOUTME: Plot provides a line chart for very large time series
+// ABOUTME: This wraps SwiftQPlot, which decimates samples to one min/max pair per pixel column
+
+import Foundation
+import QtBridge
+
+/// A line chart for time series with millions of samples.
+///
+/// Samples are stored per series in columnar form together with a min/max pyramid,
+/// so a repaint draws about two points per pixel column no matter how many samples
+/// are visible. Appending samples extends the pyramid incrementally, which keeps a
+/// live feed cheap to display.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let plot = Plot()
+/// let load = plot.addSeries(color: Qt.Color(argb: 0xFF2080E0))
+/// plot.setData(series: load, y: history)
+/// plot.followWindow = 10_000          // Show the last 10k samples
+/// plot.append(series: load, y: [nextSample])
+/// ```
+@MainActor
+public class Plot: SafeEventWidget, QtWidget {
+    /// The underlying Qt plot stored as a pointer
+    nonisolated(unsafe) internal var qtPlot: UnsafeMutablePointer<SwiftQPlot>
+    
+    /// Protocol conformance - provide mutable pointer
+    public func getBridgeWidget() -> UnsafeMutablePointer<SwiftQWidget> {
+        // Cast from SwiftQPlot* to SwiftQWidget* (base class pointer)
+        return UnsafeMutableRawPointer(qtPlot).assumingMemoryBound(to: SwiftQWidget.self)
+    }
+    
+    /// When positive, the plot shows the last `followWindow` x units and scrolls with
+    /// appended samples. Zero shows the range set with ``setXRange(_:)``.
+    public var followWindow: Double = 0 {
+        didSet {
+            qtPlot.pointee.setFollowWindow(followWindow)
+        }
+    }
+    
+    /// The number of points drawn by the most recent paint, over all series
+    public var lastPointCount: Int {
+        Int(qtPlot.pointee.lastPointCount())
+    }
+    
+    /// Creates a new plot
+    ///
+    /// - Parameter parent: The parent widget. If nil, creates a top-level plot.
+    public init(parent: (any QtWidget)? = nil) {
+        qtPlot = UnsafeMutablePointer<SwiftQPlot>.allocate(capacity: 1)
+        
+        if let parent = parent {
+            qtPlot.initialize(to: SwiftQPlot(parent.getBridgeWidget()))
+        } else {
+            qtPlot.initialize(to: SwiftQPlot())
+        }
+        
+        super.init()
+    }
+    
+    deinit {
+        let ptr = qtPlot
+        ptr.deinitialize(count: 1)
+        ptr.deallocate()
+    }
+    
+    /// Adds a series and returns its id.
+    public func addSeries(color: Qt.Color, lineWidth: Double = 1) -> Int {
+        Int(qtPlot.pointee.addSeries(color.argb, lineWidth))
+    }
+    
+    /// Replaces the samples of a series.
+    ///
+    /// - Parameters:
+    ///   - series: A series id from ``addSeries(color:lineWidth:)``
+    ///   - x: Ascending sample positions, or nil to place sample `i` at `x = i`
+    ///   - y: Sample values; must have as many elements as `x`
+    public func setData(series: Int, x: UnsafeBufferPointer<Double>? = nil, y: UnsafeBufferPointer<Double>) {
+        precondition(x == nil || x!.count == y.count, "x and y need the same number of samples")
+        qtPlot.pointee.setSeriesData(Int32(series), x?.baseAddress, y.baseAddress, y.count)
+    }
+    
+    /// Replaces the samples of a series.
+    public func setData(series: Int, x: [Double]? = nil, y: [Double]) {
+        y.withUnsafeBufferPointer { yBuffer in
+            if let x {
+                x.withUnsafeBufferPointer { setData(series: series, x: $0, y: yBuffer) }
+            } else {
+                setData(series: series, x: nil, y: yBuffer)
+            }
+        }
+    }
+    
+    /// Appends samples to a series. Pass `x` exactly when the series was set with `x`.
+    public func append(series: Int, x: UnsafeBufferPointer<Double>? = nil, y: UnsafeBufferPointer<Double>) {
+        precondition(x == nil || x!.count == y.count, "x and y need the same number of samples")
+        qtPlot.pointee.appendSeriesData(Int32(series), x?.baseAddress, y.baseAddress, y.count)
+    }
+    
+    /// Appends samples to a series.
+    public func append(series: Int, x: [Double]? = nil, y: [Double]) {
+        y.withUnsafeBufferPointer { yBuffer in
+            if let x {
+                x.withUnsafeBufferPointer { append(series: series, x: $0, y: yBuffer) }
+            } else {
+                append(series: series, x: nil, y: yBuffer)
+            }
+        }
+    }
+    
+    /// The number of samples in a series
+    public func sampleCount(series: Int) -> Int {
+        Int(qtPlot.pointee.seriesSampleCount(Int32(series)))
+    }
+    
+    /// The smallest and largest value among the samples in `range`, as the min/max pyramid
+    /// reports them to a repaint, or nil if the range is empty or out of bounds
+    public func minMax(series: Int, in range: Range<Int>) -> (min: Double, max: Double)? {
+        guard range.lowerBound >= 0 else { return nil }
+        var low = 0.0
+        var high = 0.0
+        guard qtPlot.pointee.seriesRangeMinMax(Int32(series), range.lowerBound, range.upperBound, &low, &high) else {
+            return nil
+        }
+        return (low, high)
+    }
+    
+    /// Removes all samples of a series.
+    public func clear(series: Int) {
+        qtPlot.pointee.clearSeries(Int32(series))
+    }
+    
+    /// Sets the visible x range; nil fits all samples.
+    public func setXRange(_ range: ClosedRange<Double>?) {
+        qtPlot.pointee.setXRange(range?.lowerBound ?? 0, range?.upperBound ?? 0)
+    }
+    
+    /// Sets the visible y range; nil fits the visible samples.
+    public func setYRange(_ range: ClosedRange<Double>?) {
+        qtPlot.pointee.setYRange(range?.lowerBound ?? 0, range?.upperBound ?? 0)
+    }
+    
+    // MARK: - QtWidget Protocol Implementation
+    
+    public func show() {
+        qtPlot.pointee.show()
+    }
+    
+    public func hide() {
+        qtPlot.pointee.hide()
+    }
+    
+    public func setEnabled(_ enabled: Bool) {
+        qtPlot.pointee.setEnabled(enabled)
+    }
+    
+    public var isVisible: Bool {
+        qtPlot.pointee.isVisible()
+    }
+    
+    public func resize(width: Int, height: Int) {
+        qtPlot.pointee.resize(Int32(width), Int32(height))
+    }
+    
+    public func move(x: Int, y: Int) {
+        qtPlot.pointee.move(Int32(x), Int32(y))
+    }
+    
+    public func setGeometry(x: Int, y: Int, width: Int, height: Int) {
+        qtPlot.pointee.setGeometry(Int32(x), Int32(y), Int32(width), Int32(height))
+    }
+    
+    public func setWindowTitle(_ title: String) {
+        qtPlot.pointee.setWindowTitle(std.string(title))
+    }
+    
+    public var windowTitle: String {
+        String(qtPlot.pointee.windowTitle())
+    }
+    
+    public func setObjectName(_ name: String) {
+        qtPlot.pointee.setObjectName(std.string(name))
+    }
+    
+    public var objectName: String {
+        String(qtPlot.pointee.objectName())
+    }
+    
+    public func setParent(_ parent: QtWidget?) {
+        if let parent = parent {
+            qtPlot.pointee.setParent(parent.getBridgeWidget())
+        } else {
+            qtPlot.pointee.setParent(nil)
+        }
+    }
+}
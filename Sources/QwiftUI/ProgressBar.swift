@@ -163,6 +163,24 @@ public class ProgressBar: QtWidget {
         qtProgressBar.pointee.reset()
     }
     
+    /// Shows the value of a progress channel that worker threads advance.
+    ///
+    /// The channel is sampled every `interval` milliseconds (0 = once per display frame)
+    /// and the bar is only updated when the sample changes its fill, percentage or value
+    /// text. Set ``minimum`` and ``maximum`` to the channel's range.
+    ///
+    /// - Parameters:
+    ///   - channel: The channel to display
+    ///   - interval: Sampling interval in milliseconds, 0 for the display refresh rate
+    public func attach(_ channel: ProgressChannel, interval: Int = 0) {
+        qtProgressBar.pointee.attachProgressChannel(channel.channel, Int32(interval))
+    }
+    
+    /// Stops sampling the attached progress channel.
+    public func detachChannel() {
+        qtProgressBar.pointee.detachProgressChannel()
+    }
+    
     /// Sets a handler for value change events
     /// - Parameter handler: Closure called when the progress value changes
     public func onValueChanged(_ handler: @escaping (Int) -> Void) {
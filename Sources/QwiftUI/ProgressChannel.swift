@@ -0,0 +1,49 @@
+// ABOUTME: ProgressChannel is a lock-free counter that worker threads advance directly
+// ABOUTME: ProgressBar and LCDNumber sample it on a timer instead of receiving one update per change
+
+import Foundation
+import QtBridge
+
+/// A counter that any thread can advance without going through the main actor.
+///
+/// Workers call ``add(_:)`` or ``set(_:)``, which are single atomic operations. Widgets
+/// attached with `ProgressBar.attach(_:interval:)` or `LCDNumber.attach(_:interval:)`
+/// read the counter once per display frame and redraw only when what they show changed,
+/// so millions of increments cost millions of atomic adds and a few dozen repaints.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let progress = ProgressChannel()
+/// progressBar.maximum = files.count
+/// progressBar.attach(progress)
+///
+/// DispatchQueue.concurrentPerform(iterations: files.count) { index in
+///     process(files[index])
+///     progress.add(1)
+/// }
+/// ```
+nonisolated public final class ProgressChannel: @unchecked Sendable {
+    /// Copies of the C++ channel share one atomic counter
+    internal let channel: SwiftProgressChannel
+    
+    /// Creates a channel starting at zero
+    public init() {
+        channel = SwiftProgressChannel()
+    }
+    
+    /// Adds `delta` to the counter. Safe to call from any thread.
+    public func add(_ delta: Int = 1) {
+        channel.add(Int64(delta))
+    }
+    
+    /// Replaces the counter value. Safe to call from any thread.
+    public func set(_ value: Int) {
+        channel.set(Int64(value))
+    }
+    
+    /// The current counter value
+    public var value: Int {
+        Int(channel.value())
+    }
+}
@@ -29,6 +29,23 @@ public enum Qt {
         public static let center: Alignment = [.hCenter, .vCenter]
     }
     
+    /// A color packed as 0xAARRGGBB, the layout of Qt's QRgb
+    public struct Color: Hashable, Sendable {
+        public let argb: UInt32
+        
+        public init(argb: UInt32) {
+            self.argb = argb
+        }
+        
+        /// Creates a color from components in 0...1
+        public init(red: Double, green: Double, blue: Double, alpha: Double = 1) {
+            func channel(_ value: Double) -> UInt32 {
+                UInt32((min(max(value, 0), 1) * 255).rounded())
+            }
+            self.argb = channel(alpha) << 24 | channel(red) << 16 | channel(green) << 8 | channel(blue)
+        }
+    }
+    
     /// Check state for checkable widgets
     public enum CheckState: Int {
         case unchecked = 0
@@ -78,4 +95,28 @@ public protocol QtWidget: AnyObject {
     
     /// Set the widget's parent
     func setParent(_ parent: QtWidget?)
-}
\ No newline at end of file
+}
+
+// MARK: - Colors
+
+extension QtWidget {
+    /// Sets the background color through the widget's palette.
+    ///
+    /// Unlike a style sheet this does not re-parse CSS or repolish the subtree, and
+    /// widgets with the same colors share one palette, so it is cheap to call often
+    /// (blinking indicators, thousands of colored cells). Setting the color already in
+    /// place does nothing.
+    public func setBackgroundColor(_ color: Qt.Color) {
+        getBridgeWidget().pointee.setBackgroundColor(color.argb)
+    }
+    
+    /// Sets the text color through the widget's palette.
+    public func setForegroundColor(_ color: Qt.Color) {
+        getBridgeWidget().pointee.setForegroundColor(color.argb)
+    }
+    
+    /// Reverts background and text colors to the inherited palette.
+    public func clearColors() {
+        getBridgeWidget().pointee.clearColors()
+    }
+}
@@ -0,0 +1,135 @@
+// ABOUTME: Offscreen rendering of widgets into pixel buffers and image files
+// ABOUTME: RenderBatch renders many widgets in one call and encodes them on a thread pool
+
+import Foundation
+import QtBridge
+
+/// Pixels of a rendered widget
+public struct RenderedImage: Sendable {
+    /// Width in pixels
+    public let width: Int
+    /// Height in pixels
+    public let height: Int
+    /// Row-major premultiplied 0xAARRGGBB pixels, `width * height` of them
+    public let pixels: [UInt32]
+    
+    public init(width: Int, height: Int, pixels: [UInt32]) {
+        precondition(pixels.count == width * height, "a rendered image needs width * height pixels")
+        self.width = width
+        self.height = height
+        self.pixels = pixels
+    }
+    
+    /// The pixel at (x, y)
+    public subscript(x: Int, y: Int) -> UInt32 {
+        pixels[y * width + x]
+    }
+}
+
+extension QtWidget {
+    /// Renders the widget offscreen. Works for hidden widgets and on the offscreen platform.
+    ///
+    /// - Parameters:
+    ///   - scale: The device pixel ratio; the image is `scale` times the region's size
+    ///   - region: The part to render in widget coordinates; nil renders the whole widget
+    /// - Returns: nil if the widget has no area
+    public func renderImage(
+        scale: Double = 1,
+        region: (x: Int, y: Int, width: Int, height: Int)? = nil
+    ) -> RenderedImage? {
+        let bridge = getBridgeWidget()
+        let area = region ?? (0, 0, 0, 0)
+        var width: Int32 = 0
+        var height: Int32 = 0
+        guard bridge.pointee.renderPixelSize(scale, Int32(area.width), Int32(area.height), &width, &height) else {
+            return nil
+        }
+        var rendered = false
+        let pixels = [UInt32](unsafeUninitializedCapacity: Int(width) * Int(height)) { buffer, count in
+            let bytes = UnsafeMutableRawPointer(buffer.baseAddress!).assumingMemoryBound(to: UInt8.self)
+            rendered = bridge.pointee.renderToImage(bytes, width * 4, scale,
+                                                    Int32(area.x), Int32(area.y), Int32(area.width), Int32(area.height))
+            count = rendered ? buffer.count : 0
+        }
+        return rendered ? RenderedImage(width: Int(width), height: Int(height), pixels: pixels) : nil
+    }
+    
+    /// Renders the widget offscreen into an image file whose format follows the suffix of `path`.
+    @discardableResult
+    public func render(
+        to path: String,
+        scale: Double = 1,
+        region: (x: Int, y: Int, width: Int, height: Int)? = nil
+    ) -> Bool {
+        let area = region ?? (0, 0, 0, 0)
+        return getBridgeWidget().pointee.renderToFile(std.string(path), scale,
+                                                      Int32(area.x), Int32(area.y), Int32(area.width), Int32(area.height))
+    }
+}
+
+/// Renders many widgets to image files in one call.
+///
+/// Widgets are rendered one after another on the main thread while a thread pool
+/// encodes the images already rendered, so a long batch is limited by whichever of the
+/// two is slower rather than by their sum. Only a few images are held at a time.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let batch = RenderBatch(scale: 2)
+/// for (index, panel) in panels.enumerated() {
+///     batch.add(panel, path: "/tmp/report/panel-\(index).png")
+/// }
+/// let written = batch.run()
+/// ```
+@MainActor
+public final class RenderBatch {
+    private var batch = SwiftRenderBatch()
+    
+    /// Creates an empty batch.
+    ///
+    /// - Parameters:
+    ///   - scale: The device pixel ratio for every image
+    ///   - threadCount: Encoding threads; 0 uses one per core
+    ///   - quality: Encoder quality from 0 to 100, or -1 for the default; for PNG lower values
+    ///     compress less and encode faster
+    public init(scale: Double = 1, threadCount: Int = 0, quality: Int = -1) {
+        batch.setDevicePixelRatio(scale)
+        batch.setThreadCount(Int32(threadCount))
+        batch.setQuality(Int32(quality))
+    }
+    
+    /// The number of widgets added
+    public var count: Int {
+        Int(batch.count())
+    }
+    
+    /// Adds a widget to render into `path`.
+    public func add(
+        _ widget: any QtWidget,
+        path: String,
+        region: (x: Int, y: Int, width: Int, height: Int)? = nil
+    ) {
+        let area = region ?? (0, 0, 0, 0)
+        batch.add(widget.getBridgeWidget(), std.string(path),
+                  Int32(area.x), Int32(area.y), Int32(area.width), Int32(area.height))
+    }
+    
+    /// Removes every widget.
+    public func removeAll() {
+        batch.clear()
+    }
+    
+    /// Renders and writes everything added, returning when all files are written.
+    ///
+    /// - Returns: The number of files written
+    @discardableResult
+    public func run() -> Int {
+        Int(batch.run())
+    }
+    
+    /// Whether the file for the widget added at `index` was written by the last ``run()``
+    public func succeeded(at index: Int) -> Bool {
+        batch.succeeded(Int32(index))
+    }
+}
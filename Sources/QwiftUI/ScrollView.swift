@@ -4,6 +4,31 @@
 import Foundation
 import QtBridge
 
+/// The visible part of a scroll view's content, in content coordinates.
+public struct ScrollViewport: Equatable, Sendable {
+    public var x: Int
+    public var y: Int
+    public var width: Int
+    public var height: Int
+    
+    /// Margin around the visible rect worth preparing content for
+    public var overscan: Int
+    
+    public init(x: Int, y: Int, width: Int, height: Int, overscan: Int = 0) {
+        self.x = x
+        self.y = y
+        self.width = width
+        self.height = height
+        self.overscan = overscan
+    }
+    
+    /// Top of the visible rect grown by the overscan margin
+    public var expandedMinY: Int { y - overscan }
+    
+    /// Bottom of the visible rect grown by the overscan margin
+    public var expandedMaxY: Int { y + height + overscan }
+}
+
 /// A scroll view widget that provides a scrollable viewport for its content.
 ///
 /// ScrollView allows you to display content that is larger than the visible area,
@@ -111,6 +136,7 @@ public class ScrollView: QtWidget {
     }
     
     deinit {
+        CallbackManager.shared.remove(for: self)
         // Clean up the C++ object
         let ptr = qtScrollArea
         ptr.deinitialize(count: 1)
@@ -174,6 +200,43 @@ public class ScrollView: QtWidget {
         horizontalScrollValue = horizontalScrollMaximum
     }
     
+    /// The currently visible part of the content
+    public var viewport: ScrollViewport {
+        var x: Int32 = 0, y: Int32 = 0, width: Int32 = 0, height: Int32 = 0
+        qtScrollArea.pointee.visibleContentRect(&x, &y, &width, &height)
+        return ScrollViewport(x: Int(x), y: Int(y), width: Int(width), height: Int(height))
+    }
+    
+    /// Sets a handler told what part of the content is visible.
+    ///
+    /// The handler runs once right away and then whenever scrolling, a content size
+    /// change or a resize of the scroll view moves the visible rect, at most once per
+    /// display frame with the latest rect.
+    ///
+    /// - Parameters:
+    ///   - overscan: Margin reported with the rect, for content built ahead of scrolling
+    ///   - handler: Closure called with the visible rect
+    public func onViewportChanged(overscan: Int = 0, _ handler: @escaping (ScrollViewport) -> Void) {
+        let eventCallback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.ViewportChanged) { info in
+            guard info.type == QtEventType.ViewportChanged, let data = info.customData else { return }
+            let rect = data.assumingMemoryBound(to: QtViewportRect.self).pointee
+            handler(ScrollViewport(
+                x: Int(rect.x), y: Int(rect.y),
+                width: Int(rect.width), height: Int(rect.height),
+                overscan: Int(rect.overscan)
+            ))
+        }
+        qtScrollArea.pointee.setViewportChangedHandler(eventCallback.pointee, Int32(overscan))
+    }
+    
+    /// Calls the viewport handler now if a change is waiting for the next frame.
+    ///
+    /// Viewport changes are delivered at most once per display frame. Call this after
+    /// scrolling programmatically when the handler's work is needed before returning.
+    public func flushViewportChanges() {
+        qtScrollArea.pointee.flushViewportChanged()
+    }
+    
     /// Sets a handler for vertical scroll events
     /// - Parameter handler: Closure called when vertical scrolling occurs with the new value
     public func onVerticalScroll(_ handler: @escaping (Int) -> Void) {
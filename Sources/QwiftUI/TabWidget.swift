@@ -18,9 +18,12 @@ import QtBridge
 /// let page2 = Widget()
 /// tabWidget.addTab(page1, label: "First Tab")
 /// tabWidget.addTab(page2, label: "Second Tab")
+///
+/// // Built the first time the tab is shown
+/// tabWidget.addLazyTab(label: "Reports") { ReportsPage() }
 /// ```
 @MainActor
-public class TabWidget: QtWidget {
+public class TabWidget: SafeEventWidget, QtWidget {
     /// Tab position enumeration
     public enum TabPosition: Int {
         case north = 0  // Tabs at the top (default)
@@ -38,8 +41,8 @@ public class TabWidget: QtWidget {
         return UnsafeMutableRawPointer(qtTabWidget).assumingMemoryBound(to: SwiftQWidget.self)
     }
     
-    /// Track child widgets to prevent deallocation
-    private var childTabs: [(widget: any QtWidget, label: String)] = []
+    /// Track child widgets to prevent deallocation; lazy tabs hold their page once built
+    private var childTabs: [(widget: (any QtWidget)?, lazy: LazyTab?, label: String)] = []
     
     /// The current tab index
     public var currentIndex: Int {
@@ -99,6 +102,8 @@ public class TabWidget: QtWidget {
         } else {
             qtTabWidget.initialize(to: SwiftQTabWidget())
         }
+        
+        super.init()
     }
     
     deinit {
@@ -116,7 +121,7 @@ public class TabWidget: QtWidget {
     /// - Returns: The index of the newly added tab
     @discardableResult
     public func addTab(_ widget: any QtWidget, label: String) -> Int {
-        childTabs.append((widget: widget, label: label))
+        childTabs.append((widget: widget, lazy: nil, label: label))
         return Int(qtTabWidget.pointee.addTab(widget.getBridgeWidget(), std.string(label)))
     }
     
@@ -130,20 +135,91 @@ public class TabWidget: QtWidget {
     @discardableResult
     public func insertTab(_ index: Int, widget: any QtWidget, label: String) -> Int {
         if index <= childTabs.count {
-            childTabs.insert((widget: widget, label: label), at: index)
+            childTabs.insert((widget: widget, lazy: nil, label: label), at: index)
         } else {
-            childTabs.append((widget: widget, label: label))
+            childTabs.append((widget: widget, lazy: nil, label: label))
         }
         return Int(qtTabWidget.pointee.insertTab(Int32(index), widget.getBridgeWidget(), std.string(label)))
     }
     
+    /// Adds a tab whose page is built the first time the tab becomes current
+    ///
+    /// - Parameters:
+    ///   - label: The text to display on the tab
+    ///   - build: Creates the page
+    /// - Returns: The index of the newly added tab
+    @discardableResult
+    public func addLazyTab(label: String, build: @escaping () -> any QtWidget) -> Int {
+        addLazyTab(label: label, build: { _ in build() }, saveState: nil)
+    }
+    
+    /// Adds a tab whose page is built on first visit and may be evicted again
+    ///
+    /// When eviction is enabled with ``setLazyTabEviction(afterIdleActivations:)``,
+    /// `saveState` is called with the page just before it is destroyed, and whatever it
+    /// returns is passed to `build` when the tab is visited again.
+    ///
+    /// - Parameters:
+    ///   - label: The text to display on the tab
+    ///   - build: Creates the page, restoring the saved state if there is one
+    ///   - saveState: Captures the page state before eviction
+    /// - Returns: The index of the newly added tab
+    @discardableResult
+    public func addLazyTab(
+        label: String,
+        build: @escaping (_ restoredState: Any?) -> any QtWidget,
+        saveState: ((any QtWidget) -> Any?)?
+    ) -> Int {
+        let entry = LazyTab(build: build, saveState: saveState)
+        // Registered before the tab exists: adding the first tab requests its page immediately
+        childTabs.append((widget: nil, lazy: entry, label: label))
+        
+        let callback = CallbackHelper.createEventCallback(context: entry) { [weak self, weak entry] info in
+            guard let self = self, let entry = entry else { return }
+            if info.type == QtEventType.PageRequested {
+                let page = entry.build(entry.savedState)
+                entry.savedState = nil
+                entry.page = page
+                self.qtTabWidget.pointee.setLazyTabPage(info.intValue, page.getBridgeWidget())
+            } else if info.type == QtEventType.PageEvicted {
+                if let page = entry.page {
+                    entry.savedState = entry.saveState?(page)
+                }
+                entry.page = nil
+            }
+        }
+        
+        let tabId = qtTabWidget.pointee.addLazyTab(std.string(label), callback.pointee)
+        return Int(qtTabWidget.pointee.lazyTabIndex(tabId))
+    }
+    
+    /// Destroys lazily built pages that were not visited in the last `count` tab changes
+    ///
+    /// - Parameter count: Number of tab activations a page may stay unvisited, or nil to
+    ///   keep built pages forever
+    public func setLazyTabEviction(afterIdleActivations count: Int?) {
+        qtTabWidget.pointee.setLazyTabEviction(Int32(count ?? 0))
+    }
+    
+    /// Whether the page of the tab at the specified index currently exists
+    ///
+    /// - Parameter index: The index of the tab
+    /// - Returns: True for regular tabs and for lazy tabs whose page has been built
+    public func isPageLoaded(at index: Int) -> Bool {
+        guard index >= 0 && index < childTabs.count else { return false }
+        return childTabs[index].widget != nil || childTabs[index].lazy?.page != nil
+    }
+    
     /// Removes the tab at the specified index
     ///
     /// - Parameter index: The index of the tab to remove
     public func removeTab(_ index: Int) {
         guard index >= 0 && index < childTabs.count else { return }
-        childTabs.remove(at: index)
+        let removed = childTabs.remove(at: index)
+        // Removing the tab can make a lazy tab current and run its factory; the removed
+        // tab's callback context stays alive until the bridge has forgotten it
         qtTabWidget.pointee.removeTab(Int32(index))
+        withExtendedLifetime(removed) {}
     }
     
     /// Sets the text of the tab at the specified index
@@ -195,14 +271,18 @@ public class TabWidget: QtWidget {
     /// - Returns: The widget at the specified index, or nil if invalid
     public func widget(at index: Int) -> (any QtWidget)? {
         guard index >= 0 && index < childTabs.count else { return nil }
-        return childTabs[index].widget
+        return childTabs[index].widget ?? childTabs[index].lazy?.page
     }
     
     /// Sets a handler for tab change events
     /// - Parameter handler: Closure called when the current tab changes
     public func onCurrentChanged(_ handler: @escaping (Int) -> Void) {
-        // TODO: Connect to currentChanged signal
-        // This would require signal/slot connection implementation
+        let callback = CallbackHelper.createEventCallback(context: self, eventType: .CurrentIndexChanged) { info in
+            if info.type == QtEventType.CurrentIndexChanged {
+                handler(Int(info.intValue))
+            }
+        }
+        qtTabWidget.pointee.setCurrentChangedHandler(callback.pointee)
     }
     
     // MARK: - QtWidget Protocol Implementation
@@ -258,4 +338,22 @@ public class TabWidget: QtWidget {
             qtTabWidget.pointee.setParent(nil)
         }
     }
-}
\ No newline at end of file
+}
+
+/// State of a tab whose page is built on demand
+@MainActor
+private final class LazyTab {
+    let build: (Any?) -> any QtWidget
+    let saveState: ((any QtWidget) -> Any?)?
+    var page: (any QtWidget)?
+    var savedState: Any?
+    
+    init(build: @escaping (Any?) -> any QtWidget, saveState: ((any QtWidget) -> Any?)?) {
+        self.build = build
+        self.saveState = saveState
+    }
+    
+    deinit {
+        CallbackManager.shared.remove(for: self)
+    }
+}
@@ -4,9 +4,23 @@
 import Foundation
 import QtBridge
 
+/// A single incremental edit applied to a text edit's document
+public struct TextDelta {
+    /// Document position (UTF-16 code units) where the edit starts
+    public let position: Int
+    /// Number of characters removed at `position`
+    public let charsRemoved: Int
+    /// Number of characters inserted at `position`
+    public let charsAdded: Int
+    /// The inserted text
+    public let addedText: String
+    /// The document revision after this edit
+    public let revision: Int
+}
+
 /// A multi-line text input widget with rich text support
 @MainActor
-public class TextEdit: QtWidget, QtTextInput {
+public class TextEdit: SafeEventWidget, QtWidget, QtTextInput {
     /// The underlying Qt text edit stored as a pointer
     /// Marked as nonisolated(unsafe) since pointer operations are inherently unsafe
     nonisolated(unsafe) internal var qtTextEdit: UnsafeMutablePointer<SwiftQTextEdit>
@@ -19,14 +33,14 @@ public class TextEdit: QtWidget, QtTextInput {
     
     /// The plain text content
     public var text: String {
-        get { String(qtTextEdit.pointee.toPlainText()) }
-        set { qtTextEdit.pointee.setPlainText(std.string(newValue)) }
+        get { stringFromUTF8Export { qtTextEdit.pointee.toPlainTextUtf8($0) } }
+        set { withUTF8Argument(newValue) { qtTextEdit.pointee.setPlainText($0, $1) } }
     }
     
     /// The HTML content
     public var html: String {
-        get { String(qtTextEdit.pointee.toHtml()) }
-        set { qtTextEdit.pointee.setHtml(std.string(newValue)) }
+        get { stringFromUTF8Export { qtTextEdit.pointee.toHtmlUtf8($0) } }
+        set { withUTF8Argument(newValue) { qtTextEdit.pointee.setHtml($0, $1) } }
     }
     
     /// Placeholder text shown when the text edit is empty
@@ -35,6 +49,19 @@ public class TextEdit: QtWidget, QtTextInput {
         set { qtTextEdit.pointee.setPlaceholderText(std.string(newValue)) }
     }
     
+    /// The document revision, bumped on every edit.
+    ///
+    /// Compare against a previously seen revision to detect changes
+    /// without reading the whole document.
+    public var revision: Int {
+        Int(qtTextEdit.pointee.revision())
+    }
+    
+    /// The number of characters (UTF-16 code units) in the document
+    public var characterCount: Int {
+        Int(qtTextEdit.pointee.characterCount())
+    }
+    
     /// Maximum allowed text length (not directly supported)
     public var maxLength: Int {
         get { Int.max }
@@ -59,8 +86,11 @@ public class TextEdit: QtWidget, QtTextInput {
             qtTextEdit.initialize(to: SwiftQTextEdit())
         }
         
+        // Call super.init() after all stored properties are initialized
+        super.init()
+        
         if !text.isEmpty {
-            qtTextEdit.pointee.setPlainText(std.string(text))
+            withUTF8Argument(text) { qtTextEdit.pointee.setPlainText($0, $1) }
         }
     }
     
@@ -77,6 +107,14 @@ public class TextEdit: QtWidget, QtTextInput {
         qtTextEdit.pointee.clear()
     }
     
+    /// Reads a range of the plain text without serializing the whole document
+    /// - Parameters:
+    ///   - position: Start position in UTF-16 code units
+    ///   - length: Number of characters to read, or nil to read to the end
+    public func text(from position: Int, length: Int? = nil) -> String {
+        String(qtTextEdit.pointee.textRange(Int32(position), Int32(length ?? -1)))
+    }
+    
     /// Select all text (not directly supported)
     public func selectAll() {
         // Not directly supported by our C++ wrapper
@@ -85,10 +123,60 @@ public class TextEdit: QtWidget, QtTextInput {
     // MARK: - Event Handling
     
     /// Sets a handler for text change events
-    /// - Parameter handler: Closure called when the text changes
-    public func onTextChanged(_ handler: @escaping (String) -> Void) {
-        // TODO: Connect to QTextEdit textChanged signal in QtBridge
-        // For now, this is a placeholder
+    ///
+    /// Each delivery serializes the whole document; prefer `onContentsChanged`
+    /// or a coalescing `delivery` for large documents.
+    /// - Parameters:
+    ///   - delivery: How often the handler runs while the user is typing
+    ///   - handler: Closure called with the latest plain text
+    @discardableResult
+    public func onTextChanged(
+        delivery: ChangeDelivery = .immediate,
+        _ handler: @escaping (String) -> Void
+    ) -> Self {
+        // Create a heap-allocated event callback (automatically managed)
+        let callback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.TextChanged) { info in
+            if info.type == QtEventType.TextChanged, let text = info.stringValue {
+                handler(String(cString: text))
+            }
+        }
+        
+        // Pass the callback to C++
+        let parameters = delivery.bridgeParameters
+        qtTextEdit.pointee.setTextChangedHandler(callback.pointee, parameters.coalesceMs, parameters.debounce)
+        
+        return self
+    }
+    
+    /// Sets a handler that receives each document edit as a delta.
+    ///
+    /// Only the inserted text crosses the bridge, so consumers such as autosave
+    /// can track changes without copying the whole document per keystroke.
+    /// - Parameter handler: Closure called with every edit
+    @discardableResult
+    public func onContentsChanged(_ handler: @escaping (TextDelta) -> Void) -> Self {
+        // Create a heap-allocated event callback (automatically managed)
+        let callback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.ContentsChanged) { info in
+            guard info.type == QtEventType.ContentsChanged, let data = info.customData else { return }
+            let delta = data.assumingMemoryBound(to: QtTextDelta.self).pointee
+            var addedText = ""
+            if let bytes = delta.addedText, delta.addedTextLength > 0 {
+                let buffer = UnsafeRawBufferPointer(start: bytes, count: Int(delta.addedTextLength))
+                addedText = String(decoding: buffer, as: UTF8.self)
+            }
+            handler(TextDelta(
+                position: Int(delta.position),
+                charsRemoved: Int(delta.charsRemoved),
+                charsAdded: Int(delta.charsAdded),
+                addedText: addedText,
+                revision: Int(delta.revision)
+            ))
+        }
+        
+        // Pass the callback to C++
+        qtTextEdit.pointee.setContentsChangedHandler(callback.pointee)
+        
+        return self
     }
     
     // MARK: - QtWidget Protocol Implementation
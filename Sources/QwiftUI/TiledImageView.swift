@@ -0,0 +1,171 @@
+// ABOUTME: TiledImageView displays very large images by decoding visible tiles on demand
+// ABOUTME: This wraps SwiftQTiledImageView, which decodes tiles on a background pool into an LRU cache
+
+import Foundation
+import QtBridge
+
+/// An image viewer for images too large to load whole, such as gigapixel scans.
+///
+/// Unlike ``ImageView`` it never decodes the full image. Only the tiles visible at
+/// the current zoom are read, at the resolution of the nearest mip level, on background
+/// threads; memory use follows the viewport and the cache limit rather than the image
+/// size. Dragging pans and the mouse wheel zooms around the pointer.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let viewer = TiledImageView()
+/// viewer.cacheLimit = 128 * 1024 * 1024
+/// if viewer.load(path: "/scans/wafer-20k.jpg") {
+///     viewer.setZoom(1, anchorX: 0, anchorY: 0)
+/// }
+/// ```
+@MainActor
+public class TiledImageView: SafeEventWidget, QtWidget {
+    /// The underlying Qt viewer stored as a pointer
+    nonisolated(unsafe) internal var qtViewer: UnsafeMutablePointer<SwiftQTiledImageView>
+    
+    /// Protocol conformance - provide mutable pointer
+    public func getBridgeWidget() -> UnsafeMutablePointer<SwiftQWidget> {
+        // Cast from SwiftQTiledImageView* to SwiftQWidget* (base class pointer)
+        return UnsafeMutableRawPointer(qtViewer).assumingMemoryBound(to: SwiftQWidget.self)
+    }
+    
+    /// The full-resolution size of the loaded image, zero when none is loaded
+    public var imageSize: (width: Int, height: Int) {
+        (Int(qtViewer.pointee.imageWidth()), Int(qtViewer.pointee.imageHeight()))
+    }
+    
+    /// Widget pixels per image pixel
+    public var zoom: Double {
+        qtViewer.pointee.zoom()
+    }
+    
+    /// Whether dragging pans and the wheel zooms
+    public var isInteractive: Bool = true {
+        didSet {
+            qtViewer.pointee.setInteractive(isInteractive)
+        }
+    }
+    
+    /// Upper bound for decoded tiles kept in memory, in bytes (default 96 MB)
+    public var cacheLimit: Int = 96 * 1024 * 1024 {
+        didSet {
+            qtViewer.pointee.setCacheLimit(Int64(cacheLimit))
+        }
+    }
+    
+    /// Bytes of decoded tiles currently cached
+    public var cachedBytes: Int {
+        Int(qtViewer.pointee.cachedBytes())
+    }
+    
+    /// Tiles queued or being decoded
+    public var pendingTileCount: Int {
+        Int(qtViewer.pointee.pendingTileCount())
+    }
+    
+    /// Creates a new tiled image view
+    ///
+    /// - Parameter parent: The parent widget. If nil, creates a top-level viewer.
+    public init(parent: (any QtWidget)? = nil) {
+        qtViewer = UnsafeMutablePointer<SwiftQTiledImageView>.allocate(capacity: 1)
+        
+        if let parent = parent {
+            qtViewer.initialize(to: SwiftQTiledImageView(parent.getBridgeWidget()))
+        } else {
+            qtViewer.initialize(to: SwiftQTiledImageView())
+        }
+        
+        super.init()
+    }
+    
+    deinit {
+        let ptr = qtViewer
+        ptr.deinitialize(count: 1)
+        ptr.deallocate()
+    }
+    
+    /// Opens an image. Only its header is read here; tiles decode as they become visible.
+    ///
+    /// - Parameter path: Path to the image file
+    /// - Returns: false if the file is not a readable image
+    @discardableResult
+    public func load(path: String) -> Bool {
+        qtViewer.pointee.load(std.string(path))
+    }
+    
+    /// Sets the zoom, keeping the image point under the anchor in place.
+    ///
+    /// - Parameters:
+    ///   - zoom: Widget pixels per image pixel
+    ///   - anchorX: Anchor x in widget coordinates
+    ///   - anchorY: Anchor y in widget coordinates
+    public func setZoom(_ zoom: Double, anchorX: Double, anchorY: Double) {
+        qtViewer.pointee.setZoom(zoom, anchorX, anchorY)
+    }
+    
+    /// Moves the image by the given number of widget pixels.
+    public func pan(dx: Double, dy: Double) {
+        qtViewer.pointee.panBy(dx, dy)
+    }
+    
+    /// Zooms so the whole image fits and centers it.
+    public func fitToView() {
+        qtViewer.pointee.fitToView()
+    }
+    
+    // MARK: - QtWidget Protocol Implementation
+    
+    public func show() {
+        qtViewer.pointee.show()
+    }
+    
+    public func hide() {
+        qtViewer.pointee.hide()
+    }
+    
+    public func setEnabled(_ enabled: Bool) {
+        qtViewer.pointee.setEnabled(enabled)
+    }
+    
+    public var isVisible: Bool {
+        qtViewer.pointee.isVisible()
+    }
+    
+    public func resize(width: Int, height: Int) {
+        qtViewer.pointee.resize(Int32(width), Int32(height))
+    }
+    
+    public func move(x: Int, y: Int) {
+        qtViewer.pointee.move(Int32(x), Int32(y))
+    }
+    
+    public func setGeometry(x: Int, y: Int, width: Int, height: Int) {
+        qtViewer.pointee.setGeometry(Int32(x), Int32(y), Int32(width), Int32(height))
+    }
+    
+    public func setWindowTitle(_ title: String) {
+        qtViewer.pointee.setWindowTitle(std.string(title))
+    }
+    
+    public var windowTitle: String {
+        String(qtViewer.pointee.windowTitle())
+    }
+    
+    public func setObjectName(_ name: String) {
+        qtViewer.pointee.setObjectName(std.string(name))
+    }
+    
+    public var objectName: String {
+        String(qtViewer.pointee.objectName())
+    }
+    
+    public func setParent(_ parent: QtWidget?) {
+        if let parent = parent {
+            qtViewer.pointee.setParent(parent.getBridgeWidget())
+        } else {
+            qtViewer.pointee.setParent(nil)
+        }
+    }
+}
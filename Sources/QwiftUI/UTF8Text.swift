@@ -0,0 +1,29 @@
+// ABOUTME: Helpers for passing text to the bridge's UTF-8 (pointer, length) overloads
+// ABOUTME: Avoids the std.string round trip so each transfer is a single transcode
+
+import Foundation
+import QtBridge
+
+/// Calls `body` with the UTF-8 bytes of `string` as the (pointer, length) pair taken by
+/// the bridge's UTF-8 setters. Native Swift strings are passed without copying.
+internal func withUTF8Argument<Result>(
+    _ string: String,
+    _ body: (UnsafePointer<CChar>?, Int) -> Result
+) -> Result {
+    var string = string
+    return string.withUTF8 { bytes in
+        bytes.withMemoryRebound(to: CChar.self) { chars in
+            body(chars.baseAddress, chars.count)
+        }
+    }
+}
+
+/// Builds a String from one of the bridge's `...Utf8(&length)` getters.
+///
+/// The getter's buffer belongs to the wrapper and is reused by its next UTF-8 getter
+/// call, so the bytes are copied into the String right away.
+internal func stringFromUTF8Export(_ export: (UnsafeMutablePointer<Int>) -> UnsafePointer<CChar>?) -> String {
+    var length = 0
+    guard let bytes = export(&length), length > 0 else { return "" }
+    return String(decoding: UnsafeRawBufferPointer(start: bytes, count: length), as: UTF8.self)
+}
@@ -28,6 +28,9 @@ public class Widget: QtWidget {
     /// Marked as nonisolated(unsafe) since pointer operations are inherently unsafe
     nonisolated(unsafe) internal var qtWidget: UnsafeMutablePointer<SwiftQWidget>
     
+    /// Whether deinit deletes the bridge object
+    private let ownsPointer: Bool
+    
     /// Protocol conformance - provide mutable pointer
     public func getBridgeWidget() -> UnsafeMutablePointer<SwiftQWidget> {
         return qtWidget
@@ -38,6 +41,7 @@ public class Widget: QtWidget {
     ///
     /// - Parameter parent: The parent widget. If nil, creates a top-level widget.
     public init(parent: (any QtWidget)? = nil) {
+        ownsPointer = true
         // Create the C++ object directly using factory function
         // We can't use Swift's initialize(to:) because SwiftQWidget isn't safely copyable
         if let parent = parent {
@@ -48,21 +52,25 @@ public class Widget: QtWidget {
     }
     
     /// Initialize with an existing Qt widget pointer.
-    /// Used for bridging Qt objects from C++ code.
+    /// Used for bridging Qt objects from C++ code. Event handlers set on a borrowed
+    /// wrapper (`ownsPointer: false`) replace those of its owner; use ``WidgetView``
+    /// to refer to widgets created elsewhere.
     /// - Parameter qtWidgetPtr: A pointer to an existing SwiftQWidget
     /// - Parameter ownsPointer: Whether this Swift object owns the C++ pointer and should deallocate it
     public init(fromBridge qtWidgetPtr: UnsafeMutablePointer<SwiftQWidget>, ownsPointer: Bool = true) {
-        // We always take ownership of the pointer now since we're using factory functions
         self.qtWidget = qtWidgetPtr
+        self.ownsPointer = ownsPointer
     }
     
     deinit {
         // CallbackManager automatically handles callback cleanup
         CallbackManager.shared.remove(for: self)
         
-        // Since we're using factory functions that allocate with new,
-        // we need to delete the C++ object
-        deleteQWidget(qtWidget)
+        // Objects from the factory functions are allocated with new and ours to delete;
+        // borrowed ones (e.g. registry wrappers) belong to someone else
+        if ownsPointer {
+            deleteQWidget(qtWidget)
+        }
     }
     
     
@@ -152,11 +160,21 @@ public class Widget: QtWidget {
         Int(qtWidget.pointee.height())
     }
     
-    /// Gets the children of this widget
+    /// Gets the direct child widgets of this widget
+    ///
+    /// Each child is a read-only ``WidgetView`` of the child's canonical bridge wrapper.
+    /// Views have no event handler setters; handlers stay with the object that created
+    /// the child.
     public var children: [any QtWidget] {
-        // TODO: Implement proper child tracking
-        // For now, return empty array
-        []
+        let count = Int(qtWidget.pointee.childCount())
+        var result: [any QtWidget] = []
+        result.reserveCapacity(count)
+        for index in 0..<count {
+            if let child = qtWidget.pointee.childAt(Int32(index)), let view = WidgetView(child) {
+                result.append(view)
+            }
+        }
+        return result
     }
     
     // MARK: - Event Handling
@@ -172,6 +190,28 @@ public class Widget: QtWidget {
         qtWidget.pointee.setEventHandler(QtEventType.Resize, eventCallback.pointee)
     }
     
+    /// Sets a handler for resize events that also reports whether the size is final
+    ///
+    /// With ``ResizeDelivery/live(intervalMilliseconds:)`` the intermediate deliveries
+    /// made while the user is still dragging report `isFinal == false`; all other
+    /// deliveries report `true`.
+    /// - Parameter handler: Closure called with the new size and the final flag
+    public func onLiveResize(_ handler: @escaping (_ width: Int, _ height: Int, _ isFinal: Bool) -> Void) {
+        let eventCallback = CallbackHelper.createEventCallback(context: self) { info in
+            if info.type == QtEventType.Resize {
+                handler(Int(info.intValue), Int(info.intValue2), info.boolValue)
+            }
+        }
+        qtWidget.pointee.setEventHandler(QtEventType.Resize, eventCallback.pointee)
+    }
+    
+    /// Sets how often resize handlers run while the widget keeps being resized
+    /// - Parameter delivery: The coalescing policy; the widget itself still sees every resize
+    public func setResizeDelivery(_ delivery: ResizeDelivery) {
+        let parameters = delivery.bridgeParameters
+        qtWidget.pointee.setResizeCoalescing(parameters.mode, parameters.intervalMs)
+    }
+    
     /// Sets a handler for mouse press events
     /// - Parameter handler: Closure called when the mouse is pressed with the position (x, y)
     public func onMousePress(_ handler: @escaping (Int, Int) -> Void) {
@@ -194,6 +234,37 @@ public class Widget: QtWidget {
         qtWidget.pointee.setEventHandler(QtEventType.MouseRelease, eventCallback.pointee)
     }
     
+    /// Sets a handler for mouse move events
+    ///
+    /// Moves are reported while a button is held, or always once mouse tracking is
+    /// turned on (see ``onMouseMoves(tracking:_:)``).
+    /// - Parameter handler: Closure called for every move with the position (x, y)
+    public func onMouseMove(_ handler: @escaping (Int, Int) -> Void) {
+        let eventCallback = CallbackHelper.createEventCallback(context: self) { info in
+            if info.type == QtEventType.MouseMove {
+                handler(Int(info.intValue), Int(info.intValue2))
+            }
+        }
+        qtWidget.pointee.setEventHandler(QtEventType.MouseMove, eventCallback.pointee)
+    }
+    
+    /// Sets a handler that receives mouse moves in batches, once per display frame
+    ///
+    /// Every move is kept, with its buttons, modifiers and timestamp, so a drawing tool
+    /// can rebuild the full stroke while paying for a single call per frame. Moves still
+    /// pending when a button is pressed or released are delivered first.
+    /// - Parameters:
+    ///   - tracking: Also report moves while no button is held
+    ///   - handler: Closure called with the moves since the previous batch, oldest first
+    public func onMouseMoves(tracking: Bool = false, _ handler: @escaping (MouseSamples) -> Void) {
+        let eventCallback = CallbackHelper.createEventCallback(context: self, eventType: QtEventType.MouseMoveBatch) { info in
+            guard info.type == QtEventType.MouseMoveBatch, let data = info.customData else { return }
+            let buffer = UnsafeBufferPointer(start: data.assumingMemoryBound(to: QtMouseSample.self), count: Int(info.intValue))
+            handler(MouseSamples(buffer: buffer))
+        }
+        qtWidget.pointee.setMouseMoveBatchHandler(eventCallback.pointee, tracking)
+    }
+    
     /// Sets a handler for focus in events
     /// - Parameter handler: Closure called when the widget gains focus
     public func onFocusIn(_ handler: @escaping () -> Void) {
@@ -0,0 +1,114 @@
+// ABOUTME: WidgetSnapshot captures a widget subtree into a compact binary format and rebuilds it
+// ABOUTME: Snapshots can be saved, memory-mapped back from disk and listed as text for diffing
+
+import Foundation
+import QtBridge
+
+/// A serialized copy of a widget subtree.
+///
+/// A snapshot records each widget's class, object name, geometry, visibility, the event
+/// types it has handlers for, and the stored Qt properties that differ from a freshly
+/// constructed widget of the same class. Strings are stored once in a shared table, so
+/// a snapshot of a large form stays small; loading one from disk maps the file rather
+/// than reading it.
+///
+/// Restoring recreates the stock Qt widgets under an existing widget. Event handlers are
+/// Swift closures and are not restored; ``eventMask(at:)`` tells which ones were set.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let snapshot = WidgetSnapshot()
+/// snapshot.capture(settingsPanel)
+/// snapshot.save(path: "/tmp/settings.qwsn")
+///
+/// let copy = WidgetSnapshot()
+/// if copy.load(path: "/tmp/settings.qwsn") {
+///     copy.restore(into: previewPane)
+/// }
+/// ```
+@MainActor
+public final class WidgetSnapshot {
+    private var snapshot = SwiftWidgetSnapshot()
+    
+    public init() {}
+    
+    /// Records `root` and its descendants, replacing the current contents.
+    ///
+    /// - Returns: false if the widget has not been created yet
+    @discardableResult
+    public func capture(_ root: any QtWidget) -> Bool {
+        snapshot.capture(root.getBridgeWidget())
+    }
+    
+    /// Writes the snapshot bytes to `path`.
+    @discardableResult
+    public func save(path: String) -> Bool {
+        snapshot.save(std.string(path))
+    }
+    
+    /// Loads a snapshot written by ``save(path:)``. The file is mapped into memory.
+    ///
+    /// - Returns: false if the file cannot be read or is not a valid snapshot;
+    ///   the current contents are kept in that case
+    @discardableResult
+    public func load(path: String) -> Bool {
+        snapshot.load(std.string(path))
+    }
+    
+    /// Loads a snapshot from bytes previously taken from ``bytes``.
+    @discardableResult
+    public func load(bytes: [UInt8]) -> Bool {
+        bytes.withUnsafeBufferPointer { buffer in
+            snapshot.loadBytes(buffer.baseAddress, buffer.count)
+        }
+    }
+    
+    /// The encoded snapshot
+    public var bytes: [UInt8] {
+        guard let start = snapshot.bytes() else { return [] }
+        return Array(UnsafeBufferPointer(start: start, count: snapshot.byteCount()))
+    }
+    
+    /// The number of widgets recorded, the root included
+    public var widgetCount: Int {
+        Int(snapshot.widgetCount())
+    }
+    
+    /// One line per widget, indented by depth, with its non-default properties below it.
+    /// Two snapshots of the same tree produce identical text.
+    public var text: String {
+        String(snapshot.toText())
+    }
+    
+    /// The Qt class name of the widget at `index` (pre-order, the root is 0)
+    public func className(at index: Int) -> String {
+        String(snapshot.className(Int32(index)))
+    }
+    
+    /// The object name of the widget at `index`
+    public func objectName(at index: Int) -> String {
+        String(snapshot.objectName(Int32(index)))
+    }
+    
+    /// The event types the widget at `index` had handlers for when captured
+    public func eventMask(at index: Int) -> UInt64 {
+        UInt64(snapshot.eventMask(Int32(index)))
+    }
+    
+    /// Rebuilds the recorded children under `target`.
+    ///
+    /// The target takes the root's size and, if it is of the same class, its properties.
+    /// Painting is suspended until the whole subtree exists.
+    @discardableResult
+    public func restore(into target: any QtWidget) -> Bool {
+        snapshot.restore(target.getBridgeWidget())
+    }
+    
+    /// The widget created for record `index` by the last ``restore(into:)``, as a read-only
+    /// view that goes inert once Qt deletes the restored widget
+    public func restoredWidget(at index: Int) -> WidgetView? {
+        guard let widget = snapshot.restoredWidget(Int32(index)) else { return nil }
+        return WidgetView(widget)
+    }
+}
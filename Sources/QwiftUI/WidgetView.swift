@@ -0,0 +1,105 @@
+// ABOUTME: WidgetView is a read-only handle to a widget found by walking or querying the widget tree
+// ABOUTME: It resolves through the bridge registry on every use, so it goes inert once the widget is gone
+
+import Foundation
+import QtBridge
+
+/// A handle to a widget that some other object created.
+///
+/// Tree walks such as ``Widget/children`` and test queries return views rather than
+/// new wrapper objects. A view can show, hide, move and reparent its widget and read its
+/// properties, but it has no event handler setters: handlers belong to the object that
+/// created the widget, and setting them through a second Swift object would replace
+/// the creator's handlers. To react to events, keep a reference to the original object.
+///
+/// A view refers to the widget's wrapper through a generation-checked registry handle.
+/// When the wrapper or its widget is destroyed, ``isValid`` becomes false and every
+/// operation on the view does nothing.
+@MainActor
+public final class WidgetView: QtWidget {
+    private let handle: UInt64
+    
+    /// Creates a view of the widget behind `bridge`, or nil if that wrapper is not registered
+    public init?(_ bridge: UnsafeMutablePointer<SwiftQWidget>) {
+        let handle = UInt64(SwiftWidgetRegistry.handleFor(bridge))
+        guard handle != 0 else { return nil }
+        self.handle = handle
+    }
+    
+    /// Whether the widget still exists
+    public var isValid: Bool {
+        SwiftWidgetRegistry.resolve(CUnsignedLongLong(handle)) != nil
+    }
+    
+    /// The widget's bridge wrapper, or a shared inert wrapper once the widget is gone
+    public func getBridgeWidget() -> UnsafeMutablePointer<SwiftQWidget> {
+        SwiftWidgetRegistry.resolve(CUnsignedLongLong(handle)) ?? SwiftWidgetRegistry.detached()
+    }
+    
+    /// Whether `widget` is the object this view refers to
+    public func refers(to widget: any QtWidget) -> Bool {
+        isValid && getBridgeWidget() == widget.getBridgeWidget()
+    }
+    
+    public var width: Int {
+        Int(getBridgeWidget().pointee.width())
+    }
+    
+    public var height: Int {
+        Int(getBridgeWidget().pointee.height())
+    }
+    
+    // MARK: - QtWidget Protocol Implementation
+    
+    public func show() {
+        getBridgeWidget().pointee.show()
+    }
+    
+    public func hide() {
+        getBridgeWidget().pointee.hide()
+    }
+    
+    public func setEnabled(_ enabled: Bool) {
+        getBridgeWidget().pointee.setEnabled(enabled)
+    }
+    
+    public var isVisible: Bool {
+        getBridgeWidget().pointee.isVisible()
+    }
+    
+    public func resize(width: Int, height: Int) {
+        getBridgeWidget().pointee.resize(Int32(width), Int32(height))
+    }
+    
+    public func move(x: Int, y: Int) {
+        getBridgeWidget().pointee.move(Int32(x), Int32(y))
+    }
+    
+    public func setGeometry(x: Int, y: Int, width: Int, height: Int) {
+        getBridgeWidget().pointee.setGeometry(Int32(x), Int32(y), Int32(width), Int32(height))
+    }
+    
+    public func setWindowTitle(_ title: String) {
+        getBridgeWidget().pointee.setWindowTitle(std.string(title))
+    }
+    
+    public var windowTitle: String {
+        String(getBridgeWidget().pointee.windowTitle())
+    }
+    
+    public func setObjectName(_ name: String) {
+        getBridgeWidget().pointee.setObjectName(std.string(name))
+    }
+    
+    public var objectName: String {
+        String(getBridgeWidget().pointee.objectName())
+    }
+    
+    public func setParent(_ parent: QtWidget?) {
+        if let parent = parent {
+            getBridgeWidget().pointee.setParent(parent.getBridgeWidget())
+        } else {
+            getBridgeWidget().pointee.setParent(nil)
+        }
+    }
+}
@@ -264,6 +264,61 @@ public enum QwiftUIAssert {
             assertionFailure(msg, file: file, line: line)
         }
     }
+    
+    /// Assert that a widget renders like a reference image
+    ///
+    /// - Parameters:
+    ///   - widget: The widget to render
+    ///   - expected: The reference image, rendered at scale 1
+    ///   - tolerance: The largest channel difference still counted as equal
+    ///   - message: Optional failure message
+    ///   - file: Source file (automatically captured)
+    ///   - line: Source line (automatically captured)
+    public static func assertRendersLike(
+        _ widget: any QtWidget,
+        _ expected: RenderedImage,
+        tolerance: Int = 0,
+        _ message: String = "",
+        file: StaticString = #file,
+        line: UInt = #line
+    ) {
+        guard let actual = widget.renderImage(),
+              let diff = ImageDiff.compare(expected, actual, tolerance: tolerance) else {
+            let msg = message.isEmpty
+                ? "Widget rendering size differs from the expected \(expected.width)x\(expected.height)"
+                : message
+            assertionFailure(msg, file: file, line: line)
+            return
+        }
+        if let bounds = diff.bounds {
+            let msg = message.isEmpty
+                ? "\(diff.differentPixels) pixels differ within (\(bounds.x), \(bounds.y)) \(bounds.width)x\(bounds.height)"
+                : message
+            assertionFailure(msg, file: file, line: line)
+        }
+    }
+    
+    /// Assert that no bridge object created since `mark` is still alive
+    ///
+    /// - Parameters:
+    ///   - mark: A value from ``LiveObjects/mark()`` taken before the work under test
+    ///   - message: Optional failure message
+    ///   - file: Source file (automatically captured)
+    ///   - line: Source line (automatically captured)
+    public static func assertNoLeaks(
+        since mark: UInt64,
+        _ message: String = "",
+        file: StaticString = #file,
+        line: UInt = #line
+    ) {
+        let leaked = LiveObjects.alive(since: mark)
+        if !leaked.isEmpty {
+            let msg = message.isEmpty
+                ? "\(leaked.count) objects are still alive:\n" + leaked.map { "\($0)" }.joined(separator: "\n")
+                : message
+            assertionFailure(msg, file: file, line: line)
+        }
+    }
 }
 
 // MARK: - Convenience Global Functions
@@ -301,4 +356,14 @@ public func assertText(_ widget: any QtWidget, equals expected: String, _ messag
 /// Assert widget text contains substring
 public func assertTextContains(_ widget: any QtWidget, _ substring: String, _ message: String = "", file: StaticString = #file, line: UInt = #line) {
     QwiftUIAssert.assertTextContains(widget, substring, message, file: file, line: line)
-}
\ No newline at end of file
+}
+
+/// Assert that a widget renders like a reference image
+public func assertRendersLike(_ widget: any QtWidget, _ expected: RenderedImage, tolerance: Int = 0, _ message: String = "", file: StaticString = #file, line: UInt = #line) {
+    QwiftUIAssert.assertRendersLike(widget, expected, tolerance: tolerance, message, file: file, line: line)
+}
+
+/// Assert that no bridge object created since `mark` is still alive
+public func assertNoLeaks(since mark: UInt64, _ message: String = "", file: StaticString = #file, line: UInt = #line) {
+    QwiftUIAssert.assertNoLeaks(since: mark, message, file: file, line: line)
+}
@@ -151,6 +151,21 @@ public class EventSimulator {
         )
     }
     
+    /// Send mouse moves straight to a widget, bypassing the window system
+    ///
+    /// Meant for measuring event delivery: the moves reach the widget's event filter
+    /// synchronously, sweeping it diagonally, with no delay between them.
+    ///
+    /// - Parameters:
+    ///   - count: The number of moves to send
+    ///   - widget: The widget to send them to
+    /// - Returns: The number of moves sent
+    @discardableResult
+    public func sendMouseMoves(_ count: Int, to widget: any QtWidget) -> Int {
+        var bridgeWidget = widget.getBridgeWidget().pointee
+        return Int(simulator.sendMouseMoves(&bridgeWidget, Int32(count)))
+    }
+    
     /// Press the mouse button down
     ///
     /// - Parameters:
@@ -220,6 +235,43 @@ public class EventSimulator {
         }
     }
     
+    /// How ``typeTextBulk(_:into:mode:verify:)`` delivers text
+    public enum BulkTextMode: Int32 {
+        /// One input method commit carrying the whole text; the fastest way to fill a field
+        case commit = 0
+        /// A key press and release per character, so key handlers and validators see each one
+        case keystrokes = 1
+    }
+    
+    /// Type a large amount of text into a widget at once
+    ///
+    /// Unlike ``typeText(_:into:modifiers:delay:)``, events are processed once after the
+    /// whole text has been delivered rather than after every character, and any
+    /// characters can be used. Suited to filling forms with long or fuzzed input.
+    ///
+    /// - Parameters:
+    ///   - text: The text to type
+    ///   - widget: The widget to type into; it receives focus first
+    ///   - mode: Whether to commit the text in one event or as individual keystrokes
+    ///   - verify: Whether to check that the text of the widget that took the input (the
+    ///     widget's focus proxy for composites such as spin boxes) equals `text` afterwards
+    /// - Returns: The number of characters delivered, or nil if verification failed
+    @discardableResult
+    public func typeTextBulk(
+        _ text: String,
+        into widget: any QtWidget,
+        mode: BulkTextMode = .commit,
+        verify: Bool = false
+    ) -> Int? {
+        var text = text
+        let delivered = text.withUTF8 { bytes in
+            bytes.withMemoryRebound(to: CChar.self) { chars in
+                Int(simulator.typeTextBulk(widget.getBridgeWidget(), chars.baseAddress, chars.count, mode.rawValue, verify))
+            }
+        }
+        return delivered < 0 ? nil : delivered
+    }
+    
     /// Simulate a keyboard shortcut
     ///
     /// - Parameters:
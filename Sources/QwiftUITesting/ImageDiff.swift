@@ -0,0 +1,84 @@
+// ABOUTME: Pixel comparison of rendered widgets for visual regression tests
+// ABOUTME: Wraps the vectorized SwiftQTestImageDiff comparator with tolerance and anti-aliasing masking
+
+import Foundation
+import QwiftUI
+import QtBridge
+
+/// The outcome of comparing two images.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let golden = loadGolden("toolbar")
+/// guard let actual = toolbar.renderImage(),
+///       let diff = ImageDiff.compare(golden, actual, tolerance: 2) else { return }
+/// if !diff.matches {
+///     print("\(diff.differentPixels) pixels differ in \(diff.bounds!)")
+/// }
+/// ```
+public struct ImageDiff: Sendable {
+    /// Pixels differing by more than the tolerance that are not anti-aliasing
+    public let differentPixels: Int
+    /// Pixels differing by more than the tolerance that were excused as anti-aliased edges
+    public let antiAliasedPixels: Int
+    /// The largest difference of any channel anywhere in the image, 0 to 255
+    public let maxDelta: Int
+    /// The smallest rectangle containing every differing pixel, nil when none differ
+    public let bounds: (x: Int, y: Int, width: Int, height: Int)?
+    /// Red where pixels differ, yellow where they were excused as anti-aliasing and
+    /// transparent elsewhere; only produced when requested
+    public let heatmap: RenderedImage?
+    
+    /// Whether no pixel differs
+    public var matches: Bool {
+        differentPixels == 0
+    }
+    
+    /// Compares two images of the same size.
+    ///
+    /// - Parameters:
+    ///   - expected: The reference image
+    ///   - actual: The image under test
+    ///   - tolerance: The largest channel difference still counted as equal
+    ///   - ignoreAntiAliasing: Whether differences on edges that look like anti-aliasing are excused
+    ///   - heatmap: Whether to produce ``heatmap``
+    /// - Returns: nil if the sizes differ
+    public static func compare(
+        _ expected: RenderedImage,
+        _ actual: RenderedImage,
+        tolerance: Int = 0,
+        ignoreAntiAliasing: Bool = true,
+        heatmap: Bool = false
+    ) -> ImageDiff? {
+        guard expected.width == actual.width, expected.height == actual.height else { return nil }
+        let width = expected.width
+        let height = expected.height
+        var result = QtImageDiffResult()
+        var heatPixels: [UInt32] = heatmap ? Array(repeating: 0, count: width * height) : []
+        
+        expected.pixels.withUnsafeBufferPointer { before in
+            actual.pixels.withUnsafeBufferPointer { after in
+                heatPixels.withUnsafeMutableBufferPointer { heat in
+                    _ = SwiftQTestImageDiff.compare(
+                        before.baseAddress, Int32(width),
+                        after.baseAddress, Int32(width),
+                        Int32(width), Int32(height), Int32(tolerance), ignoreAntiAliasing,
+                        heatmap ? heat.baseAddress : nil, Int32(width), &result
+                    )
+                }
+            }
+        }
+        
+        let bounds: (x: Int, y: Int, width: Int, height: Int)? = result.differentPixels > 0
+            ? (Int(result.left), Int(result.top), Int(result.right - result.left), Int(result.bottom - result.top))
+            : nil
+        return ImageDiff(
+            differentPixels: Int(result.differentPixels),
+            antiAliasedPixels: Int(result.antiAliasedPixels),
+            maxDelta: Int(result.maxDelta),
+            bounds: bounds,
+            heatmap: heatmap ? RenderedImage(width: width, height: height, pixels: heatPixels) : nil
+        )
+    }
+}
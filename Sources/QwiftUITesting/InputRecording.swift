@@ -0,0 +1,133 @@
+// ABOUTME: Records real input sessions and replays them with time compression
+// ABOUTME: Replays report how long each injected event took to reach a paint
+
+import Foundation
+import QwiftUI
+import QtBridge
+
+/// How fast ``InputRecording/replay(into:speed:)`` feeds events
+public enum ReplaySpeed {
+    /// With the recorded timing
+    case recorded
+    /// The given number of times faster than recorded (e.g. 10 or 100)
+    case compressed(Double)
+    /// Each event as soon as the event loop has processed the previous one
+    case asFastAsPossible
+    
+    var factor: Double {
+        switch self {
+        case .recorded: return 1
+        case .compressed(let factor): return max(factor, 1e-3)
+        case .asFastAsPossible: return 0
+        }
+    }
+}
+
+/// A log of input events that can be recorded from a live window and replayed.
+///
+/// Recording captures the mouse, wheel and key events the window system delivers to a
+/// widget's window, with microsecond timestamps, in a compact binary log that can be
+/// saved next to a test. Replaying feeds them back as window system events, optionally
+/// compressed in time, so a long manual session becomes a fast regression test. Event
+/// timestamps keep their recorded gaps, so double clicks replay as double clicks. Each
+/// replayed event is timed until the window next paints.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// let session = InputRecording()
+/// session.startRecording(window)
+/// // ... interact with the window ...
+/// session.stopRecording()
+/// session.save(path: "Fixtures/edit-session.qwin")
+///
+/// let replay = InputRecording()
+/// replay.load(path: "Fixtures/edit-session.qwin")
+/// replay.replay(into: window, speed: .compressed(50))
+/// print(replay.latencies.compactMap { $0 }.max() ?? 0)
+/// ```
+public final class InputRecording {
+    private var log = SwiftQTestInputLog()
+    
+    public init() {}
+    
+    /// Starts recording input for the window containing `root`, discarding the current log.
+    @discardableResult
+    public func startRecording(_ root: any QtWidget) -> Bool {
+        log.startRecording(root.getBridgeWidget())
+    }
+    
+    /// Stops recording; the events recorded so far are kept.
+    public func stopRecording() {
+        log.stopRecording()
+    }
+    
+    /// Whether input is being recorded
+    public var isRecording: Bool {
+        log.isRecording()
+    }
+    
+    /// The number of events in the log
+    public var eventCount: Int {
+        Int(log.eventCount())
+    }
+    
+    /// The event at `index`
+    public func event(at index: Int) -> QtInputRecord {
+        log.eventAt(Int32(index))
+    }
+    
+    /// Adds an event to the log, for building sessions in code
+    public func append(_ record: QtInputRecord) {
+        log.append(record)
+    }
+    
+    /// Removes every event.
+    public func removeAll() {
+        log.clear()
+    }
+    
+    /// The encoded log
+    public var bytes: [UInt8] {
+        let count = log.byteCount()
+        guard let start = log.bytes() else { return [] }
+        return Array(UnsafeBufferPointer(start: start, count: count))
+    }
+    
+    /// Replaces the log with one taken from ``bytes``.
+    @discardableResult
+    public func load(bytes: [UInt8]) -> Bool {
+        bytes.withUnsafeBufferPointer { buffer in
+            log.loadBytes(buffer.baseAddress, buffer.count)
+        }
+    }
+    
+    /// Writes the encoded log to `path`.
+    @discardableResult
+    public func save(path: String) -> Bool {
+        log.save(std.string(path))
+    }
+    
+    /// Replaces the log with the one saved at `path`.
+    @discardableResult
+    public func load(path: String) -> Bool {
+        log.load(std.string(path))
+    }
+    
+    /// Feeds the log into the window containing `root`.
+    ///
+    /// - Returns: The number of events injected
+    @discardableResult
+    public func replay(into root: any QtWidget, speed: ReplaySpeed = .asFastAsPossible) -> Int {
+        Int(log.replay(root.getBridgeWidget(), speed.factor))
+    }
+    
+    /// For each event of the last replay, the milliseconds from injecting it to the next paint
+    /// of the window, or nil if the window did not paint before the following event
+    public var latencies: [Double?] {
+        (0..<Int(log.latencyCount())).map { index in
+            let micros = log.latencyAt(Int32(index))
+            return micros < 0 ? nil : Double(micros) / 1000
+        }
+    }
+}
@@ -0,0 +1,108 @@
+// ABOUTME: Live-object accounting for bridge wrappers and the Qt widgets the bridge creates
+// ABOUTME: Lists what a test left alive, with creation backtraces, so leaks fail tests instead of growing kiosks
+
+import Foundation
+import QwiftUI
+import QtBridge
+
+/// A bridge object that is still alive
+public struct LiveObject: CustomStringConvertible {
+    public enum Kind {
+        /// A C++ wrapper (`SwiftQWidget` or a subclass)
+        case wrapper
+        /// A Qt widget created by the bridge
+        case widget
+    }
+    
+    public let kind: Kind
+    /// The C++ class, e.g. "SwiftQLabel" or "QLabel"
+    public let typeName: String
+    /// The widget's object name, empty if unset
+    public let objectName: String
+    /// Creation order; objects created later have larger serials
+    public let serial: UInt64
+    /// The stack the object was created from, innermost first; empty unless
+    /// ``LiveObjects/captureBacktraces`` was on at creation
+    public let backtrace: [String]
+    
+    public var description: String {
+        var text = "#\(serial) \(typeName)"
+        if !objectName.isEmpty {
+            text += " \"\(objectName)\""
+        }
+        if kind == .widget {
+            text += " (widget)"
+        }
+        for frame in backtrace {
+            text += "\n    \(frame)"
+        }
+        return text
+    }
+}
+
+/// Counts of the bridge objects alive at any moment.
+///
+/// Every C++ wrapper and every Qt widget the bridge creates is counted from creation to
+/// destruction. Taking a ``mark()`` before a piece of work and calling
+/// ``alive(since:)`` afterwards lists exactly what that work left behind. Turning on
+/// ``captureBacktraces`` records where each object was created, at the cost of a stack
+/// walk per object.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// LiveObjects.captureBacktraces = true
+/// let mark = LiveObjects.mark()
+/// showAndCloseSettings()
+/// for leak in LiveObjects.alive(since: mark) {
+///     print(leak)
+/// }
+/// ```
+public enum LiveObjects {
+    /// Whether objects created from now on record their creation backtrace
+    public static var captureBacktraces: Bool {
+        get { SwiftLiveObjects.capturesBacktraces() }
+        set { SwiftLiveObjects.setCaptureBacktraces(newValue) }
+    }
+    
+    /// A point in time to compare against; objects created afterwards have a serial at least this large
+    public static func mark() -> UInt64 {
+        UInt64(SwiftLiveObjects.mark())
+    }
+    
+    /// The number of wrappers or bridge-created widgets alive
+    public static func count(_ kind: LiveObject.Kind) -> Int {
+        Int(SwiftLiveObjects.liveCount(kind == .wrapper ? 0 : 1))
+    }
+    
+    /// The number of live objects of the given C++ class, e.g. "SwiftQLabel" or "QLabel"
+    public static func count(ofType typeName: String) -> Int {
+        Int(SwiftLiveObjects.liveCountOfType(std.string(typeName)))
+    }
+    
+    /// The objects created since `mark` that are still alive, oldest first.
+    ///
+    /// Pending `deleteLater()` deletions are carried out first, so widgets already on their
+    /// way out are not reported.
+    public static func alive(since mark: UInt64) -> [LiveObject] {
+        SwiftLiveObjects.releaseDeferred()
+        let count = Int(SwiftLiveObjects.collect(CUnsignedLongLong(mark)))
+        return (0..<count).map { index in
+            let position = Int32(index)
+            let backtrace = String(SwiftLiveObjects.collectedBacktrace(position))
+            return LiveObject(
+                kind: SwiftLiveObjects.collectedKind(position) == 0 ? .wrapper : .widget,
+                typeName: String(SwiftLiveObjects.collectedType(position)),
+                objectName: String(SwiftLiveObjects.collectedObjectName(position)),
+                serial: UInt64(SwiftLiveObjects.collectedSerial(position)),
+                backtrace: backtrace.split(separator: "\n").map(String.init)
+            )
+        }
+    }
+    
+    /// The resident memory of the process in bytes, nil where it cannot be read
+    public static var residentBytes: Int? {
+        let bytes = SwiftLiveObjects.residentBytes()
+        return bytes < 0 ? nil : Int(bytes)
+    }
+}
@@ -0,0 +1,249 @@
+// ABOUTME: Measures frame times, input-to-paint latency and callback durations while a test runs
+// ABOUTME: Reports percentiles, checks budgets like "p95 frame time below 16 ms" and writes JSON for trend tracking
+
+import Foundation
+import QwiftUI
+import QtBridge
+
+/// A quantity measured by a ``PerformanceScope``
+public enum PerformanceMetric: String, Codable, CaseIterable, Sendable {
+    /// Time the window spent in each repaint pass
+    case frameTime
+    /// From any input event reaching the window to the end of the next repaint
+    case inputLatency
+    /// From a mouse press or release reaching the window to the end of the next repaint
+    case clickLatency
+    /// From a key press or release reaching the window to the end of the next repaint
+    case keyLatency
+    /// Time spent in each Swift handler called from Qt
+    case callbackDuration
+}
+
+/// Summary statistics of one metric, in milliseconds
+public struct PerformanceSummary: Codable, Sendable {
+    public let count: Int
+    public let mean: Double
+    public let p50: Double
+    public let p95: Double
+    public let p99: Double
+    public let max: Double
+}
+
+/// A budget checked against a ``PerformanceReport``
+public struct PerformanceCheck: Codable, Sendable {
+    public let metric: PerformanceMetric
+    public let percentile: Double
+    /// The budget in milliseconds
+    public let limit: Double
+    /// The measured value in milliseconds, nil when there were no samples
+    public let value: Double?
+    public let passed: Bool
+    
+    /// A one-line description, e.g. "p95 frameTime 12.40 ms < 16.00 ms"
+    public var description: String {
+        let measured = value.map { String(format: "%.2f ms", $0) } ?? "no samples"
+        let percentileText = percentile.rounded() == percentile ? String(Int(percentile)) : String(percentile)
+        return "p\(percentileText) \(metric.rawValue) \(measured) \(passed ? "<" : "≥") \(String(format: "%.2f ms", limit))"
+    }
+}
+
+/// The measurements of one ``PerformanceScope`` run. All times are in milliseconds.
+public struct PerformanceReport: Sendable {
+    /// The name given to the scope
+    public let name: String
+    /// Time from start to stop
+    public let duration: Double
+    /// Duration of each repaint pass of the window
+    public let frameTimes: [Double]
+    /// Input events that reached the window, with the `QEvent::Type` of each and the time
+    /// to the end of the next repaint, nil if none followed before stop
+    public let inputs: [(type: Int, latency: Double?)]
+    /// Duration of each Swift handler called from Qt
+    public let callbackDurations: [Double]
+    /// The checks made with ``expect(_:percentile:below:)``, in order
+    public private(set) var checks: [PerformanceCheck] = []
+    
+    /// Whether every check passed
+    public var passed: Bool {
+        checks.allSatisfy { $0.passed }
+    }
+    
+    /// The samples of `metric`
+    public func samples(_ metric: PerformanceMetric) -> [Double] {
+        switch metric {
+        case .frameTime:
+            return frameTimes
+        case .inputLatency:
+            return inputs.compactMap { $0.latency }
+        case .clickLatency:
+            // QEvent::MouseButtonPress, MouseButtonRelease
+            return inputs.filter { $0.type == 2 || $0.type == 3 }.compactMap { $0.latency }
+        case .keyLatency:
+            // QEvent::KeyPress, KeyRelease
+            return inputs.filter { $0.type == 6 || $0.type == 7 }.compactMap { $0.latency }
+        case .callbackDuration:
+            return callbackDurations
+        }
+    }
+    
+    /// The given percentile (0-100) of `metric` by the nearest-rank method, nil without samples
+    public func percentile(_ percentile: Double, of metric: PerformanceMetric) -> Double? {
+        Self.percentile(percentile, ofSorted: samples(metric).sorted())
+    }
+    
+    /// Statistics of `metric`, nil without samples
+    public func summary(_ metric: PerformanceMetric) -> PerformanceSummary? {
+        let sorted = samples(metric).sorted()
+        guard let last = sorted.last else { return nil }
+        return PerformanceSummary(
+            count: sorted.count,
+            mean: sorted.reduce(0, +) / Double(sorted.count),
+            p50: Self.percentile(50, ofSorted: sorted) ?? 0,
+            p95: Self.percentile(95, ofSorted: sorted) ?? 0,
+            p99: Self.percentile(99, ofSorted: sorted) ?? 0,
+            max: last
+        )
+    }
+    
+    /// Checks that the given percentile of `metric` stays below `limit` milliseconds and
+    /// records the outcome in ``checks``. A metric without samples passes, since nothing
+    /// exceeded the budget.
+    ///
+    /// - Returns: Whether the check passed
+    @discardableResult
+    public mutating func expect(_ metric: PerformanceMetric, percentile: Double = 95, below limit: Double) -> Bool {
+        let value = self.percentile(percentile, of: metric)
+        let passed = value.map { $0 < limit } ?? true
+        checks.append(PerformanceCheck(metric: metric, percentile: percentile, limit: limit, value: value, passed: passed))
+        return passed
+    }
+    
+    /// The summaries and checks as JSON
+    public func json() -> String {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        guard let data = try? encoder.encode(Encoded(self)) else { return "{}" }
+        return String(decoding: data, as: UTF8.self)
+    }
+    
+    /// One line per metric with samples, for test logs
+    public var summaryLines: [String] {
+        PerformanceMetric.allCases.compactMap { metric in
+            guard let summary = summary(metric) else { return nil }
+            return String(format: "%@: n=%d p50=%.2f p95=%.2f max=%.2f ms",
+                          metric.rawValue, summary.count, summary.p50, summary.p95, summary.max)
+        }
+    }
+    
+    internal struct Encoded: Codable {
+        let name: String
+        let duration: Double
+        let metrics: [String: PerformanceSummary]
+        let checks: [PerformanceCheck]
+        
+        init(_ report: PerformanceReport) {
+            name = report.name
+            duration = report.duration
+            var metrics: [String: PerformanceSummary] = [:]
+            for metric in PerformanceMetric.allCases {
+                metrics[metric.rawValue] = report.summary(metric)
+            }
+            self.metrics = metrics
+            checks = report.checks
+        }
+    }
+    
+    private static func percentile(_ percentile: Double, ofSorted sorted: [Double]) -> Double? {
+        guard !sorted.isEmpty else { return nil }
+        let rank = Int((min(max(percentile, 0), 100) / 100 * Double(sorted.count)).rounded(.up))
+        return sorted[min(max(rank - 1, 0), sorted.count - 1)]
+    }
+}
+
+/// Collects performance measurements of a window while a test drives it.
+///
+/// Between ``start()`` and ``stop()`` the scope times every repaint pass of the window
+/// containing the root widget, notes when each input event reaches that window (as
+/// events injected by ``EventSimulator`` do) and how long until the next repaint
+/// finished, and times every Swift handler Qt calls. The resulting report gives
+/// percentiles and checks budgets; ``TestRunner/attach(_:)`` adds it to the current
+/// test's result.
+///
+/// ## Example Usage
+///
+/// ```swift
+/// var report = PerformanceScope.measure("open editor", on: window) {
+///     simulator.click(openButton)
+///     simulator.processEvents(100)
+/// }
+/// report.expect(.frameTime, percentile: 95, below: 16)
+/// report.expect(.clickLatency, percentile: 95, below: 30)
+/// TestRunner.shared.attach(report)
+/// ```
+public final class PerformanceScope {
+    /// The name reports are given
+    public let name: String
+    private let root: any QtWidget
+    private var scope = SwiftQTestPerfScope()
+    private var callbackDurations: [Double] = []
+    private var callbackObserver: CallbackTiming.Token?
+    
+    /// Creates a scope measuring the window that contains `root`
+    public init(name: String, root: any QtWidget) {
+        self.name = name
+        self.root = root
+    }
+    
+    /// Whether measurements are being collected
+    public var isActive: Bool {
+        scope.isActive()
+    }
+    
+    /// Starts measuring, discarding earlier measurements.
+    @discardableResult
+    public func start() -> Bool {
+        callbackDurations.removeAll()
+        guard scope.start(root.getBridgeWidget()) else { return false }
+        if let callbackObserver {
+            CallbackTiming.removeObserver(callbackObserver)
+        }
+        callbackObserver = CallbackTiming.addObserver { [weak self] duration in
+            self?.callbackDurations.append(duration)
+        }
+        return true
+    }
+    
+    /// Stops measuring and returns what was collected.
+    public func stop() -> PerformanceReport {
+        if scope.isActive() {
+            scope.stop()
+        }
+        if let callbackObserver {
+            CallbackTiming.removeObserver(callbackObserver)
+            self.callbackObserver = nil
+        }
+        return PerformanceReport(
+            name: name,
+            duration: Double(scope.elapsed()) / 1000,
+            frameTimes: (0..<Int(scope.frameCount())).map { Double(scope.frameTimeAt(Int32($0))) / 1000 },
+            inputs: (0..<Int(scope.inputCount())).map { index in
+                let micros = scope.inputLatencyAt(Int32(index))
+                return (type: Int(scope.inputTypeAt(Int32(index))), latency: micros < 0 ? nil : Double(micros) / 1000)
+            },
+            callbackDurations: callbackDurations
+        )
+    }
+    
+    /// Measures the window containing `root` while `body` runs.
+    public static func measure(_ name: String, on root: any QtWidget, _ body: () throws -> Void) rethrows -> PerformanceReport {
+        let scope = PerformanceScope(name: name, root: root)
+        scope.start()
+        do {
+            try body()
+        } catch {
+            _ = scope.stop()
+            throw error
+        }
+        return scope.stop()
+    }
+}
@@ -9,7 +9,9 @@ import QtBridge
 ///
 /// Inherit from this class to create UI tests for QwiftUI applications.
 /// The class automatically manages the Qt application lifecycle and provides
-/// access to testing utilities.
+/// access to testing utilities. After each test, tearDown fails it if bridge
+/// wrappers or widgets created during the test are still alive (see ``LiveObjects``);
+/// set ``checksForLeaks`` to false for tests that keep objects on purpose.
 ///
 /// Example:
 /// ```swift
@@ -36,6 +38,18 @@ open class QwiftUITestCase {
     /// The event simulator for user interactions
     public private(set) var simulator: EventSimulator!
     
+    /// Whether tearDown fails the test when bridge objects created during it are still alive
+    public var checksForLeaks = true
+    
+    /// Whether objects created during the test record where they were created, so leak
+    /// reports include backtraces
+    public var capturesCreationBacktraces = false
+    
+    /// The objects the last test left alive, as found by tearDown
+    public private(set) var leakedObjects: [LiveObject] = []
+    
+    private var liveObjectsMark: UInt64 = 0
+    
     /// Initialize a new test case
     public init() {
         // Will be set up in setUp()
@@ -54,6 +68,10 @@ open class QwiftUITestCase {
         if let test = createQTest() {
             test.pointee.initialize()
         }
+        
+        // Objects created from here on belong to the test
+        LiveObjects.captureBacktraces = capturesCreationBacktraces
+        liveObjectsMark = LiveObjects.mark()
     }
     
     /// Clean up after each test
@@ -70,6 +88,13 @@ open class QwiftUITestCase {
         if let test = createQTest() {
             test.pointee.cleanup()
         }
+        
+        leakedObjects = LiveObjects.alive(since: liveObjectsMark)
+        LiveObjects.captureBacktraces = false
+        if checksForLeaks && !leakedObjects.isEmpty {
+            let report = leakedObjects.map { "\($0)" }.joined(separator: "\n")
+            assertionFailure("\(leakedObjects.count) objects created by the test are still alive:\n\(report)")
+        }
     }
     
     /// Wait for a condition to become true
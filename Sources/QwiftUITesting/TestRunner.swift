@@ -11,6 +11,8 @@ public struct TestResult {
     public let passed: Bool
     public let message: String?
     public let duration: TimeInterval
+    /// Performance reports attached while the test ran
+    public var performance: [PerformanceReport] = []
 }
 
 /// Simple test runner for automated QwiftUI tests
@@ -19,6 +21,7 @@ public class TestRunner {
     private var currentTestName: String = ""
     private var currentTestStartTime: Date = Date()
     private var failureMessages: [String] = []
+    private var currentPerformance: [PerformanceReport] = []
     
     /// Singleton instance for global access
     public static let shared = TestRunner()
@@ -30,6 +33,7 @@ public class TestRunner {
         currentTestName = name
         currentTestStartTime = Date()
         failureMessages.removeAll()
+        currentPerformance.removeAll()
         print("\n▶️ Running test: \(name)")
     }
     
@@ -65,6 +69,16 @@ public class TestRunner {
         }
     }
     
+    /// Add a performance report to the current test; its failed checks fail the test
+    public func attach(_ report: PerformanceReport) {
+        currentPerformance.append(report)
+        for check in report.checks where !check.passed {
+            let failureMessage = "\(report.name): \(check.description)"
+            failureMessages.append(failureMessage)
+            print("   ❌ \(failureMessage)")
+        }
+    }
+    
     /// End the current test
     public func endTest() {
         let duration = Date().timeIntervalSince(currentTestStartTime)
@@ -74,11 +88,19 @@ public class TestRunner {
             name: currentTestName,
             passed: passed,
             message: failureMessages.isEmpty ? nil : failureMessages.joined(separator: "\n"),
-            duration: duration
+            duration: duration,
+            performance: currentPerformance
         )
         
         results.append(result)
         
+        for report in currentPerformance {
+            print(String(format: "   ⏱ %@ (%.1f ms)", report.name, report.duration))
+            for line in report.summaryLines {
+                print("      \(line)")
+            }
+        }
+        
         if passed {
             print(String(format: "   ✅ Test passed (%.3f seconds)", duration))
         } else {
@@ -138,6 +160,36 @@ public class TestRunner {
         return results.allSatisfy { $0.passed }
     }
     
+    /// The performance reports of every test as JSON, for trend tracking across runs
+    public func performanceJSON() -> String {
+        struct Entry: Codable {
+            let test: String
+            let passed: Bool
+            let duration: TimeInterval
+            let reports: [PerformanceReport.Encoded]
+        }
+        let entries = results.filter { !$0.performance.isEmpty }.map { result in
+            Entry(test: result.name, passed: result.passed, duration: result.duration,
+                  reports: result.performance.map { PerformanceReport.Encoded($0) })
+        }
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        guard let data = try? encoder.encode(entries) else { return "[]" }
+        return String(decoding: data, as: UTF8.self)
+    }
+    
+    /// Write ``performanceJSON()`` to `path`
+    @discardableResult
+    public func writePerformanceJSON(to path: String) -> Bool {
+        do {
+            try performanceJSON().write(toFile: path, atomically: true, encoding: .utf8)
+            return true
+        } catch {
+            print("   ⚠️ Could not write performance results to \(path): \(error)")
+            return false
+        }
+    }
+    
     /// Print test summary without exiting
     public func printSummary() {
         let passedCount = results.filter { $0.passed }.count
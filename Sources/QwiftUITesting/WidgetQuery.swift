@@ -9,12 +9,15 @@ import QtBridge
 ///
 /// Use WidgetQuery to find widgets in your application during tests.
 /// Supports finding by object name, type, and custom predicates.
+/// Results are read-only ``WidgetView``s: they can be inspected and passed to the
+/// event simulator, but event handlers stay with the objects that created the widgets.
 ///
 /// Example:
 /// ```swift
 /// let query = WidgetQuery()
-/// let button = query.widget(named: "submitButton") as? Button
-/// let labels = query.widgets(ofType: Label.self)
+/// if let button = query.widget(named: "submitButton") {
+///     EventSimulator().click(button)
+/// }
 /// ```
 public class WidgetQuery {
     
@@ -43,8 +46,8 @@ public class WidgetQuery {
     public func setRoot(_ root: Widget?) {
         self.rootWidget = root
         if let root = root {
-            var bridgeWidget = root.getBridgeWidget().pointee
-            finder.setRoot(&bridgeWidget)
+            // The finder keeps the pointer, so pass the widget's own bridge object, not a copy
+            finder.setRoot(root.getBridgeWidget())
         } else {
             // Can't pass nil directly to C++ method
             // Create a finder without root instead
@@ -56,10 +59,10 @@ public class WidgetQuery {
     ///
     /// - Parameter name: The object name to search for
     /// - Returns: The first widget with the given name, or nil if not found
-    public func widget(named name: String) -> Widget? {
+    public func widget(named name: String) -> WidgetView? {
         let stdString = std.string(name)
         if let foundPtr = finder.findByObjectName(stdString) {
-            return Widget(fromBridge: foundPtr, ownsPointer: false)
+            return WidgetView(foundPtr)
         }
         return nil
     }
@@ -68,14 +71,16 @@ public class WidgetQuery {
     ///
     /// - Parameter name: The object name to search for
     /// - Returns: An array of widgets with the given name
-    public func widgets(named name: String) -> [Widget] {
+    public func widgets(named name: String) -> [WidgetView] {
         let stdString = std.string(name)
         let count = finder.countByObjectName(stdString)
-        var results: [Widget] = []
+        var results: [WidgetView] = []
         
         for i in 0..<count {
             if let widgetPtr = finder.getByObjectNameAt(stdString, Int32(i)) {
-                results.append(Widget(fromBridge: widgetPtr, ownsPointer: false))
+                if let view = WidgetView(widgetPtr) {
+                    results.append(view)
+                }
             }
         }
         
@@ -86,14 +91,16 @@ public class WidgetQuery {
     ///
     /// - Parameter className: The Qt class name (e.g., "QPushButton", "QLabel")
     /// - Returns: An array of widgets of the given class
-    public func widgets(byClassName className: String) -> [Widget] {
+    public func widgets(byClassName className: String) -> [WidgetView] {
         let stdString = std.string(className)
         let count = finder.countByClassName(stdString)
-        var results: [Widget] = []
+        var results: [WidgetView] = []
         
         for i in 0..<count {
             if let widgetPtr = finder.getByClassNameAt(stdString, Int32(i)) {
-                results.append(Widget(fromBridge: widgetPtr, ownsPointer: false))
+                if let view = WidgetView(widgetPtr) {
+                    results.append(view)
+                }
             }
         }
         
@@ -104,14 +111,16 @@ public class WidgetQuery {
     ///
     /// - Parameter parent: The parent widget
     /// - Returns: An array of child widgets
-    public func children(of parent: Widget) -> [Widget] {
-        var parentWidget = parent.getBridgeWidget().pointee
-        let count = finder.countChildren(&parentWidget)
-        var results: [Widget] = []
+    public func children(of parent: Widget) -> [WidgetView] {
+        let parentWidget = parent.getBridgeWidget()
+        let count = finder.countChildren(parentWidget)
+        var results: [WidgetView] = []
         
         for i in 0..<count {
-            if let widgetPtr = finder.getChildAt(&parentWidget, Int32(i)) {
-                results.append(Widget(fromBridge: widgetPtr, ownsPointer: false))
+            if let widgetPtr = finder.getChildAt(parentWidget, Int32(i)) {
+                if let view = WidgetView(widgetPtr) {
+                    results.append(view)
+                }
             }
         }
         
@@ -124,11 +133,11 @@ public class WidgetQuery {
     ///   - name: The object name to wait for
     ///   - timeout: Maximum time to wait in seconds
     /// - Returns: The widget if found within timeout, nil otherwise
-    public func waitForWidget(named name: String, timeout: TimeInterval = 5.0) -> Widget? {
+    public func waitForWidget(named name: String, timeout: TimeInterval = 5.0) -> WidgetView? {
         let timeoutMs = Int32(timeout * 1000)
         let stdString = std.string(name)
         if let foundPtr = finder.waitForWidget(stdString, timeoutMs) {
-            return Widget(fromBridge: foundPtr, ownsPointer: false)
+            return WidgetView(foundPtr)
         }
         return nil
     }
@@ -140,7 +149,7 @@ public class WidgetQuery {
     ///
     /// - Parameter predicate: A closure that returns true for widgets to include
     /// - Returns: An array of widgets matching the predicate
-    public func widgets(matching predicate: (Widget) -> Bool) -> [Widget] {
+    public func widgets(matching predicate: (WidgetView) -> Bool) -> [WidgetView] {
         // Get all widgets by searching for QWidget base class
         let allWidgets = widgets(byClassName: "QWidget")
         return allWidgets.filter(predicate)
@@ -0,0 +1,75 @@
+// ABOUTME: Tests for ComboBox bulk items, filtering and keyboard activation of filtered completions
+// ABOUTME: Also checks that a wrapper outliving its combo box releases the shared model safely
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("ComboBox Tests")
+struct ComboBoxTests {
+    
+    @Test("ComboBox bulk population and indexed filtering")
+    func testComboBoxBulkItems() {
+        let combo = ComboBox(items: ["Banana", "apple", "Apricot", "cherry"])
+        #expect(combo.items == ["Banana", "apple", "Apricot", "cherry"])
+        
+        // Prefix matches are case-insensitive and sorted
+        #expect(combo.findItems(matching: "ap") == [1, 2])
+        
+        combo.filterMode = .substring
+        #expect(combo.findItems(matching: "an") == [0])
+        #expect(combo.findItems(matching: "ERR") == [3])
+        #expect(combo.findItems(matching: "xyz").isEmpty)
+        
+        // Mutations invalidate the search index
+        combo.addItems(["Blackberry"])
+        #expect(combo.findItems(matching: "rry") == [3, 4])
+        
+        combo.setItems(["one", "two"])
+        #expect(combo.items == ["one", "two"])
+        #expect(combo.findItems(matching: "rry").isEmpty)
+    }
+    
+    @Test("A combo box wrapper outliving its deleted combo box releases its model safely")
+    func testComboBoxOutlivesWidget() {
+        _ = Application()
+        let wrappers = LiveObjects.count(ofType: "SwiftQComboBox")
+        var window: Widget? = Widget()
+        var combo: ComboBox? = ComboBox(items: ["one", "two"], parent: window)
+        combo?.show()
+        #expect(combo?.items.count == 2)
+        
+        // Qt deletes the combo box with its parent while the wrapper is still alive;
+        // releasing the wrapper afterwards must not touch the deleted combo box
+        window = nil
+        combo = nil
+        #expect(LiveObjects.count(ofType: "SwiftQComboBox") == wrappers)
+    }
+    
+    @Test("Picking a filtered completion with the keyboard activates the source item")
+    func testComboBoxFilterActivation() {
+        let app = Application()
+        let combo = ComboBox(items: ["Banana", "apple", "Apricot", "cherry"])
+        combo.isEditable = true
+        combo.filterMode = .prefix
+        var activated: [Int] = []
+        combo.onActivated { index in
+            activated.append(index)
+        }
+        combo.show()
+        app.processEvents()
+        
+        // Typing opens the filtered popup; Down selects its only row and Return picks it
+        let simulator = EventSimulator()
+        simulator.typeText("apr", into: combo)
+        simulator.processEvents(50)
+        simulator.keyPress(.down, widget: combo)
+        simulator.keyPress(.return, widget: combo)
+        simulator.processEvents(50)
+        #expect(activated == [2])
+        #expect(combo.currentIndex == 2)
+        #expect(combo.currentText == "Apricot")
+        combo.hide()
+    }
+}
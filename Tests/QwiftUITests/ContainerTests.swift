@@ -0,0 +1,151 @@
+// ABOUTME: Tests for Container: stack layout flex factors, keyed setChildren and lazy sections
+// ABOUTME: Also covers coalesced resize delivery to widget resize handlers
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("Container Tests")
+struct ContainerTests {
+    
+    @Test("Container stack layout distributes space with flex factors")
+    func testStackLayout() {
+        let app = Application()
+        let column = Container()
+        column.useStackLayout(.vertical, spacing: 10)
+        #expect(column.usesStackLayout)
+        
+        let header = Widget()
+        header.setFixedSize(width: 50, height: 20)
+        let body = Widget()
+        body.setMinimumSize(width: 10, height: 10)
+        column.addChild(header)
+        column.addChild(body)
+        column.setFlex(body, grow: 1)
+        
+        column.resize(width: 200, height: 300)
+        column.show()
+        app.processEvents()
+        
+        // The body takes all remaining height; stretch is limited by the header's fixed width
+        #expect(body.y == 30)
+        #expect(body.height == 270)
+        #expect(body.width == 200)
+        #expect(header.width == 50)
+        column.hide()
+    }
+    
+    @Test("Coalesced resize delivery defers handlers to the frame timer")
+    func testResizeCoalescing() {
+        let app = Application()
+        let window = Widget()
+        window.show()
+        
+        var sizes: [(Int, Int)] = []
+        window.onResize { width, height in
+            sizes.append((width, height))
+        }
+        window.setResizeDelivery(.perFrame)
+        
+        // Resizes of a visible widget are dispatched synchronously, but the handler waits for the frame
+        window.resize(width: 300, height: 200)
+        window.resize(width: 310, height: 205)
+        window.resize(width: 320, height: 210)
+        #expect(sizes.isEmpty)
+        #expect(window.width == 320)
+        
+        // The frame timer delivers the burst once, with the size set last
+        let simulator = EventSimulator()
+        var attempts = 0
+        while sizes.isEmpty && attempts < 50 {
+            simulator.processEvents(10)
+            attempts += 1
+        }
+        app.processEvents()
+        #expect(sizes.count == 1)
+        #expect(sizes.last?.0 == 320)
+        #expect(sizes.last?.1 == 210)
+        window.hide()
+    }
+    
+    @Test("Keyed setChildren only touches the children that changed")
+    func testKeyedSetChildren() {
+        let app = Application()
+        let list = Container()
+        list.useStackLayout(.vertical)
+        let labels = (0..<50).map { Label("Row \($0)") }
+        
+        // First call parents every child
+        #expect(list.setChildren(keys: Array(0..<50), widgets: labels) == 50)
+        #expect(list.childCount == 50)
+        
+        // Same list again: nothing to do
+        #expect(list.setChildren(keys: Array(0..<50), widgets: labels) == 0)
+        
+        // Replacing one row removes the old widget and inserts the new one
+        var replaced: [any QtWidget] = labels
+        replaced[25] = Label("New row")
+        #expect(list.setChildren(keys: Array(0..<50), widgets: replaced) == 2)
+        
+        // Moving one row to the front restacks only that row
+        var keys = Array(0..<50)
+        keys.insert(keys.remove(at: 40), at: 0)
+        var moved = replaced
+        moved.insert(moved.remove(at: 40), at: 0)
+        #expect(list.setChildren(keys: keys, widgets: moved) == 1)
+        #expect(list.child(at: 0).map { ObjectIdentifier($0) } == ObjectIdentifier(moved[0]))
+        
+        // A keyed child taken by another container is inserted again, not treated as kept
+        let other = Container()
+        other.addChild(moved[0])
+        #expect(list.children.count == 49)
+        #expect(list.setChildren(keys: keys, widgets: moved) == 1)
+        #expect(list.children.count == 50)
+        
+        app.processEvents()
+    }
+    
+    @Test("LazySectionContainer builds only sections near the viewport")
+    func testLazySectionContainer() {
+        let app = Application()
+        let mark = LiveObjects.mark()
+        let scrollView = ScrollView()
+        scrollView.resize(width: 300, height: 200)
+        let list = LazySectionContainer(in: scrollView, overscan: 100)
+        for index in 0..<1000 {
+            list.appendSection(height: 50) { Label("Row \(index)") }
+        }
+        #expect(list.sectionCount == 1000)
+        scrollView.show()
+        app.processEvents()
+        scrollView.flushViewportChanges()
+        #expect(list.isMaterialized(0))
+        #expect(list.materializedCount < 30)
+        
+        scrollView.verticalScrollValue = 25_000
+        app.processEvents()
+        scrollView.flushViewportChanges()
+        #expect(!list.isMaterialized(0))
+        #expect(list.isMaterialized(500))
+        #expect(list.materializedCount < 30)
+        
+        // Jumping back releases the middle again and rebuilds the top
+        scrollView.verticalScrollValue = 0
+        app.processEvents()
+        scrollView.flushViewportChanges()
+        #expect(list.isMaterialized(0))
+        #expect(!list.isMaterialized(500))
+        #expect(list.materializedCount < 30)
+        scrollView.verticalScrollValue = 25_000
+        app.processEvents()
+        scrollView.flushViewportChanges()
+        
+        // Released sections take their QLabels with them
+        let labels = LiveObjects.alive(since: mark).filter { $0.kind == .widget && $0.typeName == "QLabel" }
+        #expect(labels.count == list.materializedCount)
+        list.removeAllSections()
+        #expect(!LiveObjects.alive(since: mark).contains { $0.typeName == "QLabel" })
+        scrollView.hide()
+    }
+}
@@ -0,0 +1,107 @@
+// ABOUTME: Tests for bulk event delivery: batched mouse moves and the shared event ring
+// ABOUTME: Counts the Swift callbacks each path costs for a burst of events
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("Event Delivery Tests")
+struct EventDeliveryTests {
+    
+    @Test("Mouse moves are delivered in batches ahead of the release")
+    func testMouseMoveBatches() {
+        let app = Application()
+        let surface = Widget()
+        surface.resize(width: 200, height: 200)
+        var events: [String] = []
+        var samples: [MouseSample] = []
+        surface.onMouseMoves { batch in
+            events.append("moves")
+            samples.append(contentsOf: batch)
+        }
+        surface.onMouseRelease { _, _ in
+            events.append("release")
+        }
+        surface.show()
+        app.processEvents()
+        
+        let simulator = EventSimulator()
+        simulator.drag(from: 10, 10, to: 150, 120, in: surface)
+        simulator.processEvents(50)
+        #expect(!samples.isEmpty)
+        #expect(samples.last?.x == 150)
+        #expect(samples.last?.y == 120)
+        #expect(events.firstIndex(of: "moves") ?? Int.max < events.firstIndex(of: "release") ?? -1)
+        surface.hide()
+    }
+    
+    @Test("Event ring delivers a burst with one drain instead of a call per event")
+    func testEventRingBenchmark() {
+        let app = Application()
+        let simulator = EventSimulator()
+        let eventCount = 20_000
+        // Counts the Swift handlers C++ calls, the crossings the ring is meant to save
+        var crossings = 0
+        let observer = CallbackTiming.addObserver { _ in
+            crossings += 1
+        }
+        defer { CallbackTiming.removeObserver(observer) }
+        
+        // Callback path: one call into Swift per move
+        let direct = Widget()
+        direct.resize(width: 200, height: 200)
+        direct.show()
+        app.processEvents()
+        var callbackMoves = 0
+        direct.onMouseMove { _, _ in
+            callbackMoves += 1
+        }
+        crossings = 0
+        simulator.sendMouseMoves(eventCount, to: direct)
+        #expect(callbackMoves == eventCount)
+        #expect(crossings == eventCount)
+        
+        // Ring path: records written in C++, drained in one call
+        let queued = Widget()
+        queued.resize(width: 200, height: 200)
+        queued.show()
+        app.processEvents()
+        let queue = EventQueue.shared
+        queue.capacity = eventCount
+        queue.resetCounters()
+        var drains = 0
+        var ringMoves = 0
+        var lastX = -1
+        queue.onDrain { events in
+            drains += 1
+            for event in events where event.tag == 7 && event.type == .MouseMove {
+                ringMoves += 1
+                lastX = event.intValue
+            }
+        }
+        queue.route([.MouseMove], of: queued, tag: 7)
+        crossings = 0
+        simulator.sendMouseMoves(eventCount, to: queued)
+        queue.drain()
+        #expect(ringMoves == eventCount)
+        #expect(drains == 1)
+        #expect(lastX == (eventCount - 1) % 200)
+        #expect(queue.droppedCount == 0)
+        // At most the automatic drain calls into Swift; the moves themselves never do
+        #expect(crossings <= 1)
+        
+        // Overflow is counted rather than blocking
+        queue.capacity = 64
+        queue.resetCounters()
+        simulator.sendMouseMoves(100, to: queued)
+        #expect(queue.pendingCount == 64)
+        #expect(queue.droppedCount == 36)
+        queue.drain()
+        
+        queue.unroute([.MouseMove], of: queued)
+        queue.removeDrainHandler()
+        direct.hide()
+        queued.hide()
+    }
+}
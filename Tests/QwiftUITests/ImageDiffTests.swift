@@ -0,0 +1,51 @@
+// ABOUTME: Tests for ImageDiff: changed regions, tolerance, heatmaps and anti-aliasing detection
+// ABOUTME: Compares a hand-built image against copies with a softened edge, a small change and a red block
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("ImageDiff Tests")
+struct ImageDiffTests {
+    
+    @Test("Image diff finds changed regions and excuses anti-aliasing")
+    func testImageDiff() {
+        // Black left half, white right half
+        let size = 64
+        var pixels = (0..<size * size).map { index -> UInt32 in
+            index % size < size / 2 ? 0xFF000000 : 0xFFFFFFFF
+        }
+        let expected = RenderedImage(width: size, height: size, pixels: pixels)
+        
+        let same = ImageDiff.compare(expected, expected)
+        #expect(same?.matches == true)
+        #expect(same?.bounds == nil)
+        
+        // A softened edge pixel, a slightly changed pixel and a 4x4 red block
+        pixels[10 * size + 32] = 0xFF808080
+        pixels[20 * size + 5] = 0xFF030303
+        for y in 40..<44 {
+            for x in 10..<14 {
+                pixels[y * size + x] = 0xFFFF0000
+            }
+        }
+        let actual = RenderedImage(width: size, height: size, pixels: pixels)
+        
+        let diff = ImageDiff.compare(expected, actual, tolerance: 5, heatmap: true)
+        #expect(diff?.differentPixels == 16)
+        #expect(diff?.antiAliasedPixels == 1)
+        #expect(diff?.maxDelta == 255)
+        #expect(diff?.bounds?.x == 10)
+        #expect(diff?.bounds?.y == 40)
+        #expect(diff?.bounds?.width == 4)
+        #expect(diff?.bounds?.height == 4)
+        #expect(diff?.heatmap?[10, 40] == 0xFFFF0000)
+        #expect(diff?.heatmap?[32, 10] == 0xFFFFFF00)
+        #expect(diff?.heatmap?[5, 20] == 0)
+        
+        let strict = ImageDiff.compare(expected, actual, ignoreAntiAliasing: false)
+        #expect(strict?.differentPixels == 18)
+        #expect(ImageDiff.compare(expected, RenderedImage(width: 1, height: 1, pixels: [0])) == nil)
+    }
+}
@@ -0,0 +1,115 @@
+// ABOUTME: Tests for input recording and replay, including double clicks by recorded timing
+// ABOUTME: Also covers bulk text entry into line edits, text edits and spin boxes
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("Input Simulation Tests")
+struct InputSimulationTests {
+    
+    @Test("Input sessions record, round-trip and replay")
+    func testInputRecording() {
+        _ = Application()
+        let window = Widget()
+        window.resize(width: 200, height: 100)
+        let field = LineEdit(parent: window)
+        field.setGeometry(x: 10, y: 10, width: 180, height: 30)
+        window.show()
+        
+        let session = InputRecording()
+        #expect(session.startRecording(window))
+        let simulator = EventSimulator()
+        simulator.typeText("hi", into: field)
+        simulator.click(field)
+        session.stopRecording()
+        #expect(!session.isRecording)
+        // Press and release for each key and for the click
+        #expect(session.eventCount >= 6)
+        #expect(field.text == "hi")
+        
+        let copy = InputRecording()
+        #expect(copy.load(bytes: session.bytes))
+        #expect(copy.eventCount == session.eventCount)
+        #expect(copy.event(at: 0).type == session.event(at: 0).type)
+        #expect(!copy.load(bytes: Array(session.bytes.dropLast())))
+        
+        // Replaying types the same text again
+        field.text = ""
+        simulator.setFocus(field)
+        #expect(copy.replay(into: window, speed: .compressed(100)) == copy.eventCount)
+        #expect(field.text == "hi")
+        #expect(copy.latencies.count == copy.eventCount)
+    }
+    
+    @Test("Replayed presses pair into double clicks by their recorded timing")
+    func testInputReplayDoubleClick() {
+        let app = Application()
+        let window = Widget()
+        window.resize(width: 200, height: 100)
+        window.show()
+        app.processEvents()
+        
+        let queue = EventQueue.shared
+        var doubleClicks = 0
+        var presses = 0
+        queue.onDrain { events in
+            for event in events where event.tag == 3 {
+                if event.type == .MouseDoubleClick { doubleClicks += 1 }
+                if event.type == .MousePress { presses += 1 }
+            }
+        }
+        queue.route([.MousePress, .MouseDoubleClick], of: window, tag: 3)
+        
+        // A double click, then two clicks two seconds apart; compressing the replay must
+        // not merge the slow pair into a second double click
+        let session = InputRecording()
+        let press = 2, release = 3, left: Int32 = 1
+        for (milliseconds, type) in [(0, press), (60, release), (120, press), (180, release),
+                                     (2000, press), (2060, release), (4000, press), (4060, release)] {
+            session.append(QtInputRecord(time: Int64(milliseconds) * 1000, type: Int32(type), code: left,
+                                         x: 50, y: 50, modifiers: 0, buttons: type == press ? left : 0,
+                                         text: 0, flags: 0))
+        }
+        #expect(session.replay(into: window, speed: .compressed(100)) == 8)
+        queue.drain()
+        #expect(doubleClicks == 1)
+        #expect(presses >= 3)
+        
+        queue.unroute([.MousePress, .MouseDoubleClick], of: window)
+        queue.removeDrainHandler()
+        window.hide()
+    }
+    
+    @Test("Bulk text entry fills fields in one pass")
+    func testTypeTextBulk() {
+        _ = Application()
+        let window = Widget()
+        let field = LineEdit(parent: window)
+        let editor = TextEdit(parent: window)
+        window.show()
+        let simulator = EventSimulator()
+        
+        let payload = String(repeating: "Grüße 👋 0123456789 ", count: 512)
+        #expect(simulator.typeTextBulk(payload, into: field, verify: true) == payload.count)
+        #expect(field.text == payload)
+        
+        field.text = ""
+        #expect(simulator.typeTextBulk("Key by key", into: field, mode: .keystrokes, verify: true) == 10)
+        
+        // A line edit drops the newline, so verification fails
+        field.text = ""
+        #expect(simulator.typeTextBulk("two\nlines", into: field, mode: .keystrokes, verify: true) == nil)
+        #expect(simulator.typeTextBulk("two\nlines", into: editor, mode: .keystrokes, verify: true) == 9)
+        
+        // A spin box takes the text through its line edit, which is what gets verified
+        let spinBox = SpinBox(parent: window)
+        spinBox.setRange(min: 0, max: 1000)
+        simulator.setFocus(spinBox)
+        simulator.keyPress(.right, widget: spinBox)
+        simulator.keyPress(.backspace, widget: spinBox)
+        #expect(simulator.typeTextBulk("42", into: spinBox, verify: true) == 2)
+        #expect(spinBox.value == 42)
+    }
+}
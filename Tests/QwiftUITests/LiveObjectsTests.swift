@@ -0,0 +1,65 @@
+// ABOUTME: Tests for live-object accounting of wrappers and widgets left alive
+// ABOUTME: Checks that widgets made through the public initializers are counted
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("LiveObjects Tests")
+struct LiveObjectsTests {
+    
+    @Test("Live-object accounting lists what is left alive")
+    func testLiveObjects() {
+        _ = Application()
+        LiveObjects.captureBacktraces = true
+        defer { LiveObjects.captureBacktraces = false }
+        
+        let mark = LiveObjects.mark()
+        var window: Widget? = Widget()
+        window?.setObjectName("leakProbe")
+        var label: Label? = Label("Inside", parent: window)
+        window?.show()
+        label?.show()
+        #expect(label?.text == "Inside")
+        
+        let alive = LiveObjects.alive(since: mark)
+        #expect(alive.contains { $0.kind == .wrapper && $0.typeName == "SwiftQLabel" })
+        #expect(alive.contains { $0.kind == .widget && $0.typeName == "QWidget" && $0.objectName == "leakProbe" })
+        #expect(alive.allSatisfy { !$0.backtrace.isEmpty })
+        #expect(LiveObjects.count(ofType: "QLabel") >= 1)
+        
+        // Lookups by name reuse one registry wrapper that goes away with its widget
+        let query = WidgetQuery()
+        #expect(query.widget(named: "leakProbe") != nil)
+        let wrappers = LiveObjects.count(.wrapper)
+        #expect(query.widget(named: "leakProbe") != nil)
+        #expect(LiveObjects.count(.wrapper) == wrappers)
+        
+        // The label's wrapper outlives the window it was created in
+        window = nil
+        #expect(LiveObjects.alive(since: mark).map(\.typeName) == ["SwiftQLabel"])
+        label = nil
+        #expect(LiveObjects.alive(since: mark).isEmpty)
+        #expect((LiveObjects.residentBytes ?? 1) > 0)
+    }
+    
+    @Test("Widgets made through the public initializers are counted")
+    func testLiveObjectsCountPublicWidgets() {
+        _ = Application()
+        let labels = LiveObjects.count(ofType: "QLabel")
+        let buttons = LiveObjects.count(ofType: "QPushButton")
+        var window: Widget? = Widget()
+        let label = Label("Counted", parent: window)
+        let button = Button("Counted", parent: window)
+        label.show()
+        button.show()
+        #expect(LiveObjects.count(ofType: "QLabel") == labels + 1)
+        #expect(LiveObjects.count(ofType: "QPushButton") == buttons + 1)
+        
+        // Destroying the parent takes the children out of the count
+        window = nil
+        #expect(LiveObjects.count(ofType: "QLabel") == labels)
+        #expect(LiveObjects.count(ofType: "QPushButton") == buttons)
+    }
+}
@@ -0,0 +1,56 @@
+// ABOUTME: Tests for non-blocking message boxes: coalescing duplicate alerts
+// ABOUTME: and reporting cancel when the parent is destroyed while the box is open
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("MessageBox Tests")
+struct MessageBoxTests {
+    
+    @Test("Non-blocking message boxes coalesce duplicate alerts")
+    func testAsyncMessageBox() {
+        var results: [(MessageBox.Buttons, Int)] = []
+        let first = MessageBox.open(title: "Sync", text: "Connection lost", icon: .warning) { button, count in
+            results.append((button, count))
+        }
+        let second = MessageBox.open(title: "Sync", text: "Connection lost", icon: .warning) { button, count in
+            results.append((button, count))
+        }
+        MessageBox.open(title: "Sync", text: "Disk full", icon: .warning)
+        
+        // open() returns immediately; duplicates share one dialog
+        #expect(first == 1)
+        #expect(second == 2)
+        #expect(MessageBox.openCount == 2)
+        #expect(results.isEmpty)
+        
+        MessageBox.finishAll(with: .ok)
+        #expect(MessageBox.openCount == 0)
+        #expect(results.count == 2)
+        #expect(results.allSatisfy { $0.0 == .ok && $0.1 == 2 })
+    }
+    
+    @Test("A message box destroyed with its parent reports cancel")
+    func testAsyncMessageBoxParentDestroyed() {
+        _ = Application()
+        var window: Widget? = Widget()
+        window?.show()
+        var results: [(MessageBox.Buttons, Int)] = []
+        MessageBox.open(title: "Sync", text: "Parent closing", icon: .warning, parent: window) { button, count in
+            results.append((button, count))
+        }
+        #expect(MessageBox.openCount == 1)
+        
+        window = nil
+        #expect(MessageBox.openCount == 0)
+        #expect(results.count == 1)
+        #expect(results.first?.0 == .cancel)
+        #expect(results.first?.1 == 1)
+        
+        // Nothing dangles: finishing the remaining boxes must not touch the deleted one
+        MessageBox.finishAll(with: .ok)
+        #expect(results.count == 1)
+    }
+}
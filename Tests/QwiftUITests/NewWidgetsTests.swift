@@ -1,8 +1,9 @@
-// ABOUTME: Tests for new widgets: Slider, ProgressBar, ScrollView, ImageView
-// ABOUTME: Verifies that the C++ bridge implementation works correctly
+// ABOUTME: Tests for basic widgets: Slider, ProgressBar, ScrollView, ImageView
+// ABOUTME: Also checks that widget event handlers can be registered
 
 import Testing
 @testable import QwiftUI
+import QwiftUITesting
 import Foundation
 
 @Suite("New Widgets Tests")
@@ -171,4 +172,4 @@ struct NewWidgetsTests {
         // the handlers are set without crashing
         #expect(valueChangedCalled == false) // Not triggered without event loop
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,109 @@
+// ABOUTME: Tests for painting: shared palette colors, Canvas display list updates
+// ABOUTME: and offscreen rendering to pixels and batched image files
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("Painting Tests")
+struct PaintingTests {
+    
+    @Test("Palette colors are interned and shared between widgets")
+    func testSharedPaletteColors() {
+        let app = Application()
+        let red = Qt.Color(red: 1, green: 0, blue: 0)
+        let green = Qt.Color(argb: 0xFF00FF00)
+        let cells = (0..<100).map { _ in Widget() }
+        
+        let before = SwiftQWidget.sharedPaletteCount()
+        for cell in cells {
+            cell.setBackgroundColor(red)
+        }
+        // One palette for all hundred cells
+        #expect(SwiftQWidget.sharedPaletteCount() == before + 1)
+        
+        // Blinking between two colors reuses the same two palettes
+        for _ in 0..<10 {
+            cells[0].setBackgroundColor(green)
+            cells[0].setBackgroundColor(red)
+        }
+        #expect(SwiftQWidget.sharedPaletteCount() == before + 2)
+        
+        cells[0].clearColors()
+        app.processEvents()
+    }
+    
+    @Test("Canvas updates only the display list items that changed")
+    func testCanvasDisplayList() {
+        let app = Application()
+        let canvas = Canvas()
+        canvas.resize(width: 400, height: 400)
+        
+        var gauge = DisplayList()
+        for i in 0..<1000 {
+            let x = Double(i % 40) * 10
+            let y = Double(i / 40) * 10
+            gauge.line(id: i, from: (x, y), to: (x + 5, y), color: Qt.Color(argb: 0xFF404040))
+        }
+        gauge.line(id: 5000, from: (200, 200), to: (260, 140), color: Qt.Color(argb: 0xFFFF0000), width: 3)
+        #expect(canvas.setDisplayList(gauge) == 1001)
+        #expect(canvas.itemCount == 1001)
+        
+        // Re-recording the same list changes nothing
+        #expect(canvas.setDisplayList(gauge) == 0)
+        
+        canvas.show()
+        app.processEvents()
+        
+        // Moving the needle updates one item and repaints only what it overlaps
+        var needle = DisplayList()
+        needle.line(id: 5000, from: (200, 200), to: (140, 140), color: Qt.Color(argb: 0xFFFF0000), width: 3)
+        #expect(canvas.update(with: needle) == 1)
+        #expect(canvas.itemCount == 1001)
+        app.processEvents()
+        #expect(canvas.lastPaintedItemCount < 1001)
+        
+        #expect(canvas.removeItems([0, 1, 2, 99999]) == 3)
+        #expect(canvas.itemCount == 998)
+        canvas.hide()
+    }
+    
+    @Test("Widgets render offscreen to pixels and batched files")
+    func testRenderToImage() {
+        _ = Application()
+        let panel = Widget()
+        panel.resize(width: 40, height: 30)
+        panel.setBackgroundColor(Qt.Color(argb: 0xFF2060A0))
+        
+        let image = panel.renderImage()
+        #expect(image?.width == 40)
+        #expect(image?.height == 30)
+        #expect(image?[10, 10] == 0xFF2060A0)
+        
+        let doubled = panel.renderImage(scale: 2, region: (x: 0, y: 0, width: 10, height: 5))
+        #expect(doubled?.width == 20)
+        #expect(doubled?.height == 10)
+        
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent("qwiftui-render-\(UUID().uuidString)")
+        try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        defer { try? FileManager.default.removeItem(at: directory) }
+        
+        let batch = RenderBatch(threadCount: 2)
+        let panels = (0..<12).map { index -> Widget in
+            let widget = Widget()
+            widget.resize(width: 32, height: 32)
+            widget.setBackgroundColor(Qt.Color(argb: 0xFF000000 | UInt32(index * 16)))
+            return widget
+        }
+        for (index, widget) in panels.enumerated() {
+            batch.add(widget, path: directory.appendingPathComponent("panel-\(index).png").path)
+        }
+        batch.add(panel, path: directory.appendingPathComponent("no-suffix").path)
+        
+        #expect(batch.run() == 12)
+        #expect(batch.succeeded(at: 0))
+        #expect(!batch.succeeded(at: 12))
+        #expect(FileManager.default.fileExists(atPath: directory.appendingPathComponent("panel-11.png").path))
+    }
+}
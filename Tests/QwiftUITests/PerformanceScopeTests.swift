@@ -0,0 +1,61 @@
+// ABOUTME: Tests for PerformanceScope: frame times, input latency and callback durations
+// ABOUTME: Also checks budgets, JSON reports and nested scopes
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("PerformanceScope Tests")
+struct PerformanceScopeTests {
+    
+    @Test("Performance scopes time frames, input and callbacks")
+    func testPerformanceScope() {
+        _ = Application()
+        let window = Widget()
+        window.resize(width: 200, height: 100)
+        let label = Label("", parent: window)
+        label.setGeometry(x: 10, y: 50, width: 180, height: 30)
+        let button = Button("Go", parent: window)
+        button.setGeometry(x: 10, y: 10, width: 80, height: 30)
+        button.onClicked {
+            label.text = "Clicked"
+        }
+        window.show()
+        let simulator = EventSimulator()
+        simulator.processEvents(50)
+        
+        var report = PerformanceScope.measure("click", on: window) {
+            simulator.click(button)
+            simulator.processEvents(50)
+        }
+        #expect(label.text == "Clicked")
+        #expect(!report.callbackDurations.isEmpty)
+        #expect(!report.frameTimes.isEmpty)
+        #expect(!report.samples(.clickLatency).isEmpty)
+        #expect(report.expect(.frameTime, percentile: 95, below: 1000))
+        #expect(!report.expect(.callbackDuration, percentile: 50, below: 0))
+        #expect(!report.passed)
+        #expect(report.checks.count == 2)
+        
+        let json = report.json()
+        #expect(json.contains("\"frameTime\""))
+        #expect(json.contains("\"checks\""))
+        
+        // Nested scopes each see the callbacks and frames of their own span
+        label.text = ""
+        let outer = PerformanceScope(name: "outer", root: window)
+        #expect(outer.start())
+        let inner = PerformanceScope.measure("inner", on: window) {
+            simulator.click(button)
+            simulator.processEvents(50)
+        }
+        simulator.click(button)
+        simulator.processEvents(50)
+        let outerReport = outer.stop()
+        #expect(!inner.callbackDurations.isEmpty)
+        #expect(!inner.frameTimes.isEmpty)
+        #expect(outerReport.callbackDurations.count > inner.callbackDurations.count)
+        #expect(outerReport.frameTimes.count > inner.frameTimes.count)
+    }
+}
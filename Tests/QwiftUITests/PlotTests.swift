@@ -0,0 +1,71 @@
+// ABOUTME: Tests for Plot decimation of large series to a few points per pixel column
+// ABOUTME: Checks the min/max reduction against a brute-force scan of every bucket
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("Plot Tests")
+struct PlotTests {
+    
+    @Test("Plot decimates a large series to a few points per pixel column")
+    func testPlotDecimation() {
+        let app = Application()
+        let plot = Plot()
+        plot.resize(width: 500, height: 200)
+        let series = plot.addSeries(color: Qt.Color(argb: 0xFF2080E0))
+        
+        let samples = (0..<1_000_000).map { sin(Double($0) / 1000) }
+        plot.setData(series: series, y: samples)
+        #expect(plot.sampleCount(series: series) == 1_000_000)
+        
+        plot.show()
+        app.processEvents()
+        #expect(plot.lastPointCount > 0)
+        #expect(plot.lastPointCount <= 2 * 500)
+        
+        // A streaming tail extends the series in place
+        plot.followWindow = 100_000
+        plot.append(series: series, y: Array(repeating: 0.5, count: 1000))
+        #expect(plot.sampleCount(series: series) == 1_001_000)
+        app.processEvents()
+        #expect(plot.lastPointCount <= 2 * 500)
+        plot.hide()
+    }
+    
+    @Test("Plot min/max reduction matches a brute-force scan of every bucket")
+    func testPlotMinMaxBuckets() {
+        _ = Application()
+        let plot = Plot()
+        let series = plot.addSeries(color: Qt.Color(argb: 0xFF2080E0))
+        // Not a multiple of the pyramid's block sizes, with spikes at varying offsets in a block
+        var samples = (0..<100_003).map { index in
+            sin(Double(index) / 97) + (index % 131 == 0 ? Double(index % 11) - 5 : 0)
+        }
+        plot.setData(series: series, y: samples)
+        
+        func checkBuckets(_ bucketCount: Int) {
+            let bucketSize = (samples.count + bucketCount - 1) / bucketCount
+            for begin in stride(from: 0, to: samples.count, by: bucketSize) {
+                // The last bucket is only partially filled
+                let end = min(begin + bucketSize, samples.count)
+                let bucket = samples[begin..<end]
+                let reduced = plot.minMax(series: series, in: begin..<end)
+                #expect(reduced?.min == bucket.min(), "bucket \(begin)..<\(end)")
+                #expect(reduced?.max == bucket.max(), "bucket \(begin)..<\(end)")
+            }
+        }
+        checkBuckets(500)
+        checkBuckets(37)
+        
+        // Appending rebuilds only the tail blocks; the buckets over it must still agree
+        let tail = (0..<1_234).map { Double($0 % 50) - 25 }
+        samples.append(contentsOf: tail)
+        plot.append(series: series, y: tail)
+        checkBuckets(500)
+        
+        #expect(plot.minMax(series: series, in: 5..<5) == nil)
+        #expect(plot.minMax(series: series, in: 0..<(samples.count + 1)) == nil)
+    }
+}
@@ -0,0 +1,47 @@
+// ABOUTME: Tests for ProgressChannel, advanced off the main actor and sampled by widgets
+// ABOUTME: Checks that attached widgets pick up the final value on their next sample
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("ProgressChannel Tests")
+struct ProgressChannelTests {
+    
+    @Test("Progress channel is advanced off the main actor and sampled by widgets")
+    func testProgressChannel() async {
+        let app = Application()
+        let progress = ProgressChannel()
+        let bar = ProgressBar()
+        bar.minimum = 0
+        bar.maximum = 100_000
+        bar.attach(progress, interval: 5)
+        let counter = LCDNumber(digitCount: 8)
+        counter.attach(progress, interval: 5)
+        bar.show()
+        counter.show()
+        
+        await withTaskGroup(of: Void.self) { group in
+            for _ in 0..<4 {
+                group.addTask {
+                    for _ in 0..<25_000 {
+                        progress.add()
+                    }
+                }
+            }
+        }
+        #expect(progress.value == 100_000)
+        
+        // Widgets pick the value up on their next sample
+        for _ in 0..<10 {
+            app.processEvents()
+            try? await Task.sleep(nanoseconds: 5_000_000)
+        }
+        app.processEvents()
+        #expect(bar.value == 100_000)
+        #expect(counter.intValue == 100_000)
+        bar.hide()
+        counter.hide()
+    }
+}
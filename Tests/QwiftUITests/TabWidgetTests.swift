@@ -0,0 +1,74 @@
+// ABOUTME: Tests for TabWidget lazy pages: building on first visit, eviction of idle pages
+// ABOUTME: and building the page that becomes current when the current one is removed
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("TabWidget Tests")
+struct TabWidgetTests {
+    
+    @Test("TabWidget builds lazy pages on first visit and evicts idle ones")
+    func testLazyTabs() {
+        let tabs = TabWidget()
+        var built: [String] = []
+        var restored: [String] = []
+        
+        tabs.addLazyTab(label: "First") {
+            built.append("First")
+            return Widget()
+        }
+        tabs.addLazyTab(label: "Second", build: { state in
+            built.append("Second")
+            if let state = state as? String {
+                restored.append(state)
+            }
+            return Widget()
+        }, saveState: { _ in "saved" })
+        tabs.addLazyTab(label: "Third") {
+            built.append("Third")
+            return Widget()
+        }
+        
+        // Only the tab made current by the first insertion is built
+        #expect(built == ["First"])
+        #expect(tabs.isPageLoaded(at: 0))
+        #expect(!tabs.isPageLoaded(at: 1))
+        
+        tabs.setLazyTabEviction(afterIdleActivations: 1)
+        tabs.currentIndex = 1
+        tabs.currentIndex = 2
+        #expect(!tabs.isPageLoaded(at: 0))
+        
+        tabs.currentIndex = 0
+        #expect(!tabs.isPageLoaded(at: 1))
+        tabs.currentIndex = 1
+        #expect(built == ["First", "Second", "Third", "First", "Second"])
+        #expect(restored == ["saved"])
+    }
+    
+    @Test("Removing the current lazy tab builds the one that becomes current")
+    func testRemoveCurrentLazyTab() {
+        let tabs = TabWidget()
+        var built: [String] = []
+        tabs.addLazyTab(label: "First") {
+            built.append("First")
+            return Widget()
+        }
+        tabs.addLazyTab(label: "Second") {
+            built.append("Second")
+            return Widget()
+        }
+        tabs.setLazyTabEviction(afterIdleActivations: 1)
+        #expect(tabs.currentIndex == 0)
+        
+        tabs.removeTab(0)
+        #expect(tabs.count == 1)
+        #expect(built == ["First", "Second"])
+        #expect(tabs.isPageLoaded(at: 0))
+        
+        tabs.removeTab(0)
+        #expect(tabs.count == 0)
+    }
+}
@@ -0,0 +1,119 @@
+// ABOUTME: Tests for text widgets: TextEdit deltas and ranged reads, LineEdit and CheckBox change signals
+// ABOUTME: Also round-trips large documents through the UTF-8 text overloads
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("Text Input Tests")
+struct TextInputTests {
+    
+    @Test("TextEdit incremental deltas and ranged reads")
+    func testTextEditDeltas() {
+        let textEdit = TextEdit()
+        
+        var deltas: [TextDelta] = []
+        textEdit.onContentsChanged { delta in
+            deltas.append(delta)
+        }
+        
+        let startRevision = textEdit.revision
+        textEdit.text = "Hello\nWorld"
+        
+        // Document edits are delivered synchronously by QTextDocument
+        #expect(textEdit.revision > startRevision)
+        #expect(deltas.last?.addedText.hasPrefix("Hello\nWorld") == true)
+        #expect(deltas.last?.revision == textEdit.revision)
+        
+        // Ranged reads only convert the requested slice
+        #expect(textEdit.characterCount == 11)
+        #expect(textEdit.text(from: 0, length: 5) == "Hello")
+        #expect(textEdit.text(from: 6) == "World")
+        #expect(textEdit.text(from: 100, length: 5) == "")
+    }
+    
+    @Test("LineEdit and CheckBox deliver change signals")
+    func testChangeSignals() {
+        _ = Application()
+        let lineEdit = LineEdit()
+        var received: [String] = []
+        lineEdit.onTextChanged { text in
+            received.append(text)
+        }
+        lineEdit.text = "query"
+        #expect(received == ["query"])
+        
+        // Coalesced handlers wait for the timer, so nothing is delivered synchronously
+        var throttled: [String] = []
+        lineEdit.onTextChanged(delivery: .throttle(milliseconds: 50)) { text in
+            throttled.append(text)
+        }
+        lineEdit.text = "a"
+        lineEdit.text = "ab"
+        #expect(throttled.isEmpty)
+        // Once the interval passes, the burst arrives as its latest value only
+        EventSimulator().processEvents(150)
+        #expect(throttled == ["ab"])
+        
+        let checkBox = CheckBox("Option")
+        var states: [Int] = []
+        checkBox.onStateChanged { state in
+            states.append(state)
+        }
+        checkBox.isChecked = true
+        #expect(states == [2])
+    }
+    
+    @Test("UTF-8 text overloads round-trip 1 KB and 1 MB documents")
+    func testUTF8TextThroughput() {
+        _ = Application()
+        let editor = TextEdit()
+        let clock = ContinuousClock()
+        
+        // Timings depend on the machine and its load, so they are reported rather than asserted
+        for (size, iterations) in [(1_024, 2_000), (1_048_576, 10)] {
+            let line = "Grüße, 世界! 0123456789 abcdefghijklmnopqrstuvwxyz\n"
+            let text = String(repeating: line, count: max(size / line.utf8.count, 1))
+            var legacy = Duration.seconds(Int64.max)
+            var direct = Duration.seconds(Int64.max)
+            var legacyText = ""
+            var utf8Text = ""
+            
+            // Best of three runs of each path, interleaved, to keep scheduler noise out
+            for _ in 0..<3 {
+                // std::string path: String -> std.string -> QString -> std::string -> String
+                legacy = min(legacy, clock.measure {
+                    for _ in 0..<iterations {
+                        editor.qtTextEdit.pointee.setPlainText(std.string(text))
+                        legacyText = String(editor.qtTextEdit.pointee.toPlainText())
+                    }
+                })
+                
+                // UTF-8 path: one decode in, one encode out into the reused buffer
+                direct = min(direct, clock.measure {
+                    for _ in 0..<iterations {
+                        editor.text = text
+                        utf8Text = editor.text
+                    }
+                })
+            }
+            #expect(legacyText == text)
+            #expect(utf8Text == text)
+            print("UTF-8 text round trip, \(size) bytes x \(iterations): utf8 \(direct), std::string \(legacy)")
+        }
+        
+        // Unchanged documents are not re-encoded, and edits invalidate the export
+        editor.text = "first"
+        #expect(editor.text == "first")
+        #expect(editor.text == "first")
+        editor.text = "second"
+        #expect(editor.text == "second")
+        
+        let label = Label("")
+        label.text = "Café ☕"
+        #expect(label.text == "Café ☕")
+        label.text = ""
+        #expect(label.text == "")
+    }
+}
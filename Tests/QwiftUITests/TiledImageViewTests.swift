@@ -0,0 +1,96 @@
+// ABOUTME: Tests for TiledImageView: header-only loading, edge tiles of odd-sized images
+// ABOUTME: and tiles that fail to decode not being requested again
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("TiledImageView Tests")
+struct TiledImageViewTests {
+    
+    @Test("TiledImageView reads only the header on load")
+    func testTiledImageViewLoad() {
+        let app = Application()
+        let viewer = TiledImageView()
+        viewer.resize(width: 300, height: 200)
+        
+        #expect(!viewer.load(path: "/nonexistent/scan.jpg"))
+        #expect(viewer.imageSize.width == 0)
+        #expect(viewer.cachedBytes == 0)
+        
+        viewer.cacheLimit = 8 * 1024 * 1024
+        viewer.setZoom(2, anchorX: 0, anchorY: 0)
+        viewer.show()
+        app.processEvents()
+        #expect(viewer.pendingTileCount == 0)
+        viewer.hide()
+    }
+    
+    @Test("TiledImageView draws edge tiles of images not a multiple of the tile size")
+    func testTiledImageViewEdgeTiles() throws {
+        let app = Application()
+        let color: UInt32 = 0xFF2060A0
+        let source = Widget()
+        source.resize(width: 300, height: 260)
+        source.setBackgroundColor(Qt.Color(argb: color))
+        // PNG has no clip-rect decoding, so the viewer cuts tiles out of a whole decoded level
+        let path = NSTemporaryDirectory() + "tiled-edge-\(UUID().uuidString).png"
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        #expect(source.render(to: path))
+        
+        let viewer = TiledImageView()
+        viewer.resize(width: 300, height: 260)
+        #expect(viewer.load(path: path))
+        #expect(viewer.zoom == 1)
+        viewer.show()
+        app.processEvents()
+        let simulator = EventSimulator()
+        var attempts = 0
+        while (viewer.pendingTileCount > 0 || viewer.cachedBytes == 0) && attempts < 200 {
+            simulator.processEvents(10)
+            attempts += 1
+        }
+        #expect(viewer.pendingTileCount == 0)
+        
+        let image = try #require(viewer.renderImage())
+        for (x, y) in [(299, 0), (0, 259), (299, 259), (270, 130), (150, 250)] {
+            #expect(image[x, y] == color, "pixel (\(x), \(y))")
+        }
+        viewer.hide()
+    }
+    
+    @Test("TiledImageView does not retry tiles that fail to decode")
+    func testTiledImageViewFailedDecode() throws {
+        let app = Application()
+        let source = Widget()
+        source.resize(width: 300, height: 260)
+        let path = NSTemporaryDirectory() + "tiled-corrupt-\(UUID().uuidString).png"
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        #expect(source.render(to: path))
+        // Keep the header, so the size still reads, and drop the pixel data
+        let bytes = try Data(contentsOf: URL(fileURLWithPath: path))
+        try bytes.prefix(80).write(to: URL(fileURLWithPath: path))
+        
+        let viewer = TiledImageView()
+        viewer.resize(width: 300, height: 260)
+        #expect(viewer.load(path: path))
+        viewer.show()
+        app.processEvents()
+        let simulator = EventSimulator()
+        var attempts = 0
+        while viewer.pendingTileCount > 0 && attempts < 200 {
+            simulator.processEvents(10)
+            attempts += 1
+        }
+        
+        // Repaints after the failure must not queue the same decode again
+        for _ in 0..<10 {
+            viewer.pan(dx: 0, dy: 0)
+            app.processEvents()
+            #expect(viewer.pendingTileCount == 0)
+        }
+        #expect(viewer.cachedBytes == 0)
+        viewer.hide()
+    }
+}
@@ -0,0 +1,73 @@
+// ABOUTME: Tests for the widget registry: canonical wrappers for children and queries
+// ABOUTME: and read-only widget views that go inert with their widget
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("Widget Registry Tests")
+struct WidgetRegistryTests {
+    
+    @Test("Widget registry returns canonical wrappers for children and queries")
+    func testWidgetRegistry() {
+        _ = Application()
+        let window = Widget()
+        let title = Label("Title", parent: window)
+        title.setObjectName("title")
+        let button = Button("OK", parent: window)
+        title.show()
+        button.show()
+        
+        // Children are the wrappers that created them, not fresh copies
+        let children = window.children
+        #expect(children.count == 2)
+        let childPointers = Set(children.map { UnsafeMutableRawPointer($0.getBridgeWidget()) })
+        #expect(childPointers.contains(UnsafeMutableRawPointer(title.getBridgeWidget())))
+        #expect(childPointers.contains(UnsafeMutableRawPointer(button.getBridgeWidget())))
+        
+        // Repeated queries resolve to the same wrapper
+        let query = WidgetQuery(root: window)
+        let first = query.widget(named: "title")
+        let second = query.widget(named: "title")
+        #expect(first?.refers(to: title) == true)
+        #expect(second?.refers(to: title) == true)
+        
+        // Handles resolve while the widget lives
+        let handle = SwiftWidgetRegistry.handleFor(title.getBridgeWidget())
+        #expect(handle != 0)
+        #expect(SwiftWidgetRegistry.resolve(handle) == title.getBridgeWidget())
+    }
+    
+    @Test("Widget views leave handlers alone and go inert with their widget")
+    func testWidgetViews() {
+        _ = Application()
+        let window = Widget()
+        window.resize(width: 200, height: 100)
+        var clicks = 0
+        let button = Button("OK", parent: window)
+        button.setObjectName("ok")
+        button.setGeometry(x: 10, y: 10, width: 80, height: 30)
+        button.onClicked { clicks += 1 }
+        var label: Label? = Label("Temporary", parent: window)
+        window.show()
+        
+        // Clicking through a view reaches the creator's handler
+        guard let view = WidgetQuery(root: window).widget(named: "ok") else {
+            Issue.record("button not found")
+            return
+        }
+        EventSimulator().click(view)
+        #expect(clicks == 1)
+        
+        let labelView = window.children.compactMap { $0 as? WidgetView }.first { view in
+            label.map { view.refers(to: $0) } ?? false
+        }
+        #expect(labelView?.isValid == true)
+        label = nil
+        #expect(labelView?.isValid == false)
+        #expect(labelView?.isVisible == false)
+        labelView?.show()
+        #expect(labelView?.objectName == "")
+    }
+}
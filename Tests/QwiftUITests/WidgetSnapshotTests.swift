@@ -0,0 +1,57 @@
+// ABOUTME: Tests for WidgetSnapshot capture, byte round trips and restoring into another widget
+// ABOUTME: Checks class names, object names, properties and event masks of the captured tree
+
+import Testing
+@testable import QwiftUI
+import QwiftUITesting
+import Foundation
+
+@Suite("WidgetSnapshot Tests")
+struct WidgetSnapshotTests {
+    
+    @Test("Widget snapshots round-trip through bytes and restore")
+    func testWidgetSnapshot() {
+        _ = Application()
+        let form = Widget()
+        form.resize(width: 300, height: 200)
+        let title = Label("Settings", parent: form)
+        title.setObjectName("title")
+        title.setGeometry(x: 10, y: 10, width: 200, height: 24)
+        let apply = Button("Apply", parent: form)
+        apply.setObjectName("apply")
+        apply.setGeometry(x: 10, y: 50, width: 80, height: 30)
+        let canvas = Widget(parent: form)
+        canvas.setObjectName("canvas")
+        canvas.setGeometry(x: 100, y: 50, width: 180, height: 120)
+        canvas.onMouseMove { _, _ in }
+        title.show()
+        apply.show()
+        canvas.show()
+        
+        let snapshot = WidgetSnapshot()
+        #expect(snapshot.capture(form))
+        #expect(snapshot.widgetCount == 4)
+        #expect(snapshot.className(at: 1) == "QLabel")
+        #expect(snapshot.objectName(at: 2) == "apply")
+        #expect(snapshot.text.contains("text = \"Settings\""))
+        
+        // The bytes decode to the same tree
+        let copy = WidgetSnapshot()
+        #expect(copy.load(bytes: snapshot.bytes))
+        #expect(copy.text == snapshot.text)
+        #expect(!copy.load(bytes: Array(snapshot.bytes.dropLast())))
+        
+        // Restoring rebuilds the children under another widget
+        let target = Widget()
+        #expect(copy.restore(into: target))
+        #expect(target.children.count == 3)
+        #expect(copy.restoredWidget(at: 1)?.objectName == "title")
+        
+        let restored = WidgetSnapshot()
+        #expect(restored.capture(target))
+        #expect(restored.widgetCount == 4)
+        #expect(restored.className(at: 2) == "QPushButton")
+        #expect(snapshot.eventMask(at: 3) == 1 << UInt64(QtEventType.MouseMove.rawValue))
+        #expect(restored.eventMask(at: 3) == 0)
+    }
+}